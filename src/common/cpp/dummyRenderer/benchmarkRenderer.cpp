@@ -0,0 +1,275 @@
+#include "benchmarkRenderer.h"
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <maya/MGlobal.h>
+#include "world.h"
+#include "mayaScene.h"
+#include "renderGlobals.h"
+#include "shadingtools/material.h"
+#include "shadingtools/shadingUtils.h"
+#include "threads/parallelFor.h"
+#include "utilities/meshTools.h"
+#include "utilities/tools.h"
+#include "utilities/logging.h"
+
+namespace MayaTo{
+
+	static double secondsSince(std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	void BenchmarkResult::addPhase(const std::string& name, double seconds, int count)
+	{
+		BenchmarkPhase phase;
+		phase.name = name;
+		phase.seconds = seconds;
+		phase.count = count;
+		this->phases.push_back(phase);
+		Logging::info(MString("Benchmark phase ") + name.c_str() + ": " + seconds + " sec, " + count + " elements");
+	}
+
+	double BenchmarkResult::getTotalSeconds() const
+	{
+		double seconds = 0.0;
+		for (const BenchmarkPhase& phase : this->phases)
+			seconds += phase.seconds;
+		return seconds;
+	}
+
+	std::string BenchmarkResult::toJson() const
+	{
+		std::ostringstream json;
+		json << "{\n";
+		json << "  \"scene\": \"" << escapeJson(this->sceneName) << "\",\n";
+		json << "  \"renderer\": \"" << escapeJson(this->rendererName) << "\",\n";
+		json << "  \"frame\": " << this->frame << ",\n";
+		json << "  \"threads\": " << this->threads << ",\n";
+		json << "  \"objects\": " << this->objects << ",\n";
+		json << "  \"meshes\": " << this->meshes << ",\n";
+		json << "  \"instances\": " << this->instances << ",\n";
+		json << "  \"lights\": " << this->lights << ",\n";
+		json << "  \"vertices\": " << this->vertices << ",\n";
+		json << "  \"triangles\": " << this->triangles << ",\n";
+		json << "  \"shadingGroups\": " << this->shadingGroups << ",\n";
+		json << "  \"shadingNodes\": " << this->shadingNodes << ",\n";
+		json << "  \"reusedMaterials\": " << this->reusedMaterials << ",\n";
+		json << "  \"motionSteps\": " << this->motionSteps << ",\n";
+		json << "  \"meshSamples\": " << this->meshSamples << ",\n";
+		json << "  \"totalSeconds\": " << this->getTotalSeconds() << ",\n";
+		json << "  \"phases\": [\n";
+		for (size_t i = 0; i < this->phases.size(); i++)
+		{
+			const BenchmarkPhase& phase = this->phases[i];
+			json << "    {\"name\": \"" << escapeJson(phase.name) << "\", \"seconds\": " << phase.seconds << ", \"count\": " << phase.count << "}";
+			json << ((i + 1 < this->phases.size()) ? ",\n" : "\n");
+		}
+		json << "  ]\n";
+		json << "}\n";
+		return json.str();
+	}
+
+	BenchmarkRenderer::BenchmarkRenderer(BenchmarkResult& benchmarkResult) : result(benchmarkResult)
+	{}
+
+	void BenchmarkRenderer::updateShape(std::shared_ptr<MayaObject> obj)
+	{
+		if (obj->instanceNumber > 0)
+			return;
+
+		if (obj->mobject.hasFn(MFn::kMesh))
+		{
+			if ((obj->meshDataList.size() == 0) || obj->isShapeConnected())
+			{
+				obj->addMeshData();
+				this->result.meshSamples++;
+			}
+		}
+	}
+
+	void BenchmarkRenderer::defineGeometry()
+	{
+		std::shared_ptr<MayaScene> mayaScene = getWorldPtr()->worldScenePtr;
+		std::shared_ptr<RenderGlobals> renderGlobals = getWorldPtr()->worldRenderGlobalsPtr;
+
+		std::vector<std::shared_ptr<MayaObject>> meshObjects;
+		for (auto obj : mayaScene->objectList)
+		{
+			if (!obj->mobject.hasFn(MFn::kMesh))
+				continue;
+			if (obj->instanceNumber > 0)
+			{
+				this->result.instances++;
+				continue;
+			}
+			meshObjects.push_back(obj);
+		}
+		this->result.meshes = (int)meshObjects.size();
+
+		// the same two phases as in a real renderer, reading on the main thread, triangulation in parallel
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		std::vector<MeshExtract> extracts(meshObjects.size());
+		for (size_t i = 0; i < meshObjects.size(); i++)
+		{
+			if (!extractMeshBuffers(meshObjects[i]->mobject, meshObjects[i]->perFaceAssignments, extracts[i]))
+				Logging::error(MString("Unable to read mesh data from ") + meshObjects[i]->shortName);
+		}
+		this->result.addPhase("meshExtraction", secondsSince(start), (int)meshObjects.size());
+
+		start = std::chrono::steady_clock::now();
+		parallelFor(extracts.size(), [&](size_t i)
+		{
+			if (extracts[i].valid)
+				triangulateMeshExtract(extracts[i]);
+		}, renderGlobals->threads);
+		this->result.addPhase("meshTriangulation", secondsSince(start), (int)extracts.size());
+
+		for (const MeshExtract& extract : extracts)
+		{
+			this->result.vertices += (long long)extract.points.size() / 3;
+			this->result.triangles += (long long)extract.triPointIds.size() / 3;
+		}
+	}
+
+	void BenchmarkRenderer::defineMaterials()
+	{
+		std::shared_ptr<MayaScene> mayaScene = getWorldPtr()->worldScenePtr;
+		MaterialCache& materialCache = getMaterialCache();
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for (auto obj : mayaScene->objectList)
+		{
+			if (!obj->mobject.hasFn(MFn::kMesh) || (obj->instanceNumber > 0))
+				continue;
+
+			getObjectShadingGroups(obj->dagPath, obj->perFaceAssignments, obj->shadingGroups, false);
+			for (uint sgId = 0; sgId < obj->shadingGroups.length(); sgId++)
+			{
+				MObject shadingGroup = obj->shadingGroups[sgId];
+				MObject surfaceShaderNode = getConnectedInNode(shadingGroup, "surfaceShader");
+				ShadingNetwork network(surfaceShaderNode);
+				this->result.shadingGroups++;
+
+				unsigned long long networkHash = network.getHash();
+				MString materialName = getObjectName(shadingGroup);
+				if (materialCache.findMaterial(networkHash, materialName))
+				{
+					materialCache.reusedMaterials++;
+					continue;
+				}
+				materialCache.addMaterial(networkHash, materialName);
+				this->result.shadingNodes += (int)network.shaderList.size();
+			}
+		}
+		this->result.reusedMaterials = materialCache.reusedMaterials;
+		this->result.addPhase("materialTranslation", secondsSince(start), this->result.shadingGroups);
+	}
+
+	static bool sampleMotionSteps(BenchmarkResult& result)
+	{
+		std::shared_ptr<MayaScene> mayaScene = getWorldPtr()->worldScenePtr;
+		std::shared_ptr<RenderGlobals> renderGlobals = getWorldPtr()->worldRenderGlobalsPtr;
+		float currentFrame = renderGlobals->getFrameNumber();
+
+		renderGlobals->getMbSteps();
+		if (mayaScene->updateVelocityMotionBlur())
+			renderGlobals->removeGeoSteps();
+		int numMbSteps = (int)renderGlobals->mbElementList.size();
+		if (numMbSteps == 0)
+		{
+			Logging::error(MString("no mb steps, something's wrong."));
+			return false;
+		}
+		result.motionSteps = numMbSteps;
+
+		for (int mbStepId = 0; mbStepId < numMbSteps; mbStepId++)
+		{
+			renderGlobals->currentMbStep = mbStepId;
+			renderGlobals->currentMbElement = renderGlobals->mbElementList[mbStepId];
+			renderGlobals->currentFrameNumber = (float)(currentFrame + renderGlobals->mbElementList[mbStepId].time);
+			if ((mbStepId == 0) || (renderGlobals->mbElementList[mbStepId].time != renderGlobals->mbElementList[mbStepId - 1].time))
+				MGlobal::viewFrame(renderGlobals->currentFrameNumber);
+			mayaScene->updateScene();
+			renderGlobals->currentMbStep++;
+		}
+		MGlobal::viewFrame(currentFrame);
+		renderGlobals->currentFrameNumber = currentFrame;
+		return true;
+	}
+
+	MString runTranslationBenchmark(const MString& resultFile, const MString& sceneName)
+	{
+		MayaToWorld *world = getWorldPtr();
+		if ((world->renderState == MayaToWorld::RSTATERENDERING) || (world->renderState == MayaToWorld::RSTATETRANSLATING))
+		{
+			Logging::error("Translation benchmark: a rendering is running, please try again after it is finished.");
+			return "";
+		}
+
+		BenchmarkResult result;
+		result.sceneName = sceneName.asChar();
+		result.rendererName = getRendererName().asChar();
+
+		MayaToWorld::WorldRenderType oldRenderType = world->renderType;
+		std::shared_ptr<Renderer> oldRenderer = world->worldRendererPtr;
+		world->renderType = MayaToWorld::BATCHRENDER;
+		world->initializeRenderGlobals();
+		world->initializeScene();
+		std::shared_ptr<BenchmarkRenderer> renderer = std::make_shared<BenchmarkRenderer>(result);
+		world->worldRendererPtr = renderer;
+		getMaterialCache().clear();
+
+		std::shared_ptr<MayaScene> mayaScene = world->worldScenePtr;
+		std::shared_ptr<RenderGlobals> renderGlobals = world->worldRenderGlobalsPtr;
+		renderGlobals->updateFrameNumber();
+		result.frame = renderGlobals->getFrameNumber();
+		result.threads = (int)getNumWorkerThreads(renderGlobals->threads);
+
+		// parseScene() does the light linking, it is measured separately
+		bool success = false;
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		if (mayaScene->parseScene())
+		{
+			double parseSeconds = secondsSince(start);
+			result.objects = (int)mayaScene->objectList.size();
+			result.lights = (int)mayaScene->lightList.size();
+			result.addPhase("parse", parseSeconds - mayaScene->lightLinkingTime, result.objects);
+			result.addPhase("lightLinking", mayaScene->lightLinkingTime, result.lights);
+
+			start = std::chrono::steady_clock::now();
+			success = sampleMotionSteps(result);
+			result.addPhase("motionSampling", secondsSince(start), result.motionSteps);
+
+			if (success)
+			{
+				renderer->defineGeometry();
+				renderer->defineMaterials();
+			}
+		}
+		else{
+			Logging::error("Translation benchmark: unable to parse the scene.");
+		}
+
+		world->cleanUpAfterRender();
+		getMaterialCache().clear();
+		world->worldRendererPtr = oldRenderer;
+		world->renderType = oldRenderType;
+
+		if (!success)
+			return "";
+
+		std::string json = result.toJson();
+		if (resultFile.length() > 0)
+		{
+			std::ofstream outFile(resultFile.asChar());
+			if (!outFile.good())
+			{
+				Logging::error(MString("Translation benchmark: unable to write result file ") + resultFile);
+				return "";
+			}
+			outFile << json;
+			Logging::info(MString("Translation benchmark: results saved in ") + resultFile);
+		}
+		return MString(json.c_str());
+	}
+}
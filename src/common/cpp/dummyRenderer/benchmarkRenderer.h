@@ -0,0 +1,89 @@
+#ifndef MT_BENCHMARK_RENDERER_H
+#define MT_BENCHMARK_RENDERER_H
+
+/*
+	A renderer without a backend. It does the same work a real renderer does during translation,
+	it reads and triangulates the meshes, parses the shading networks and samples the motion steps,
+	but it creates nothing. So the measured times are the times of the plugin code and the Maya API,
+	independent of the renderer library.
+
+	runTranslationBenchmark() replaces the renderer of the world for one call, translates the current scene
+	and saves the duration of every phase as json. common/python/Renderer/translationBenchmark.py creates
+	synthetic scenes in mayapy and calls it with the -benchmark flag of the render command.
+*/
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <maya/MString.h>
+#include "rendering/renderer.h"
+
+class MayaObject;
+
+namespace MayaTo{
+
+	struct BenchmarkPhase{
+		std::string name;
+		double seconds = 0.0;
+		// number of processed elements, e.g. objects, meshes or shading groups
+		int count = 0;
+	};
+
+	struct BenchmarkResult{
+		std::string sceneName;
+		std::string rendererName;
+		float frame = 0.0f;
+		int threads = 0;
+		int objects = 0;
+		int meshes = 0;
+		int instances = 0;
+		int lights = 0;
+		long long vertices = 0;
+		long long triangles = 0;
+		int shadingGroups = 0;
+		int shadingNodes = 0;
+		int reusedMaterials = 0;
+		int motionSteps = 0;
+		// number of mesh motion samples saved with addMeshData()
+		int meshSamples = 0;
+		std::vector<BenchmarkPhase> phases;
+
+		void addPhase(const std::string& name, double seconds, int count);
+		double getTotalSeconds() const;
+		std::string toJson() const;
+	};
+
+	class BenchmarkRenderer : public Renderer
+	{
+	public:
+		explicit BenchmarkRenderer(BenchmarkResult& result);
+		virtual ~BenchmarkRenderer(){}
+
+		virtual void defineCamera(){}
+		virtual void defineEnvironment(){}
+		// reads the mesh buffers of all meshes on the main thread and triangulates them in parallel
+		virtual void defineGeometry();
+		virtual void defineLights(){}
+		// parses the surface shader networks of all shading groups and looks them up in the material cache
+		void defineMaterials();
+		virtual void interactiveFbCallback(){}
+		virtual void render(){}
+		virtual void initializeRenderer(){}
+		virtual void unInitializeRenderer(){}
+		// saves the mesh data of every deform step like a renderer which needs all motion steps at once
+		virtual void updateShape(std::shared_ptr<MayaObject> obj);
+		virtual void updateTransform(std::shared_ptr<MayaObject> obj){}
+		virtual void abortRendering(){}
+		virtual void doInteractiveUpdate(){}
+		virtual void handleUserEvent(int event, MString strData, float floatData, int intData){}
+
+	private:
+		BenchmarkResult& result;
+	};
+
+	// main thread only: translates the current scene with the BenchmarkRenderer, writes the result to resultFile
+	// if it is not empty and returns the json string. An empty string means the benchmark could not be done.
+	MString runTranslationBenchmark(const MString& resultFile, const MString& sceneName);
+}
+
+#endif
@@ -4,11 +4,18 @@
 #include <maya/MFnMesh.h>
 #include <maya/MItMeshPolygon.h>
 #include <maya/MFnMeshData.h>
+#include <maya/MStringArray.h>
+#include <maya/MColorArray.h>
+#include <maya/MTime.h>
+#include <maya/MFnVectorArrayData.h>
 
 #include "mayaObject.h"
 #include "utilities/logging.h"
 #include "utilities/tools.h"
 #include "utilities/attrTools.h"
+#include "utilities/smoothMeshCache.h"
+#include "utilities/meshTools.h"
+#include "utilities/sceneStatistics.h"
 #include "shadingtools/shadingUtils.h"
 #include "world.h"
 #include "renderGlobals.h"
@@ -43,7 +50,7 @@ bool MayaObject::isLight()
 	{
 		if( nodeId == lightIdentifier[lId])
 		{
-			Logging::debug(MString("Found external lighttype: ") + depFn.name());
+			LOG_DEBUG(MString("Found external lighttype: ") + depFn.name());
 			return true;
 		}
 	}
@@ -82,7 +89,7 @@ bool MayaObject::isGeo()
 	{
 		if( nodeId == objectIdentifier[lId])
 		{
-			Logging::debug(MString("Found external geotype: ") + depFn.name());
+			LOG_DEBUG(MString("Found external geotype: ") + depFn.name());
 			return true;
 		}
 	}
@@ -103,7 +110,7 @@ void MayaObject::getShadingGroups()
 
 	if( this->geometryShapeSupported() )
 	{
-		Logging::debug(MString("getShadingGroups::Supported geo ") + this->shortName);
+		LOG_DEBUG(MString("getShadingGroups::Supported geo ") + this->shortName);
 		// only makes sense if we have a geometry shape.
 		if( this->mobject.hasFn(MFn::kMesh) || this->mobject.hasFn(MFn::kNurbsSurface) || this->mobject.hasFn(MFn::kParticle) || this->mobject.hasFn(MFn::kNParticle))
 		{
@@ -124,7 +131,7 @@ bool  MayaObject::isVisiblityAnimated()
 		MPlug vplug = depFn.findPlug("visibility");
 		if(vplug.isConnected())
 		{
-			Logging::debug(MString("Object: ") + vplug.name() + " has animated visibility");
+			LOG_DEBUG(MString("Object: ") + vplug.name() + " has animated visibility");
 			return true;
 		}
 		stat = dp.pop();
@@ -221,7 +228,7 @@ void MayaObject::initialize()
 			for( uint i = 0; i < outputs.length(); i++)
 			{
 				MObject otherSide = outputs[i].node();
-				Logging::debug(MString("matrix is connected to ") + getObjectName(otherSide));
+				LOG_DEBUG(MString("matrix is connected to ") + getObjectName(otherSide));
 				if( otherSide.hasFn(MFn::kInstancer))
 				{
 					Logging::debug(MString("other side is instancer"));
@@ -322,17 +329,69 @@ bool MayaObject::isShapeConnected()
 	return returnValue;
 }
 
-// if we have a mesh and it is a bifrost mesh it may contain velocity vertex data
-bool MayaObject::hasBifrostVelocityChannel()
+// A mesh may contain per vertex velocities, e.g. bifrost meshes have a "bifrostVelocity" color set.
+// Other simulations can deliver the velocities as color set or as vector array attribute with the name from the render globals.
+bool MayaObject::hasVelocityChannel()
 {
+	if (!this->mobject.hasFn(MFn::kMesh))
+		return false;
+	MString velocitySetName = MayaTo::getWorldPtr()->worldRenderGlobalsPtr->velocitySetName;
 	MFnMesh meshFn(this->mobject);
-	int numColorSets = meshFn.numColorSets();
 	MStringArray colorSetNames;
 	meshFn.getColorSetNames(colorSetNames);
 	for (uint i = 0; i < colorSetNames.length(); i++)
 	{
-		if (colorSetNames[i] == "bifrostVelocity")
+		if ((colorSetNames[i] == "bifrostVelocity") || (colorSetNames[i] == velocitySetName))
+			return true;
+	}
+	MStatus stat;
+	MPlug velocityPlug = meshFn.findPlug(velocitySetName, &stat);
+	if (stat)
+	{
+		MFnVectorArrayData vaData(velocityPlug.asMObject(), &stat);
+		if (stat)
+			return true;
+	}
+	return false;
+}
+
+// velocities are returned per vertex in units per second
+bool MayaObject::getVelocities(MVectorArray& velocities)
+{
+	velocities.clear();
+	if (!this->mobject.hasFn(MFn::kMesh))
+		return false;
+
+	MStatus stat;
+	MFnMesh meshFn(this->mobject);
+	int numVertices = meshFn.numVertices();
+	MStringArray setNames;
+	setNames.append(MayaTo::getWorldPtr()->worldRenderGlobalsPtr->velocitySetName);
+	setNames.append("bifrostVelocity");
+
+	for (uint i = 0; i < setNames.length(); i++)
+	{
+		if (!meshFn.hasColorChannels(setNames[i]))
+			continue;
+		MColorArray colors;
+		meshFn.getVertexColors(colors, &setNames[i]);
+		if (colors.length() != numVertices)
+			continue;
+		velocities.setLength(numVertices);
+		for (uint ptId = 0; ptId < colors.length(); ptId++)
+			velocities[ptId] = MVector(colors[ptId].r, colors[ptId].g, colors[ptId].b);
+		return true;
+	}
+
+	MPlug velocityPlug = meshFn.findPlug(setNames[0], &stat);
+	if (stat)
+	{
+		MFnVectorArrayData vaData(velocityPlug.asMObject(), &stat);
+		if (stat && (vaData.length() == numVertices))
+		{
+			velocities = vaData.array();
 			return true;
+		}
 	}
 	return false;
 }
@@ -341,260 +400,62 @@ bool MayaObject::hasBifrostVelocityChannel()
 void MayaObject::addMeshData()
 {
 	MeshData mdata;
+	MayaTo::StatisticsTimer statisticsTimer;
 
-	if (this->hasBifrostVelocityChannel())
+	if (this->geometryMotionblur)
 	{
-		bool doMb = this->motionBlurred;
-		std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;		
-		doMb = doMb && renderGlobals->doMb;
-
-		Logging::debug(MString("Found bifrost velocity data for object: ") + this->shortName);
-		if ((this->meshDataList.size() == 2) || !doMb)
+		// If we have a velocity channel there is no need to save the mesh motion steps. It may have changing
+		// topology what does not work in most renderers, so we save only the very first motion step
+		// and derive all other steps from the velocities.
+		if (this->meshDataList.size() > 0)
 		{
-			Logging::debug("Bifrost mesh already has two motion steps or mb is turned off for it -> skipping");
+			LOG_DEBUG(MString("Velocity mesh ") + this->shortName + " already has its motion steps -> skipping");
 			return;
 		}
+		std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;
+		bool doMb = this->motionBlurred && renderGlobals->doMb;
 
 		this->getMeshData(mdata.points, mdata.normals);
+		MayaTo::getSceneStatistics().addDeformSample(this->fullName, statisticsTimer.getSeconds());
 
-		// if we have a bifrost velocity channel I suppose this is a bifost mesh and there is no need to 
-		// save the mesh motion steps because it has changing topology what does not work in most renderers
-		// so we save only the very first motion step and derive the other steps from velocity channel.
-		// and we simply produce two steps only because everything else would not make sense.
-
-		MFnMesh meshFn(this->mobject);
-		if (meshFn.hasColorChannels("bifrostVelocity"))
+		MVectorArray velocities;
+		if (!doMb || !this->getVelocities(velocities) || (velocities.length() != mdata.points.length()))
 		{
-			MColorArray colors;
-			MString colorSetName = "bifrostVelocity";
-			meshFn.getVertexColors(colors, &colorSetName);
-
-			if (colors.length() == mdata.points.length())
-			{
-				for (uint ptId = 0; ptId < mdata.points.length(); ptId++)
-				{
-					MColor c = colors[ptId];
-					MVector v = MVector(c.r, c.g, c.b);
-					mdata.points[ptId] -= v * 0.5 / 24.0;
-				}
-				this->meshDataList.push_back(mdata);
-				for (uint ptId = 0; ptId < mdata.points.length(); ptId++)
-				{
-					MColor c = colors[ptId];
-					MVector v = MVector(c.r, c.g, c.b);
-					mdata.points[ptId] += v * 0.5 / 24.0;
-				}
-				this->meshDataList.push_back(mdata);
-			}
-		}else{
-			Logging::debug("Bifrost mesh has no velocity data, no motionblur.");
-			if (this->meshDataList.size() == 0)
-				this->meshDataList.push_back(mdata);
+			LOG_DEBUG(MString("Velocity mesh ") + this->shortName + " has no usable velocity data, no motionblur.");
+			this->meshDataList.push_back(mdata);
+			return;
 		}
-	}
-	else{
-		this->getMeshData(mdata.points, mdata.normals);
-		int np = mdata.points.length();
-		this->meshDataList.push_back(mdata);
 
-		for (auto md : this->meshDataList)
+		LOG_DEBUG(MString("Creating motion steps from velocities for object: ") + this->shortName);
+		// step times are in frames, velocities in units per second
+		double framesPerSecond = MTime(1.0, MTime::kSeconds).as(MTime::uiUnit());
+		double sampleTime = renderGlobals->currentMbElement.time;
+		std::vector<float> stepTimes;
+		renderGlobals->getGeoStepTimes(stepTimes);
+		for (auto stepTime : stepTimes)
 		{
-			np = md.points.length();
+			MeshData stepData = mdata;
+			double dt = (stepTime - sampleTime) / framesPerSecond * renderGlobals->velocityScale;
+			for (uint ptId = 0; ptId < stepData.points.length(); ptId++)
+				stepData.points[ptId] += velocities[ptId] * dt;
+			this->meshDataList.push_back(stepData);
 		}
+		return;
 	}
 
+	this->getMeshData(mdata.points, mdata.normals);
+	MayaTo::getSceneStatistics().addDeformSample(this->fullName, statisticsTimer.getSeconds());
+	this->meshDataList.push_back(mdata);
 }
 
 void MayaObject::getMeshData(MPointArray& points, MFloatVectorArray& normals)
 {
-	MStatus stat;
-	MObject meshObject = this->mobject;
-	MMeshSmoothOptions options;
-	MFnMesh tmpMesh(this->mobject);
-	MFnMeshData meshData;
-	MObject dataObject;
-	MObject smoothedObj;
-
-	// create smooth mesh if needed
-	if (tmpMesh.findPlug("displaySmoothMesh").asBool())
-	{
-		stat = tmpMesh.getSmoothMeshDisplayOptions(options);
-		if (stat)
-		{
-			if (!tmpMesh.findPlug("useSmoothPreviewForRender", false, &stat).asBool())
-			{
-				//Logging::debug(MString("useSmoothPreviewForRender turned off"));
-				int smoothLevel = tmpMesh.findPlug("renderSmoothLevel", false, &stat).asInt();
-				options.setDivisions(smoothLevel);
-			}
-			if (options.divisions() > 0)
-			{
-				dataObject = meshData.create();
-				smoothedObj = tmpMesh.generateSmoothMesh(dataObject, &options, &stat);
-				if (stat)
-				{
-					meshObject = smoothedObj;
-				}
-			}
-		}
-	}
-	MFnMesh meshFn(meshObject, &stat);
-	if (!stat)
-	{
-		MString error = stat.errorString();
-		Logging::error(error);
-	}
-	meshFn.getPoints(points);
-	meshFn.getNormals(normals, MSpace::kObject);
+	::getMeshData(this->mobject, points, normals);
 }
 
 void MayaObject::getMeshData(MPointArray& points, MFloatVectorArray& normals, MFloatArray& uArray, MFloatArray& vArray, MIntArray& triPointIndices, MIntArray& triNormalIndices, MIntArray& triUvIndices, MIntArray& triMatIndices)
 {
-
-	MStatus stat;
-	MObject meshObject = this->mobject;
-	MMeshSmoothOptions options;
-	MFnMesh tmpMesh(this->mobject, &stat);
-
-	MFnMeshData meshData;
-	MObject dataObject;
-	MObject smoothedObj;
-
-	// create smooth mesh if needed
-	if (tmpMesh.findPlug("displaySmoothMesh").asBool())
-	{
-		stat = tmpMesh.getSmoothMeshDisplayOptions(options);
-		if (stat)
-		{
-			if (!tmpMesh.findPlug("useSmoothPreviewForRender", false, &stat).asBool())
-			{
-				//Logging::debug(MString("useSmoothPreviewForRender turned off"));
-				int smoothLevel = tmpMesh.findPlug("renderSmoothLevel", false, &stat).asInt();
-				options.setDivisions(smoothLevel);
-			}
-			if (options.divisions() > 0)
-			{
-				dataObject = meshData.create();
-				smoothedObj = tmpMesh.generateSmoothMesh(dataObject, &options, &stat);
-				if (stat)
-				{
-					meshObject = smoothedObj;
-				}
-			}
-		}
-	}
-
-	MFnMesh meshFn(meshObject, &stat);
-	CHECK_MSTATUS(stat);
-	MItMeshPolygon faceIt(meshObject, &stat);
-	CHECK_MSTATUS(stat);
-
-	meshFn.getPoints(points);
-	meshFn.getNormals(normals, MSpace::kObject);
-	meshFn.getUVs(uArray, vArray);
-
-	uint numVertices = points.length();
-	uint numNormals = normals.length();
-	uint numUvs = uArray.length();
-
-	//Logging::debug(MString("numVertices ") + numVertices);
-	//Logging::debug(MString("numNormals ") + numNormals);
-	//Logging::debug(MString("numUvs ") + numUvs);
-
-	// some meshes may have no uv's
-	// to avoid problems I add a default uv coordinate
-	if (numUvs == 0)
-	{
-		Logging::warning(MString("Object has no uv's: ") + this->shortName);
-		uArray.append(0.0);
-		vArray.append(0.0);
-	}
-	for (uint nid = 0; nid < numNormals; nid++)
-	{
-		if (normals[nid].length() < 0.1f)
-			Logging::warning(MString("Malformed normal in ") + this->shortName);
-	}
-	MPointArray triPoints;
-	MIntArray triVtxIds;
-	MIntArray faceVtxIds;
-	MIntArray faceNormalIds;
-
-	for (faceIt.reset(); !faceIt.isDone(); faceIt.next())
-	{
-		int faceId = faceIt.index();
-		int numTris;
-		faceIt.numTriangles(numTris);
-		faceIt.getVertices(faceVtxIds);
-
-		int perFaceShadingGroup = 0;
-		if (this->perFaceAssignments.length() > 0)
-			perFaceShadingGroup = this->perFaceAssignments[faceId];
-		
-		MIntArray faceUVIndices;
-		
-		faceNormalIds.clear();
-		for (uint vtxId = 0; vtxId < faceVtxIds.length(); vtxId++)
-		{
-			faceNormalIds.append(faceIt.normalIndex(vtxId));
-			int uvIndex;
-			if (numUvs == 0)
-			{
-				faceUVIndices.append(0);
-			}
-			else{
-				faceIt.getUVIndex(vtxId, uvIndex);
-				//if (uvIndex > uArray.length())
-				//	Logging::info(MString("-----------------> UV Problem!!! uvIndex ") + uvIndex + " > uvArray in object " + this->shortName);
-				faceUVIndices.append(uvIndex);
-			}
-		}
-
-		for (int triId = 0; triId < numTris; triId++)
-		{
-			int faceRelIds[3];
-			faceIt.getTriangle(triId, triPoints, triVtxIds);
-
-			for (uint triVtxId = 0; triVtxId < 3; triVtxId++)
-			{
-				for (uint faceVtxId = 0; faceVtxId < faceVtxIds.length(); faceVtxId++)
-				{
-					if (faceVtxIds[faceVtxId] == triVtxIds[triVtxId])
-					{
-						faceRelIds[triVtxId] = faceVtxId;
-					}
-				}
-			}
-
-			uint vtxId0 = faceVtxIds[faceRelIds[0]];
-			uint vtxId1 = faceVtxIds[faceRelIds[1]];
-			uint vtxId2 = faceVtxIds[faceRelIds[2]];
-			uint normalId0 = faceNormalIds[faceRelIds[0]];
-			uint normalId1 = faceNormalIds[faceRelIds[1]];
-			uint normalId2 = faceNormalIds[faceRelIds[2]];
-			uint uvId0 = faceUVIndices[faceRelIds[0]];
-			uint uvId1 = faceUVIndices[faceRelIds[1]];
-			uint uvId2 = faceUVIndices[faceRelIds[2]];
-
-			triPointIndices.append(vtxId0);
-			triPointIndices.append(vtxId1);
-			triPointIndices.append(vtxId2);
-
-			triNormalIndices.append(normalId0);
-			triNormalIndices.append(normalId1);
-			triNormalIndices.append(normalId2);
-
-			triUvIndices.append(uvId0);
-			triUvIndices.append(uvId1);
-			triUvIndices.append(uvId2);
-
-			triMatIndices.append(perFaceShadingGroup);
-
-			//Logging::debug(MString("vtxIds ") + vtxId0 + " " + vtxId1 + " " + vtxId2);
-			//Logging::debug(MString("nIds ") + normalId0 + " " + normalId1 + " " + normalId2);
-			//Logging::debug(MString("uvIds ") + uvId0 + " " + uvId1 + " " + uvId2);
-		}
-	}
-
+	::getMeshData(this->mobject, points, normals, uArray, vArray, triPointIndices, triNormalIndices, triUvIndices, triMatIndices, this->perFaceAssignments);
 }
 
 MayaObject::~MayaObject()
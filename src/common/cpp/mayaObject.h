@@ -101,7 +101,8 @@ public:
 	bool isVisiblityAnimated();
 	bool isInstanced();
 	void getShadingGroups();
-	bool hasBifrostVelocityChannel();
+	bool hasVelocityChannel();
+	bool getVelocities(MVectorArray& velocities);
 	void addMeshData(); // add point/normals to the meshDataList for motionsteps
 	void getMeshData(MPointArray& point, MFloatVectorArray& normals);
 	void getMeshData(MPointArray& point, MFloatVectorArray& normals, MFloatArray& u, 
@@ -24,6 +24,7 @@
 #include "utilities/tools.h"
 #include "utilities/attrTools.h"
 #include "utilities/pystring.h"
+#include "utilities/tracing.h"
 #include "shadingtools/shadingUtils.h"
 #include "threads/renderQueueWorker.h"
 #include "rendering/renderer.h"
@@ -98,6 +99,7 @@ bool MayaScene::lightObjectIsInLinkedLightList(std::shared_ptr<MayaObject> light
 
 void MayaScene::getLightLinking()
 {
+	TRACE_ZONE("MayaScene::getLightLinking");
 	//Logging::debug(MString("----------- MayaScene::getLightLinking ---------------"));
 	MLightLinks lightLink;
     bool parseStatus;
@@ -125,7 +127,7 @@ void MayaScene::getLightLinking()
 			}
 			if ((shadingGroups.length() > 1) || (componentElements > 0))
 			{
-				Logging::debug(MString("Object ") + obj->shortName + " has " + components.length() + " component groups and " + shadingGroups.length() + " shading groups.");
+				LOG_DEBUG(MString("Object ") + obj->shortName + " has " + components.length() + " component groups and " + shadingGroups.length() + " shading groups.");
 				for (uint cId = 0; cId < components.length(); cId++)
 				{
 					MDagPathArray tmpLightArray;
@@ -60,6 +60,9 @@ public:
 	float currentFrame;	
 	bool parseSceneHierarchy(MDagPath currentObject, int level, std::shared_ptr<ObjectAttributes> attr, std::shared_ptr<MayaObject> parentObject); // new, parse whole scene as hierarchy and save/analyze objects
 	bool parseScene();
+	void cullInvisibleObjects(); // removes the shapes outside of the camera frustum or render region from the object list
+	bool isRenderCamera(std::shared_ptr<MayaObject> camera); // renderable cameras and the ui camera are rendered
+	std::shared_ptr<MayaObject> getSingleRenderCamera(); // the only camera which will be rendered, nullptr if there are several
 	bool renderingStarted;
 	bool parseInstancerNew(); // parse only particle instancer nodes, its a bit more complex
 
@@ -72,14 +75,17 @@ public:
 	bool updateScene(); // update all necessary objects
 	bool updateScene(MFn::Type updateElement); // update all necessary objects
 	bool updateInstancer(); // update all necessary objects
+	bool updateVelocityMotionBlur(); // mark velocity meshes, returns true if no object needs real deform steps
 	MString getExportPath(MString ext, MString rendererName);
 	MString getFileName();
+	void collectStatistics(); // adds motion samples, instances and file textures to the scene statistics
 	
 	void clearInstancerNodeList();
 	void clearObjList(std::vector<std::shared_ptr<MayaObject>> & objList);
 	void clearObjList(std::vector<std::shared_ptr<MayaObject>> & objList, std::shared_ptr<MayaObject> notThisOne);
 	bool lightObjectIsInLinkedLightList(std::shared_ptr<MayaObject> lightObject, MDagPathArray& linkedLightsArray);
 	void getLightLinking();
+	double lightLinkingTime = 0.0; // seconds of the last getLightLinking() call, parseScene() includes it
 	bool listContainsAllLights(MDagPathArray& linkedLights, MDagPathArray& excludedLights);
 	MDagPath getWorld();
 
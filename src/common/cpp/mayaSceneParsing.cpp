@@ -16,19 +16,28 @@
 #include <maya/MRenderView.h>
 #include <maya/MVectorArray.h>
 #include <maya/MFileIO.h>
+#include <chrono>
+#include <unordered_set>
 #include "world.h"
 #include "mayaObjectFactory.h"
 #include "utilities/logging.h"
 #include "utilities/tools.h"
+#include "utilities/attrTools.h"
 #include "utilities/pystring.h"
+#include "utilities/tracing.h"
+#include "utilities/frustum.h"
+#include "threads/cancelToken.h"
 #include "rendering/renderer.h"
 
 std::vector<std::shared_ptr<MayaObject>>  origObjects;
 
 bool MayaScene::parseSceneHierarchy(MDagPath currentPath, int level, std::shared_ptr<ObjectAttributes> parentAttributes, std::shared_ptr<MayaObject> parentObject)
 {
-	Logging::debugs(MString("parse: ") + currentPath.fullPathName(), level);
+	LOG_DEBUGS(MString("parse: ") + currentPath.fullPathName(), level);
 	
+	if (MayaTo::isRenderCancelled())
+		return false;
+
 	// filter the new hypershade objects away
 	if (pystring::find(currentPath.fullPathName().asChar(), "shaderBall") > -1)
 		return true;
@@ -58,7 +67,7 @@ bool MayaScene::parseSceneHierarchy(MDagPath currentPath, int level, std::shared
 			MFnDagNode onode(origObjects[iId]->mobject);
 			if (onode.object() == node.object())
 			{
-				Logging::debugs(MString("Orig Node found:") + onode.fullPathName(), level);
+				LOG_DEBUGS(MString("Orig Node found:") + onode.fullPathName(), level);
 				mo->origObject = origObjects[iId];
 				break;
 			}
@@ -72,11 +81,12 @@ bool MayaScene::parseSceneHierarchy(MDagPath currentPath, int level, std::shared
 		MStatus stat = childPath.push(currentPath.child(chId));
 		if (!stat)
 		{
-			Logging::debug(MString("Child path problem: parent: ") + currentPath.fullPathName() + " child id " + chId + " type " + currentPath.child(chId).apiTypeStr());
+			LOG_DEBUG(MString("Child path problem: parent: ") + currentPath.fullPathName() + " child id " + chId + " type " + currentPath.child(chId).apiTypeStr());
 			continue;
 		}
 		MString childName = childPath.fullPathName();
-		parseSceneHierarchy(childPath, level + 1, currentAttributes, mo);
+		if (!parseSceneHierarchy(childPath, level + 1, currentAttributes, mo))
+			return false;
 	}
 
 	return true;
@@ -84,6 +94,7 @@ bool MayaScene::parseSceneHierarchy(MDagPath currentPath, int level, std::shared
 
 bool MayaScene::parseScene()
 {
+	TRACE_ZONE("MayaScene::parseScene");
 	origObjects.clear();
 
 	clearObjList(this->objectList);
@@ -94,7 +105,11 @@ bool MayaScene::parseScene()
 	if (parseSceneHierarchy(world, 0, nullptr, nullptr))
 	{
 		this->parseInstancerNew();
+		if (MayaTo::isRenderCancelled())
+			return false;
+		std::chrono::steady_clock::time_point lightLinkingStart = std::chrono::steady_clock::now();
 		this->getLightLinking();
+		this->lightLinkingTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - lightLinkingStart).count();
 		if (this->uiCamera.isValid() && (MGlobal::mayaState() != MGlobal::kBatch))
 		{
 			std::shared_ptr<MayaObject> cam = nullptr;
@@ -110,6 +125,7 @@ bool MayaScene::parseScene()
 			}
 			clearObjList(this->camList, cam);
 		}
+		this->cullInvisibleObjects();
 		this->good = true;
 
 		return true;
@@ -117,8 +133,160 @@ bool MayaScene::parseScene()
 	return false;
 }
 
+// a deformed shape or a shape below an animated transform can move into the region during the shutter time
+static bool canMoveDuringShutter(std::shared_ptr<MayaObject> obj)
+{
+	if (obj->isShapeConnected())
+		return true;
+	for (std::shared_ptr<MayaObject> parent = obj->parent; parent != nullptr; parent = parent->parent)
+	{
+		if (parent->animated)
+			return true;
+	}
+	return false;
+}
+
+// a mtNeverCull attribute on the shape or one of its parents keeps the object, e.g. a large ground plane whose
+// bounding box is far outside of the image but which receives the shadows
+static bool isNeverCulled(std::shared_ptr<MayaObject> obj)
+{
+	for (std::shared_ptr<MayaObject> node = obj; node != nullptr; node = node->parent)
+	{
+		MFnDependencyNode depFn(node->mobject);
+		if (getBoolAttr("mtNeverCull", depFn, false))
+			return true;
+	}
+	return false;
+}
+
+bool MayaScene::isRenderCamera(std::shared_ptr<MayaObject> camera)
+{
+	return isCameraRenderable(camera->mobject) || (camera->dagPath == this->uiCamera);
+}
+
+// In a ui rendering the camera list only contains the ui camera, in batch it still contains all cameras of the scene,
+// the not renderable ones like the startup cameras are skipped later in RenderProcess::doPrepareFrame().
+std::shared_ptr<MayaObject> MayaScene::getSingleRenderCamera()
+{
+	std::shared_ptr<MayaObject> renderCamera = nullptr;
+	for (auto camera : this->camList)
+	{
+		if (!this->isRenderCamera(camera))
+			continue;
+		if (renderCamera != nullptr)
+			return nullptr;
+		renderCamera = camera;
+	}
+	return renderCamera;
+}
+
+// Only the shapes which can be seen by the render camera are translated. With region culling the frustum is limited
+// to the render region to check a detail of a heavy scene, with frustum culling it covers the whole image, e.g. to skip
+// the parts of a large set behind the camera. Everything outside of the widened frustum and, for frustum culling,
+// everything smaller than minScreenSize is removed from the object list, so neither its geometry is read nor it is
+// sent to the renderer. IPR is not culled, it keeps the whole scene to move the camera or change the region interactively.
+void MayaScene::cullInvisibleObjects()
+{
+	std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;
+	bool useRegion = renderGlobals->regionCulling && renderGlobals->getUseRenderRegion();
+	if (!useRegion && !renderGlobals->frustumCulling)
+		return;
+	if (MayaTo::getWorldPtr()->renderType == MayaTo::MayaToWorld::WorldRenderType::IPRRENDER)
+		return;
+	std::shared_ptr<MayaObject> camera = this->getSingleRenderCamera();
+	if (camera == nullptr)
+	{
+		Logging::warning("Culling needs exactly one renderable camera, all objects are translated.");
+		return;
+	}
+	if (renderGlobals->doMb && canMoveDuringShutter(camera))
+	{
+		Logging::warning(MString("Camera ") + camera->fullName + " can move during the shutter time, all objects are translated.");
+		return;
+	}
+
+	TRACE_ZONE("MayaScene::cullInvisibleObjects");
+	// the scene is parsed before the time is set to the new frame, the culling needs the positions of this frame
+	if (renderGlobals->doAnimation)
+		MGlobal::viewFrame(renderGlobals->getFrameNumber());
+
+	int width, height;
+	renderGlobals->getWidthHeight(width, height);
+	MayaTo::Frustum frustum;
+	bool frustumCreated;
+	if (useRegion)
+	{
+		int left, bottom, right, top;
+		renderGlobals->getRenderRegion(left, bottom, right, top);
+		frustumCreated = frustum.create(camera->dagPath, width, height, left, bottom, right, top);
+		frustum.expand(renderGlobals->regionCullingMargin);
+	}
+	else{
+		frustumCreated = frustum.create(camera->dagPath, width, height);
+		frustum.expand(renderGlobals->frustumCullingMargin);
+	}
+	if (!frustumCreated)
+	{
+		Logging::warning(MString("Unable to get the frustum of camera ") + camera->fullName + ", all objects are translated.");
+		return;
+	}
+	double minScreenSize = renderGlobals->frustumCulling ? renderGlobals->minScreenSize : 0.0;
+
+	std::unordered_set<MayaObject *> culledObjects;
+	size_t numSmallObjects = 0;
+	for (auto obj : this->objectList)
+	{
+		if (!obj->mobject.hasFn(MFn::kShape))
+			continue;
+		if (renderGlobals->doMb && obj->motionBlurred && canMoveDuringShutter(obj))
+			continue;
+		if (isNeverCulled(obj))
+			continue;
+		MBoundingBox box = MayaTo::getWorldBoundingBox(obj->dagPath);
+		if (!frustum.intersects(box, renderGlobals->cullingRayMargin))
+		{
+			culledObjects.insert(obj.get());
+		}
+		else if ((minScreenSize > 0.0) && (frustum.getScreenSize(box) < minScreenSize))
+		{
+			culledObjects.insert(obj.get());
+			numSmallObjects++;
+		}
+	}
+	// instances use the geometry of their original object
+	for (auto obj : this->objectList)
+	{
+		if ((obj->origObject != nullptr) && (culledObjects.find(obj.get()) == culledObjects.end()))
+			culledObjects.erase(obj->origObject.get());
+	}
+	// particle instances are not culled, their source objects are usually placed somewhere outside of the image
+	for (auto obj : this->instancerNodeElements)
+	{
+		if (obj->origObject != nullptr)
+			culledObjects.erase(obj->origObject.get());
+	}
+	if (culledObjects.empty())
+		return;
+
+	size_t numShapes = 0;
+	std::vector<std::shared_ptr<MayaObject>> visibleObjects;
+	for (auto obj : this->objectList)
+	{
+		if (obj->mobject.hasFn(MFn::kShape))
+			numShapes++;
+		if (culledObjects.find(obj.get()) == culledObjects.end())
+			visibleObjects.push_back(obj);
+	}
+	this->objectList = visibleObjects;
+	MString message = MString("Culling: ") + (int)culledObjects.size() + " of " + (int)numShapes + " shapes are not translated";
+	if (numSmallObjects > 0)
+		message += MString(", ") + (int)numSmallObjects + " of them are smaller than " + renderGlobals->minScreenSize + " pixels";
+	Logging::info(message + ".");
+}
+
 bool MayaScene::updateScene(MFn::Type updateElement)
 {
+	TRACE_ZONE(updateElement == MFn::kShape ? "MayaScene::updateShapes" : "MayaScene::updateTransforms");
 
 	Logging::debug(MString("MayaScene::updateSceneNew."));
 
@@ -129,15 +297,19 @@ bool MayaScene::updateScene(MFn::Type updateElement)
 		if (!obj->mobject.hasFn(updateElement))
 			continue;
 
+		if (MayaTo::isRenderCancelled())
+			return false;
+
+		TRACE_ZONE_DETAIL("MayaObject::update", obj->shortName);
 		obj->updateObject();
-		Logging::debug(MString("updateObj ") + objId + ": " + obj->dagPath.fullPathName());
+		LOG_TRACE(MString("updateObj ") + objId + ": " + obj->dagPath.fullPathName());
 
 		// this part is only used if motionblur is turned on, else we have no MbElement::None
 		if (!obj->motionBlurred)
 		{
 			if (MayaTo::getWorldPtr()->worldRenderGlobalsPtr->currentMbElement.elementType == MbElement::None)
 			{
-				Logging::debug(MString("found non mb element type. Updating non mb objects.") + objId + ": " + obj->dagPath.fullPathName());
+				LOG_DEBUG(MString("found non mb element type. Updating non mb objects.") + objId + ": " + obj->dagPath.fullPathName());
 				if (updateElement == MFn::kShape)
 					MayaTo::getWorldPtr()->worldRendererPtr->updateShape(obj);
 				if (updateElement == MFn::kTransform)
@@ -175,8 +347,9 @@ bool MayaScene::updateScene(MFn::Type updateElement)
 
 bool MayaScene::updateScene()
 {
-	updateScene(MFn::kShape);
-	updateScene(MFn::kTransform);
+	TRACE_ZONE("MayaScene::updateScene");
+	if (!updateScene(MFn::kShape) || !updateScene(MFn::kTransform))
+		return false;
 
 	for (size_t camId = 0; camId < this->camList.size(); camId++)
 	{
@@ -226,6 +399,39 @@ bool MayaScene::updateScene()
 	return true;
 }
 
+// Meshes with vertex velocities get their deformation motion steps from the velocities (see MayaObject::addMeshData()),
+// so there is no need to evaluate them at every deform step. If there is no other deforming mesh, the deform only
+// steps can be removed completely what saves the viewFrame() calls.
+bool MayaScene::updateVelocityMotionBlur()
+{
+	std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;
+	bool foundVelocityMesh = false;
+	bool foundDeformingShape = false;
+
+	for (auto obj : this->objectList)
+	{
+		if (!obj->mobject.hasFn(MFn::kShape))
+			continue;
+		// deforming nurbs, curves or particles have no velocity channel and always need the deform steps
+		if (!obj->mobject.hasFn(MFn::kMesh))
+		{
+			if (obj->motionBlurred && obj->isShapeConnected())
+				foundDeformingShape = true;
+			continue;
+		}
+		obj->geometryMotionblur = renderGlobals->useVelocityMb && obj->hasVelocityChannel();
+		if (obj->geometryMotionblur)
+		{
+			LOG_DEBUG(MString("Using velocity motionblur for ") + obj->shortName);
+			foundVelocityMesh = true;
+			continue;
+		}
+		if (obj->motionBlurred && obj->isShapeConnected())
+			foundDeformingShape = true;
+	}
+	return renderGlobals->doMb && foundVelocityMesh && !foundDeformingShape;
+}
+
 void MayaScene::clearInstancerNodeList()
 {
 	size_t numElements = this->instancerNodeElements.size();
@@ -234,6 +440,7 @@ void MayaScene::clearInstancerNodeList()
 
 bool MayaScene::updateInstancer()
 {
+	TRACE_ZONE("MayaScene::updateInstancer");
 	Logging::debug("update instancer.");
 
 	// updates only required for a transform step
@@ -256,7 +463,7 @@ bool MayaScene::updateInstancer()
 		MMatrix matrix;
 		instFn.instancesForParticle(obj->instancerParticleId, dagPathArray, matrix);
 		for (uint k = 0; k < dagPathArray.length(); k++)
-			Logging::debug(MString("Particle mobj id: ") + i + "particle id: " + obj->instancerParticleId + " path id " + k + " - " + dagPathArray[k].fullPathName());
+			LOG_TRACE(MString("Particle mobj id: ") + i + "particle id: " + obj->instancerParticleId + " path id " + k + " - " + dagPathArray[k].fullPathName());
 		if (MayaTo::getWorldPtr()->worldRenderGlobalsPtr->isMbStartStep())
 			obj->transformMatrices.clear();
 
@@ -274,6 +481,7 @@ std::vector<std::shared_ptr<MayaObject>>  InstDoneList;
 // of a particle
 bool MayaScene::parseInstancerNew()
 {
+	TRACE_ZONE("MayaScene::parseInstancer");
 	MStatus stat;
 	bool result = true;
 	Logging::debug(MString("parseInstancerNew"));
@@ -291,7 +499,7 @@ bool MayaScene::parseInstancerNew()
 		MString path = instPath.fullPathName();
 		MFnInstancer instFn(instPath);
 		int numParticles = instFn.particleCount();
-		Logging::debug(MString("Detected instancer. instPath: ") + path + " it has " + numParticles + " particle instances");
+		LOG_DEBUG(MString("Detected instancer. instPath: ") + path + " it has " + numParticles + " particle instances");
 		MDagPathArray allPaths;
 		MMatrixArray allMatrices;
 		MIntArray pathIndices;
@@ -304,7 +512,7 @@ bool MayaScene::parseInstancerNew()
 		{
 			if (nodeList[0].hasFn(MFn::kParticle))
 			{
-				Logging::debug(MString("Found a particle system called ") + getObjectName(nodeList[0]));
+				LOG_DEBUG(MString("Found a particle system called ") + getObjectName(nodeList[0]));
 				MFnParticleSystem pSystem(nodeList[0], &stat);
 				if (stat)
 				{
@@ -326,6 +534,10 @@ bool MayaScene::parseInstancerNew()
 
 		for (int p = 0; p < numParticles; p++)
 		{
+			// big particle instancers can take longer than the rest of the scene
+			if (MayaTo::isRenderCancelled())
+				return false;
+
 			MMatrix particleMatrix = allMatrices[p];
 
 			//  the number of paths instanced under a particle is computed by
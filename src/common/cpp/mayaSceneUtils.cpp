@@ -5,10 +5,13 @@
 #include <maya/MFnDagNode.h>
 #include <maya/MItDag.h>
 #include <maya/MFnDependencyNode.h>
+#include <maya/MItDependencyNodes.h>
+#include <sys/stat.h>
 #include "utilities/pystring.h"
 #include "utilities/logging.h"
 #include "utilities/attrTools.h"
 #include "utilities/tools.h"
+#include "utilities/sceneStatistics.h"
 #include "world.h"
 
 
@@ -118,7 +121,7 @@ bool MayaScene::isGeo(MObject obj)
 	{
 		if (nodeId == this->objectIdentifier[lId])
 		{
-			Logging::debug(MString("Found external objtype: ") + depFn.name());
+			LOG_DEBUG(MString("Found external objtype: ") + depFn.name());
 			return true;
 		}
 	}
@@ -137,7 +140,7 @@ bool MayaScene::isLight(MObject obj)
 	{
 		if (nodeId == this->lightIdentifier[lId])
 		{
-			Logging::debug(MString("Found external lighttype: ") + depFn.name());
+			LOG_DEBUG(MString("Found external lighttype: ") + depFn.name());
 			return true;
 		}
 	}
@@ -188,6 +191,38 @@ MString MayaScene::getFileName()
 	return MString(currentFile.c_str());
 }
 
+void MayaScene::collectStatistics()
+{
+	MayaTo::SceneStatistics& statistics = MayaTo::getSceneStatistics();
+	if (!statistics.isEnabled())
+		return;
+
+	for (auto obj : this->objectList)
+	{
+		if ((obj->instanceNumber > 0) && (obj->origObject != nullptr))
+			statistics.addInstance(obj->origObject->fullName);
+		else if (obj->mobject.hasFn(MFn::kShape))
+			statistics.setTransformSamples(obj->fullName, (int)obj->transformMatrices.size());
+	}
+	for (auto obj : this->instancerNodeElements)
+	{
+		if (obj->origObject != nullptr)
+			statistics.addInstance(obj->origObject->fullName);
+	}
+
+	// the resolution is the one maya has read, the renderer can load a different mipmap level
+	for (MItDependencyNodes it(MFn::kFileTexture); !it.isDone(); it.next())
+	{
+		MFnDependencyNode fileFn(it.thisNode());
+		MString fileName = getStringAttr("fileTextureName", fileFn, "");
+		if (fileName.length() == 0)
+			continue;
+		struct stat fileStat;
+		long long bytes = (stat(fileName.asChar(), &fileStat) == 0) ? (long long)fileStat.st_size : 0;
+		statistics.setTexture(fileName, bytes, (int)getFloatAttr("outSizeX", fileFn, 0.0f), (int)getFloatAttr("outSizeY", fileFn, 0.0f));
+	}
+}
+
 bool MayaScene::canDoIPR()
 {
 	return this->cando_ipr;
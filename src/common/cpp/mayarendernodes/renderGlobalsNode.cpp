@@ -6,6 +6,7 @@
 
 #include <maya/MGlobal.h>
 #include <maya/MFnPluginData.h>
+#include <maya/MFnStringData.h>
 #include <maya/MPlug.h>
 #include "renderGlobalsNode.h"
 
@@ -22,6 +23,9 @@ MObject MayaRenderGlobalsNode::samplesY;
 MObject MayaRenderGlobalsNode::doMotionBlur;
 MObject MayaRenderGlobalsNode::motionBlurRange;
 MObject MayaRenderGlobalsNode::motionBlurType;
+MObject MayaRenderGlobalsNode::useVelocityMotionBlur;
+MObject MayaRenderGlobalsNode::velocitySetName;
+MObject MayaRenderGlobalsNode::velocityScale;
 
 MObject MayaRenderGlobalsNode::doDof;
 MObject MayaRenderGlobalsNode::xftimesamples;
@@ -54,6 +58,22 @@ MObject MayaRenderGlobalsNode::exportSceneFileName;
 MObject MayaRenderGlobalsNode::sceneScale;
 MObject MayaRenderGlobalsNode::optimizedTexturePath;
 MObject MayaRenderGlobalsNode::useOptimizedTextures;
+MObject MayaRenderGlobalsNode::traceTranslation;
+MObject MayaRenderGlobalsNode::traceFilePath;
+MObject MayaRenderGlobalsNode::sceneStatistics;
+MObject MayaRenderGlobalsNode::statisticsFilePath;
+MObject MayaRenderGlobalsNode::pipelineSequence;
+MObject MayaRenderGlobalsNode::framesInFlight;
+MObject MayaRenderGlobalsNode::pipelineFilePath;
+MObject MayaRenderGlobalsNode::checkpoints;
+MObject MayaRenderGlobalsNode::checkpointInterval;
+MObject MayaRenderGlobalsNode::checkpointFilePath;
+MObject MayaRenderGlobalsNode::regionCulling;
+MObject MayaRenderGlobalsNode::regionCullingMargin;
+MObject MayaRenderGlobalsNode::frustumCulling;
+MObject MayaRenderGlobalsNode::frustumCullingMargin;
+MObject MayaRenderGlobalsNode::cullingRayMargin;
+MObject MayaRenderGlobalsNode::minScreenSize;
 MObject MayaRenderGlobalsNode::imageFormat;
 MObject MayaRenderGlobalsNode::filtertype;
 MObject MayaRenderGlobalsNode::exrDataTypeHalf;
@@ -143,6 +163,14 @@ MStatus	MayaRenderGlobalsNode::initialize()
 	stat = eAttr.addField( "FrameStart", 1 );
 	stat = eAttr.addField( "FrameEnd", 2 );
 	CHECK_MSTATUS(addAttribute( motionBlurType ));
+
+	useVelocityMotionBlur = nAttr.create("useVelocityMotionBlur", "useVelocityMotionBlur", MFnNumericData::kBoolean, true);
+	CHECK_MSTATUS(addAttribute( useVelocityMotionBlur ));
+	MFnStringData fnStringData;
+	velocitySetName = tAttr.create("velocitySetName", "velocitySetName", MFnData::kString, fnStringData.create("velocity"));
+	CHECK_MSTATUS(addAttribute( velocitySetName ));
+	velocityScale = nAttr.create("velocityScale", "velocityScale", MFnNumericData::kFloat, 1.0);
+	CHECK_MSTATUS(addAttribute( velocityScale ));
 	
 	doDof = nAttr.create("doDof", "doDof", MFnNumericData::kBoolean, false);
 	CHECK_MSTATUS(addAttribute( doDof ));
@@ -208,6 +236,82 @@ MStatus	MayaRenderGlobalsNode::initialize()
 	useOptimizedTextures = nAttr.create("useOptimizedTextures", "useOptimizedTextures", MFnNumericData::kBoolean, false);
 	CHECK_MSTATUS(addAttribute( useOptimizedTextures ));
 
+	// writes a chrome trace of the translation for every frame
+	traceTranslation = nAttr.create("traceTranslation", "traceTranslation", MFnNumericData::kBoolean, false);
+	CHECK_MSTATUS(addAttribute( traceTranslation ));
+
+	// directory of the trace files, default is basePath/trace
+	traceFilePath = tAttr.create("traceFilePath", "traceFilePath",  MFnNumericData::kString);
+	tAttr.setUsedAsFilename(true);
+	CHECK_MSTATUS(addAttribute( traceFilePath ));
+
+	// writes the export costs of all objects, materials and textures for every frame
+	sceneStatistics = nAttr.create("sceneStatistics", "sceneStatistics", MFnNumericData::kBoolean, false);
+	CHECK_MSTATUS(addAttribute( sceneStatistics ));
+
+	// directory of the statistics reports, default is basePath/statistics
+	statisticsFilePath = tAttr.create("statisticsFilePath", "statisticsFilePath",  MFnNumericData::kString);
+	tAttr.setUsedAsFilename(true);
+	CHECK_MSTATUS(addAttribute( statisticsFilePath ));
+
+	// batch sequences: the frames are exported as scene files and rendered by the standalone renderer while the next frame is exported
+	pipelineSequence = nAttr.create("pipelineSequence", "pipelineSequence", MFnNumericData::kBoolean, false);
+	CHECK_MSTATUS(addAttribute( pipelineSequence ));
+
+	// number of standalone renderings running at the same time
+	framesInFlight = nAttr.create("framesInFlight", "framesInFlight", MFnNumericData::kInt, 1);
+	nAttr.setMin(1);
+	CHECK_MSTATUS(addAttribute( framesInFlight ));
+
+	// directory of the exported scene files, default is basePath/sceneFiles
+	pipelineFilePath = tAttr.create("pipelineFilePath", "pipelineFilePath",  MFnNumericData::kString);
+	tAttr.setUsedAsFilename(true);
+	CHECK_MSTATUS(addAttribute( pipelineFilePath ));
+
+	// progressive renderers save their samples regularly and a restarted rendering continues from the last checkpoint
+	checkpoints = nAttr.create("checkpoints", "checkpoints", MFnNumericData::kBoolean, false);
+	CHECK_MSTATUS(addAttribute( checkpoints ));
+
+	// minutes between two checkpoints
+	checkpointInterval = nAttr.create("checkpointInterval", "checkpointInterval", MFnNumericData::kFloat, 15.0f);
+	nAttr.setMin(1.0f);
+	CHECK_MSTATUS(addAttribute( checkpointInterval ));
+
+	// directory of the checkpoint files, default is basePath/checkpoints
+	checkpointFilePath = tAttr.create("checkpointFilePath", "checkpointFilePath",  MFnNumericData::kString);
+	tAttr.setUsedAsFilename(true);
+	CHECK_MSTATUS(addAttribute( checkpointFilePath ));
+
+	// region renderings translate only the objects which can be seen in the render region. Shadows and reflections of
+	// the skipped objects are missing, so the region should only be used to check details of directly visible objects.
+	regionCulling = nAttr.create("regionCulling", "regionCulling", MFnNumericData::kBoolean, false);
+	CHECK_MSTATUS(addAttribute( regionCulling ));
+
+	// the region is widened on every side by this part of the image size before objects are culled
+	regionCullingMargin = nAttr.create("regionCullingMargin", "regionCullingMargin", MFnNumericData::kFloat, 0.1f);
+	nAttr.setMin(0.0f);
+	CHECK_MSTATUS(addAttribute( regionCullingMargin ));
+
+	// objects outside of the camera frustum are not translated, e.g. the parts of a large set behind the camera.
+	// Objects with a mtNeverCull attribute which is turned on are always translated.
+	frustumCulling = nAttr.create("frustumCulling", "frustumCulling", MFnNumericData::kBoolean, false);
+	CHECK_MSTATUS(addAttribute( frustumCulling ));
+
+	// the frustum is widened on every side by this part of the image size
+	frustumCullingMargin = nAttr.create("frustumCullingMargin", "frustumCullingMargin", MFnNumericData::kFloat, 0.1f);
+	nAttr.setMin(0.0f);
+	CHECK_MSTATUS(addAttribute( frustumCullingMargin ));
+
+	// objects closer to the frustum or render region than this world space distance are kept for shadows and reflections
+	cullingRayMargin = nAttr.create("cullingRayMargin", "cullingRayMargin", MFnNumericData::kFloat, 0.0f);
+	nAttr.setMin(0.0f);
+	CHECK_MSTATUS(addAttribute( cullingRayMargin ));
+
+	// frustum culling removes objects which are smaller than this number of pixels in the image, 0 keeps all
+	minScreenSize = nAttr.create("minScreenSize", "minScreenSize", MFnNumericData::kFloat, 0.0f);
+	nAttr.setMin(0.0f);
+	CHECK_MSTATUS(addAttribute( minScreenSize ));
+
 	exrDataTypeHalf = nAttr.create("exrDataTypeHalf", "exrDataTypeHalf", MFnNumericData::kBoolean, false);
 	CHECK_MSTATUS(addAttribute(exrDataTypeHalf));
 
@@ -39,6 +39,10 @@ private:
 	static	  MObject geotimesamples;
 	static	  MObject motionBlurRange;
 	static	  MObject motionBlurType;
+	// velocity based motionblur for meshes with a velocity color set or vector array attribute
+	static	  MObject useVelocityMotionBlur;
+	static	  MObject velocitySetName;
+	static	  MObject velocityScale;
 	// 
 	static    MObject threads;
 	static	  MObject translatorVerbosity;
@@ -76,6 +80,22 @@ private:
 	static	  MObject imageFormat;
 	static	  MObject optimizedTexturePath;
 	static	  MObject useOptimizedTextures;
+	static	  MObject traceTranslation;
+	static	  MObject traceFilePath;
+	static	  MObject sceneStatistics;
+	static	  MObject statisticsFilePath;
+	static	  MObject pipelineSequence;
+	static	  MObject framesInFlight;
+	static	  MObject pipelineFilePath;
+	static	  MObject checkpoints;
+	static	  MObject checkpointInterval;
+	static	  MObject checkpointFilePath;
+	static	  MObject regionCulling;
+	static	  MObject regionCullingMargin;
+	static	  MObject frustumCulling;
+	static	  MObject frustumCullingMargin;
+	static	  MObject cullingRayMargin;
+	static	  MObject minScreenSize;
 
 public:
 	int		 defaultEnumFilterType;
@@ -1,20 +1,92 @@
 #include "memoryInfo.h"
+#include "utilities/logging.h"
+#include <atomic>
+#include <mutex>
+#include <sstream>
 
-
+#ifdef _WIN32
 #include "windows.h"
 #include "psapi.h"
+#else
+#include <unistd.h>
+#include <stdio.h>
+#include <string.h>
+#endif
+
+static const size_t MB = 1024 * 1024;
+
+static std::atomic<size_t> startUsage(0);
+static std::atomic<size_t> peakUsage(0);
+static std::atomic<size_t> phasePeakUsage(0);
+
+static std::mutex phaseMutex;
+static MemoryPhase currentPhase = MEMPHASE_NONE;
+static MemoryPhaseStats phaseStats[MEMPHASE_COUNT];
+
+static void updateMax(std::atomic<size_t>& value, size_t usage)
+{
+	size_t old = value.load();
+	while ((usage > old) && !value.compare_exchange_weak(old, usage)){}
+}
 
-static size_t peakUsage = 0;
+#ifndef _WIN32
+// reads all "<key>: <value> kB" lines of a /proc file, returns false if the file does not exist
+static bool readProcKbValues(const char *fileName, const char **keys, size_t *values, int numKeys)
+{
+	FILE *f = fopen(fileName, "r");
+	if (f == nullptr)
+		return false;
+	char line[256];
+	while (fgets(line, sizeof(line), f) != nullptr)
+	{
+		for (int k = 0; k < numKeys; k++)
+		{
+			size_t keyLen = strlen(keys[k]);
+			if ((strncmp(line, keys[k], keyLen) == 0) && (line[keyLen] == ':'))
+			{
+				unsigned long long kb = 0;
+				if (sscanf(line + keyLen + 1, "%llu", &kb) == 1)
+					values[k] = (size_t)(kb / 1024);
+			}
+		}
+	}
+	fclose(f);
+	return true;
+}
+
+static bool readStatm(size_t& residentBytes, size_t& virtualBytes)
+{
+	FILE *f = fopen("/proc/self/statm", "r");
+	if (f == nullptr)
+		return false;
+	unsigned long long sizePages = 0, residentPages = 0;
+	int num = fscanf(f, "%llu %llu", &sizePages, &residentPages);
+	fclose(f);
+	if (num != 2)
+		return false;
+	size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+	residentBytes = (size_t)residentPages * pageSize;
+	virtualBytes = (size_t)sizePages * pageSize;
+	return true;
+}
+#endif
 
 size_t getCurrentUsage()
 {
+	size_t usedMB = 0;
+#ifdef _WIN32
 	PROCESS_MEMORY_COUNTERS pmc;
 	GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc));
-	SIZE_T usedMB = pmc.WorkingSetSize / (1024 * 1024);
-	if( startUsage == 0)
-		startUsage = usedMB;
-	if( usedMB > peakUsage)
-		peakUsage = usedMB;
+	usedMB = pmc.WorkingSetSize / MB;
+#else
+	size_t residentBytes = 0, virtualBytes = 0;
+	if (readStatm(residentBytes, virtualBytes))
+		usedMB = residentBytes / MB;
+#endif
+	size_t noStart = 0;
+	startUsage.compare_exchange_strong(noStart, usedMB);
+	updateMax(peakUsage, usedMB);
+	updateMax(phasePeakUsage, usedMB);
 	return (usedMB);
 }
 
@@ -23,3 +95,140 @@ size_t getPeakUsage()
 	return (peakUsage);
 }
 
+size_t getStartUsage()
+{
+	return (startUsage);
+}
+
+bool getMemoryUsageDetail(MemoryUsageDetail& detail)
+{
+	detail = MemoryUsageDetail();
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS_EX pmc;
+	if (!GetProcessMemoryInfo(GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS *)&pmc, sizeof(pmc)))
+		return false;
+	detail.resident = pmc.WorkingSetSize / MB;
+	detail.virtualSize = pmc.PrivateUsage / MB;
+	detail.proportional = detail.resident;
+	detail.swap = pmc.PagefileUsage > pmc.WorkingSetSize ? (pmc.PagefileUsage - pmc.WorkingSetSize) / MB : 0;
+	detail.osPeak = pmc.PeakWorkingSetSize / MB;
+#else
+	size_t residentBytes = 0, virtualBytes = 0;
+	if (!readStatm(residentBytes, virtualBytes))
+		return false;
+	detail.resident = residentBytes / MB;
+	detail.virtualSize = virtualBytes / MB;
+	detail.proportional = detail.resident;
+
+	const char *statusKeys[] = { "VmHWM" };
+	size_t statusValues[] = { detail.resident };
+	readProcKbValues("/proc/self/status", statusKeys, statusValues, 1);
+	detail.osPeak = statusValues[0];
+
+	// smaps_rollup exists since kernel 4.14
+	const char *rollupKeys[] = { "Pss", "Swap" };
+	size_t rollupValues[] = { detail.resident, 0 };
+	readProcKbValues("/proc/self/smaps_rollup", rollupKeys, rollupValues, 2);
+	detail.proportional = rollupValues[0];
+	detail.swap = rollupValues[1];
+#endif
+	updateMax(peakUsage, detail.resident);
+	return true;
+}
+
+const char *getMemoryPhaseName(MemoryPhase phase)
+{
+	switch (phase)
+	{
+	case MEMPHASE_PARSE:
+		return "parse";
+	case MEMPHASE_TRANSLATE:
+		return "translate";
+	case MEMPHASE_RENDER:
+		return "render";
+	case MEMPHASE_WRITE:
+		return "write";
+	default:
+		return "none";
+	}
+}
+
+void setMemoryPhase(MemoryPhase phase)
+{
+	size_t usage = getCurrentUsage();
+	MemoryPhase lastPhase;
+	MemoryPhaseStats lastStats;
+	{
+		std::lock_guard<std::mutex> lock(phaseMutex);
+		if (phase == currentPhase)
+			return;
+		lastPhase = currentPhase;
+		if (lastPhase != MEMPHASE_NONE)
+		{
+			MemoryPhaseStats& stats = phaseStats[lastPhase];
+			stats.endUsage = usage;
+			if (phasePeakUsage > stats.peakUsage)
+				stats.peakUsage = phasePeakUsage;
+			lastStats = stats;
+		}
+		currentPhase = phase;
+		if (phase != MEMPHASE_NONE)
+		{
+			MemoryPhaseStats& stats = phaseStats[phase];
+			// a phase can be entered several times per frame, e.g. translate and render in ipr
+			if (!stats.used)
+				stats.startUsage = usage;
+			stats.used = true;
+		}
+		phasePeakUsage = usage;
+	}
+	// if the process is killed because it ran out of memory, the last of these lines tells us in which phase it happened
+	if (lastPhase != MEMPHASE_NONE)
+		Logging::info(MString("Memory phase ") + getMemoryPhaseName(lastPhase) + " done: " + (int)lastStats.endUsage + "MB peak: " + (int)lastStats.peakUsage + "MB delta: " + (int)lastStats.delta() + "MB");
+}
+
+MemoryPhase getMemoryPhase()
+{
+	std::lock_guard<std::mutex> lock(phaseMutex);
+	return currentPhase;
+}
+
+MemoryPhaseStats getMemoryPhaseStats(MemoryPhase phase)
+{
+	std::lock_guard<std::mutex> lock(phaseMutex);
+	if ((phase <= MEMPHASE_NONE) || (phase >= MEMPHASE_COUNT))
+		return MemoryPhaseStats();
+	MemoryPhaseStats stats = phaseStats[phase];
+	// the current phase is not finished yet, use the values sampled so far
+	if (phase == currentPhase)
+	{
+		stats.endUsage = getCurrentUsage();
+		if (phasePeakUsage > stats.peakUsage)
+			stats.peakUsage = phasePeakUsage;
+	}
+	return stats;
+}
+
+void resetMemoryPhases()
+{
+	std::lock_guard<std::mutex> lock(phaseMutex);
+	for (int i = 0; i < MEMPHASE_COUNT; i++)
+		phaseStats[i] = MemoryPhaseStats();
+	currentPhase = MEMPHASE_NONE;
+}
+
+std::string getMemoryPhaseReport()
+{
+	std::ostringstream report;
+	for (int i = MEMPHASE_NONE + 1; i < MEMPHASE_COUNT; i++)
+	{
+		MemoryPhaseStats stats = getMemoryPhaseStats((MemoryPhase)i);
+		if (!stats.used)
+			continue;
+		report << getMemoryPhaseName((MemoryPhase)i) << ": start " << stats.startUsage << "MB end " << stats.endUsage << "MB peak " << stats.peakUsage << "MB delta " << stats.delta() << "MB\n";
+	}
+	MemoryUsageDetail detail;
+	if (getMemoryUsageDetail(detail))
+		report << "process: resident " << detail.resident << "MB proportional " << detail.proportional << "MB virtual " << detail.virtualSize << "MB swap " << detail.swap << "MB peak " << detail.osPeak << "MB\n";
+	return report.str();
+}
@@ -1,14 +1,55 @@
 //
-// memory info - for windows only at the momen
+// memory info - windows uses GetProcessMemoryInfo, linux reads /proc/self
+// All values are in MB.
 //
 
 #ifndef MEMINFO_H
 #define MEMINFO_H
 
-static size_t startUsage = 0;
+#include <string>
 
+enum MemoryPhase{
+	MEMPHASE_NONE = 0,
+	MEMPHASE_PARSE,
+	MEMPHASE_TRANSLATE,
+	MEMPHASE_RENDER,
+	MEMPHASE_WRITE,
+	MEMPHASE_COUNT
+};
+
+struct MemoryPhaseStats{
+	size_t startUsage = 0;
+	size_t endUsage = 0;
+	size_t peakUsage = 0;
+	bool used = false;
+	long long delta() const { return (long long)endUsage - (long long)startUsage; }
+};
+
+struct MemoryUsageDetail{
+	size_t resident = 0;
+	size_t virtualSize = 0;
+	// proportional set size, shared pages are split between the processes using them (linux only, otherwise resident)
+	size_t proportional = 0;
+	size_t swap = 0;
+	// peak resident size as recorded by the os
+	size_t osPeak = 0;
+};
+
+// cheap enough to be called frequently, the logger samples it in the background
 size_t getCurrentUsage();
 size_t getPeakUsage();
+size_t getStartUsage();
+// more expensive, reads smaps_rollup on linux
+bool getMemoryUsageDetail(MemoryUsageDetail& detail);
 
+// The export is split into phases, the memory at the start and end of every phase and the peak
+// in between are recorded so that it is visible which phase needs the memory.
+// Setting a new phase ends the current one.
+void setMemoryPhase(MemoryPhase phase);
+MemoryPhase getMemoryPhase();
+MemoryPhaseStats getMemoryPhaseStats(MemoryPhase phase);
+const char *getMemoryPhaseName(MemoryPhase phase);
+void resetMemoryPhases();
+std::string getMemoryPhaseReport();
 
 #endif
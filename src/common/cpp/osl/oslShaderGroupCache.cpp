@@ -0,0 +1,157 @@
+#include "oslShaderGroupCache.h"
+#include <stdio.h>
+#include <sys/stat.h>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <iterator>
+#include "utilities/logging.h"
+
+namespace{
+
+	unsigned long long hashBytes(const void *data, size_t numBytes, unsigned long long hash)
+	{
+		const unsigned char *bytes = (const unsigned char *)data;
+		for (size_t i = 0; i < numBytes; i++)
+		{
+			hash ^= bytes[i];
+			hash *= 1099511628211ULL;
+		}
+		return hash;
+	}
+
+	const unsigned long long HASH_START = 14695981039346656037ULL;
+
+	// floats are written with all digits, otherwise slightly different values would get the same key
+	void writeFloats(std::ostringstream& out, const float *values, int numValues)
+	{
+		for (int i = 0; i < numValues; i++)
+			out << " " << std::setprecision(9) << values[i];
+	}
+
+	void writeParameterValue(std::ostringstream& out, const MAYATO_OSL::OSLParameter& param)
+	{
+		switch (param.value.which())
+		{
+		case 0:
+			out << " " << boost::get<int>(param.value);
+			break;
+		case 1:
+		{
+			float f = boost::get<float>(param.value);
+			writeFloats(out, &f, 1);
+			break;
+		}
+		case 2:
+			writeFloats(out, boost::get<MAYATO_OSL::SimpleVector>(param.value).f, 3);
+			break;
+		case 3:
+			writeFloats(out, &boost::get<MAYATO_OSL::SimpleMatrix>(param.value).f[0][0], 16);
+			break;
+		case 4:
+			out << " \"" << boost::get<std::string>(param.value) << "\"";
+			break;
+		}
+	}
+}
+
+namespace MAYATO_OSL{
+
+	void ShaderGroupCache::setShaderSearchPaths(const std::vector<std::string>& paths)
+	{
+		this->searchPaths = paths;
+	}
+
+	unsigned long long ShaderGroupCache::getOsoHash(const MString& shaderType)
+	{
+		std::string typeName = shaderType.asChar();
+		for (auto& dir : this->searchPaths)
+		{
+			std::string path = dir + "/" + typeName + ".oso";
+			struct stat fileStat;
+			if (stat(path.c_str(), &fileStat) != 0)
+				continue;
+
+			auto it = this->osoInfos.find(typeName);
+			if ((it != this->osoInfos.end()) && (it->second.path == path) && (it->second.fileSize == (long long)fileStat.st_size) && (it->second.modificationTime == (long long)fileStat.st_mtime))
+				return it->second.hash;
+
+			std::ifstream osoFile(path.c_str(), std::ios::binary);
+			std::string content((std::istreambuf_iterator<char>(osoFile)), std::istreambuf_iterator<char>());
+			OsoInfo info;
+			info.path = path;
+			info.fileSize = (long long)fileStat.st_size;
+			info.modificationTime = (long long)fileStat.st_mtime;
+			info.hash = hashBytes(content.data(), content.size(), HASH_START);
+			this->osoInfos[typeName] = info;
+			LOG_DEBUG(MString("ShaderGroupCache: new or modified shader ") + path.c_str());
+			return info.hash;
+		}
+		LOG_DEBUG(MString("ShaderGroupCache: no compiled shader found for ") + shaderType);
+		return 0;
+	}
+
+	std::string ShaderGroupCache::serialize(const std::vector<OSLNodeStruct>& nodes, const ConnectionArray& connections)
+	{
+		std::ostringstream out;
+		for (auto& node : nodes)
+		{
+			for (auto& param : node.paramArray)
+			{
+				out << "param " << param.type.c_str() << " " << param.name.asChar();
+				writeParameterValue(out, param);
+				out << " ;\n";
+			}
+			out << "shader " << node.typeName.asChar() << " " << node.nodeName.asChar() << " ;\n";
+		}
+		for (auto& conn : connections)
+			out << "connect " << conn.sourceNode.asChar() << "." << conn.sourceAttribute.asChar() << " " << conn.destNode.asChar() << "." << conn.destAttribute.asChar() << " ;\n";
+		return out.str();
+	}
+
+	std::string ShaderGroupCache::getKey(const std::vector<OSLNodeStruct>& nodes, const ConnectionArray& connections)
+	{
+		std::string serialized = this->serialize(nodes, connections);
+		unsigned long long hash = hashBytes(serialized.data(), serialized.size(), HASH_START);
+		for (auto& node : nodes)
+		{
+			unsigned long long osoHash = this->getOsoHash(node.typeName);
+			hash = hashBytes(&osoHash, sizeof(osoHash), hash);
+		}
+		char key[32];
+		sprintf(key, "%016llx", hash);
+		return key;
+	}
+
+	bool ShaderGroupCache::isUpToDate(const MString& groupName, const std::string& key)
+	{
+		auto it = this->groupKeys.find(groupName.asChar());
+		return (it != this->groupKeys.end()) && (it->second == key);
+	}
+
+	void ShaderGroupCache::setGroup(const MString& groupName, const std::string& key)
+	{
+		this->groupKeys[groupName.asChar()] = key;
+	}
+
+	void ShaderGroupCache::removeGroup(const MString& groupName)
+	{
+		this->groupKeys.erase(groupName.asChar());
+	}
+
+	void ShaderGroupCache::clear()
+	{
+		if ((this->reusedGroups > 0) || (this->builtGroups > 0))
+			Logging::debug(MString("ShaderGroupCache: built ") + this->builtGroups + " shader groups, reused " + this->reusedGroups);
+		this->groupKeys.clear();
+		this->reusedGroups = 0;
+		this->builtGroups = 0;
+	}
+
+	static ShaderGroupCache globalShaderGroupCache;
+
+	ShaderGroupCache& getShaderGroupCache()
+	{
+		return globalShaderGroupCache;
+	}
+}
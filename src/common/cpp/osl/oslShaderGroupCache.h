@@ -0,0 +1,64 @@
+#ifndef MT_OSL_SHADERGROUP_CACHE_H
+#define MT_OSL_SHADERGROUP_CACHE_H
+
+/*
+	Creating the shaders and connections of a shader group is cheap, but every new or cleared group
+	has to be optimized and compiled by the renderer before it can be used. So I save for every shader group
+	a key which is built from the content of the group: the compiled shaders (.oso), the parameter values and the connections.
+	If a network is translated again, e.g. in IPR after an attribute was modified which is not used by OSL or
+	after a modification was undone, the group only has to be rebuilt if the key is different.
+
+	The .oso files are compiled from the python scripts before rendering, so I do not compile anything here, but
+	the hash of every .oso file is part of the key, this way a recompiled shader always leads to a rebuild.
+	The hashes are kept in memory together with the file size and modification time, so a shader is only read again
+	if it was modified.
+
+	The group keys are only valid as long as the renderer keeps its compiled groups, so a group is reused only within one
+	rendering, e.g. during an IPR session. initializeRenderer() and unInitializeRenderer() of the renderer
+	call clear(), the next rendering builds all groups again. At the moment only appleseed uses the cache.
+*/
+
+#include <maya/MString.h>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "oslUtils.h"
+
+namespace MAYATO_OSL{
+
+	struct OsoInfo{
+		std::string path;
+		long long modificationTime = 0;
+		long long fileSize = 0;
+		unsigned long long hash = 0;
+	};
+
+	class ShaderGroupCache
+	{
+	public:
+		// the directories where the renderer searches the .oso files, in search order
+		void setShaderSearchPaths(const std::vector<std::string>& paths);
+		// hash of the compiled shader file, 0 if the shader was not found in the search paths
+		unsigned long long getOsoHash(const MString& shaderType);
+		// text version of the group in the syntax OSL uses for serialized shader groups, the nodes have to be sorted already
+		std::string serialize(const std::vector<OSLNodeStruct>& nodes, const ConnectionArray& connections);
+		std::string getKey(const std::vector<OSLNodeStruct>& nodes, const ConnectionArray& connections);
+		// returns true if the group with this name was built from the same content
+		bool isUpToDate(const MString& groupName, const std::string& key);
+		void setGroup(const MString& groupName, const std::string& key);
+		void removeGroup(const MString& groupName);
+		// forgets all groups, call it if the renderer deletes its shader groups
+		void clear();
+		int reusedGroups = 0;
+		int builtGroups = 0;
+	private:
+		std::vector<std::string> searchPaths;
+		std::unordered_map<std::string, OsoInfo> osoInfos;
+		// key of every built group
+		std::unordered_map<std::string, std::string> groupKeys;
+	};
+
+	ShaderGroupCache& getShaderGroupCache();
+}
+
+#endif
@@ -0,0 +1,358 @@
+#include "oslTextureOptimizer.h"
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <maya/MGlobal.h>
+#include <maya/MItDependencyNodes.h>
+#include <maya/MFnDependencyNode.h>
+#include <OpenImageIO/imagebufalgo.h>
+#include "utilities/logging.h"
+#include "utilities/attrTools.h"
+#include "utilities/pystring.h"
+
+namespace{
+
+	const unsigned long long HASH_START = 14695981039346656037ULL;
+	const unsigned long long HASH_PRIME = 1099511628211ULL;
+	const char *MANIFEST_NAME = "textureManifest.txt";
+	// the source files can be several hundred MB, so they are read in blocks of 1 MB and hashed 8 bytes at a time
+	const size_t HASH_BLOCK_SIZE = 1 << 20;
+
+	unsigned long long hashString(const std::string& s)
+	{
+		unsigned long long hash = HASH_START;
+		for (size_t i = 0; i < s.size(); i++)
+		{
+			hash ^= (unsigned char)s[i];
+			hash *= HASH_PRIME;
+		}
+		return hash;
+	}
+
+	unsigned long long hashFile(const std::string& path)
+	{
+		std::ifstream file(path.c_str(), std::ios::binary);
+		std::vector<char> buffer(HASH_BLOCK_SIZE);
+		unsigned long long hash = HASH_START;
+		while (file.good())
+		{
+			file.read(&buffer[0], buffer.size());
+			size_t numBytes = (size_t)file.gcount();
+			size_t numWords = numBytes / 8;
+			for (size_t i = 0; i < numWords; i++)
+			{
+				// memcpy instead of a pointer cast, the char buffer is not aligned for 8 byte values
+				unsigned long long word;
+				memcpy(&word, &buffer[i * 8], sizeof(word));
+				hash ^= word;
+				hash *= HASH_PRIME;
+			}
+			for (size_t i = numWords * 8; i < numBytes; i++)
+			{
+				hash ^= (unsigned char)buffer[i];
+				hash *= HASH_PRIME;
+			}
+		}
+		return hash;
+	}
+
+	bool getFileStat(const std::string& path, long long& fileSize, long long& modificationTime)
+	{
+		struct stat fileStat;
+		if (stat(path.c_str(), &fileStat) != 0)
+			return false;
+		fileSize = (long long)fileStat.st_size;
+		modificationTime = (long long)fileStat.st_mtime;
+		return true;
+	}
+
+	bool fileExists(const std::string& path)
+	{
+		struct stat fileStat;
+		return stat(path.c_str(), &fileStat) == 0;
+	}
+
+	// a name which is unique for this thread, other machines write into the same directory.
+	// OIIO selects the file format by the extension, so it is appended again.
+	std::string getTempPath(const std::string& path, const char *extension)
+	{
+		unsigned long long id = std::hash<std::thread::id>()(std::this_thread::get_id());
+		id ^= (unsigned long long)std::chrono::steady_clock::now().time_since_epoch().count();
+		char suffix[32];
+		sprintf(suffix, "_%016llx", id);
+		return path + suffix + extension;
+	}
+
+	bool makeTxTexture(const std::string& sourcePath, const std::string& txPath, std::string& errorMessage)
+	{
+		OIIO::ImageSpec config;
+		config.tile_width = 64;
+		config.tile_height = 64;
+		config.tile_depth = 1;
+		config.attribute("compression", "zip");
+		config.attribute("maketx:filtername", "lanczos3");
+		config.attribute("maketx:opaque_detect", 1);
+		config.attribute("maketx:constant_color_detect", 1);
+		std::ostringstream messages;
+		if (!OIIO::ImageBufAlgo::make_texture(OIIO::ImageBufAlgo::MakeTxTexture, sourcePath, txPath, config, &messages))
+		{
+			errorMessage = OIIO::geterror();
+			if (errorMessage.empty())
+				errorMessage = messages.str();
+			return false;
+		}
+		return true;
+	}
+}
+
+namespace MAYATO_OSL{
+
+	// file format: one line per texture: size modificationTime hash sourcePath|txPath
+	void TextureOptimizer::loadManifest()
+	{
+		this->manifest.clear();
+		std::ifstream manifestFile((this->optimizedDir + MANIFEST_NAME).c_str());
+		if (!manifestFile.good())
+			return;
+		std::string line;
+		while (std::getline(manifestFile, line))
+		{
+			std::istringstream lineStream(line);
+			TextureInfo info;
+			if (!(lineStream >> info.fileSize >> info.modificationTime >> info.hash))
+				continue;
+			std::string paths;
+			std::getline(lineStream >> std::ws, paths);
+			size_t separator = paths.rfind('|');
+			if (separator == std::string::npos)
+				continue;
+			info.txPath = paths.substr(separator + 1);
+			this->manifest[paths.substr(0, separator)] = info;
+		}
+		Logging::debug(MString("TextureOptimizer: read ") + (int)this->manifest.size() + " entries from " + (this->optimizedDir + MANIFEST_NAME).c_str());
+	}
+
+	// other machines can write the manifest at the same time, so it is written to a temporary file and renamed
+	void TextureOptimizer::saveManifest()
+	{
+		std::string manifestPath = this->optimizedDir + MANIFEST_NAME;
+		std::string tempPath = getTempPath(manifestPath, ".tmp");
+		{
+			std::ofstream manifestFile(tempPath.c_str());
+			if (!manifestFile.good())
+			{
+				Logging::warning(MString("TextureOptimizer: unable to write ") + tempPath.c_str());
+				return;
+			}
+			for (auto& it : this->manifest)
+				manifestFile << it.second.fileSize << " " << it.second.modificationTime << " " << it.second.hash << " " << it.first << "|" << it.second.txPath << "\n";
+		}
+		remove(manifestPath.c_str());
+		if (rename(tempPath.c_str(), manifestPath.c_str()) != 0)
+			remove(tempPath.c_str());
+	}
+
+	// all textures are saved in one directory, the hash of the complete source path avoids conflicts between files with the same name
+	std::string TextureOptimizer::getTxPath(const std::string& sourcePath) const
+	{
+		std::string fileName = sourcePath;
+		size_t slash = fileName.find_last_of("/\\");
+		if (slash != std::string::npos)
+			fileName = fileName.substr(slash + 1);
+		size_t dot = fileName.rfind('.');
+		if (dot != std::string::npos)
+			fileName = fileName.substr(0, dot);
+		char pathHash[32];
+		sprintf(pathHash, "_%016llx", hashString(sourcePath));
+		return this->optimizedDir + fileName + pathHash + this->textureExtension;
+	}
+
+	void TextureOptimizer::collectTextures(std::vector<std::string>& sourcePaths)
+	{
+		for (MItDependencyNodes it(MFn::kFileTexture); !it.isDone(); it.next())
+		{
+			MFnDependencyNode fileFn(it.thisNode());
+			std::string sourcePath = getStringAttr("fileTextureName", fileFn, "").asChar();
+			if (sourcePath.empty() || pystring::endswith(pystring::lower(sourcePath), ".tx"))
+				continue;
+			if (getBoolAttr("useFrameExtension", fileFn, false) || (getIntAttr("uvTilingMode", fileFn, 0) != 0))
+				continue;
+			if (std::find(sourcePaths.begin(), sourcePaths.end(), sourcePath) != sourcePaths.end())
+				continue;
+			if (!fileExists(sourcePath))
+			{
+				Logging::warning(MString("TextureOptimizer: texture file not found: ") + sourcePath.c_str());
+				continue;
+			}
+			sourcePaths.push_back(sourcePath);
+		}
+	}
+
+	void TextureOptimizer::runJob(Job& job)
+	{
+		if (job.compareHash)
+		{
+			unsigned long long hash = hashFile(job.sourcePath);
+			if (hash == job.info.hash)
+			{
+				job.success = true;
+				return;
+			}
+			job.info.hash = hash;
+			job.compareHash = false;
+		}
+		else{
+			job.info.hash = hashFile(job.sourcePath);
+		}
+
+		std::string tempPath = getTempPath(job.info.txPath, this->textureExtension.c_str());
+		std::string errorMessage;
+		if (!makeTxTexture(job.sourcePath, tempPath, errorMessage))
+		{
+			Logging::error(MString("TextureOptimizer: unable to convert ") + job.sourcePath.c_str() + ": " + errorMessage.c_str());
+			remove(tempPath.c_str());
+			return;
+		}
+		remove(job.info.txPath.c_str());
+		if (rename(tempPath.c_str(), job.info.txPath.c_str()) != 0)
+		{
+			// another machine was faster
+			remove(tempPath.c_str());
+			if (!fileExists(job.info.txPath))
+			{
+				Logging::error(MString("TextureOptimizer: unable to rename ") + tempPath.c_str() + " to " + job.info.txPath.c_str());
+				return;
+			}
+		}
+		job.success = true;
+	}
+
+	void TextureOptimizer::prepare(const MString& optimizedTexturePath, int numThreads)
+	{
+		this->clear();
+		if (optimizedTexturePath.length() == 0)
+		{
+			Logging::warning("TextureOptimizer: optimizedTexturePath is empty, using original textures.");
+			return;
+		}
+		this->optimizedDir = optimizedTexturePath.asChar();
+		if ((this->optimizedDir.back() != '/') && (this->optimizedDir.back() != '\\'))
+			this->optimizedDir += "/";
+		if (!fileExists(this->optimizedDir.substr(0, this->optimizedDir.size() - 1)))
+			MGlobal::executeCommand(MString("sysFile -makeDir \"") + this->optimizedDir.c_str() + "\"");
+
+		std::vector<std::string> sourcePaths;
+		this->collectTextures(sourcePaths);
+		if (sourcePaths.empty())
+			return;
+		this->loadManifest();
+
+		// the translators can read the paths from other threads, so they are published at the end
+		std::unordered_map<std::string, std::string> newPaths;
+		std::vector<Job> jobs;
+		for (auto& sourcePath : sourcePaths)
+		{
+			Job job;
+			job.sourcePath = sourcePath;
+			job.info.txPath = this->getTxPath(sourcePath);
+			if (!getFileStat(sourcePath, job.info.fileSize, job.info.modificationTime))
+				continue;
+			auto entry = this->manifest.find(sourcePath);
+			if ((entry != this->manifest.end()) && (entry->second.txPath == job.info.txPath) && fileExists(job.info.txPath))
+			{
+				if ((entry->second.fileSize == job.info.fileSize) && (entry->second.modificationTime == job.info.modificationTime))
+				{
+					newPaths[sourcePath] = job.info.txPath;
+					this->reusedTextures++;
+					continue;
+				}
+				// a touched or copied file is not converted again if the content is the same
+				if (entry->second.fileSize == job.info.fileSize)
+				{
+					job.compareHash = true;
+					job.info.hash = entry->second.hash;
+				}
+			}
+			jobs.push_back(job);
+		}
+
+		if (!jobs.empty())
+		{
+			if (numThreads <= 0)
+				numThreads = (int)std::thread::hardware_concurrency();
+			numThreads = std::max(1, std::min(numThreads, (int)jobs.size()));
+			Logging::info(MString("TextureOptimizer: checking ") + (int)jobs.size() + " textures with " + numThreads + " threads.");
+			std::atomic<size_t> nextJob(0);
+			std::vector<std::thread> workers;
+			for (int t = 0; t < numThreads; t++)
+			{
+				workers.push_back(std::thread([this, &jobs, &nextJob]()
+				{
+					size_t jobId;
+					while ((jobId = nextJob++) < jobs.size())
+						this->runJob(jobs[jobId]);
+				}));
+			}
+			for (auto& worker : workers)
+				worker.join();
+
+			for (auto& job : jobs)
+			{
+				if (!job.success)
+				{
+					this->failedTextures++;
+					continue;
+				}
+				if (job.compareHash)
+					this->reusedTextures++;
+				else
+					this->convertedTextures++;
+				this->manifest[job.sourcePath] = job.info;
+				newPaths[job.sourcePath] = job.info.txPath;
+			}
+			this->saveManifest();
+		}
+		{
+			std::lock_guard<std::mutex> lock(this->optimizedPathsMutex);
+			this->optimizedPaths.swap(newPaths);
+		}
+		Logging::info(MString("TextureOptimizer: converted ") + this->convertedTextures + " textures, reused " + this->reusedTextures + ", failed " + this->failedTextures);
+	}
+
+	void TextureOptimizer::setTextureExtension(const std::string& extension)
+	{
+		this->textureExtension = extension;
+	}
+
+	MString TextureOptimizer::getOptimizedPath(const MString& sourcePath) const
+	{
+		std::lock_guard<std::mutex> lock(this->optimizedPathsMutex);
+		auto it = this->optimizedPaths.find(sourcePath.asChar());
+		if (it == this->optimizedPaths.end())
+			return sourcePath;
+		return MString(it->second.c_str());
+	}
+
+	void TextureOptimizer::clear()
+	{
+		std::lock_guard<std::mutex> lock(this->optimizedPathsMutex);
+		this->optimizedPaths.clear();
+		this->manifest.clear();
+		this->convertedTextures = 0;
+		this->reusedTextures = 0;
+		this->failedTextures = 0;
+	}
+
+	static TextureOptimizer globalTextureOptimizer;
+
+	TextureOptimizer& getTextureOptimizer()
+	{
+		return globalTextureOptimizer;
+	}
+}
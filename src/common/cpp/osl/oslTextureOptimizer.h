@@ -0,0 +1,74 @@
+#ifndef MT_OSL_TEXTURE_OPTIMIZER_H
+#define MT_OSL_TEXTURE_OPTIMIZER_H
+
+/*
+	Large scanline textures like jpg or png have to be read completely before the OIIO texture system can use them,
+	and they are read again in every frame. A tiled and mipmapped .tx file only needs the tiles of the resolution which is really used.
+
+	Before rendering all file textures of the scene are collected and converted into .tx files in the optimizedTexturePath
+	of the render globals. The conversions run in parallel. A manifest file in the same directory saves for every source texture
+	its size, modification time and a hash of its content. A texture is converted again only if its .tx file is missing
+	or if the content has changed. If only the modification time changed, e.g. because the file was copied, the hash is compared.
+
+	Several farm machines can use the same directory, so every conversion writes a temporary file first and renames it at the end.
+	Animated and udim textures are not converted, the translators simply use the original file if there is no optimized version.
+
+	The textures are written as .tx by default. A renderer which also reads the textures with its own loader can choose
+	another format which both can read, e.g. Corona uses tiled and mipmapped .exr files for OSL and its native bitmaps.
+*/
+
+#include <maya/MString.h>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <unordered_map>
+
+namespace MAYATO_OSL{
+
+	struct TextureInfo{
+		std::string txPath;
+		long long modificationTime = 0;
+		long long fileSize = 0;
+		unsigned long long hash = 0;
+	};
+
+	class TextureOptimizer
+	{
+	public:
+		// main thread, collects all file textures of the scene and converts the missing and outdated ones
+		// numThreads == 0 means one thread per core
+		void prepare(const MString& optimizedTexturePath, int numThreads = 0);
+		// extension of the optimized files including the dot, OIIO selects the file format by the extension
+		void setTextureExtension(const std::string& extension);
+		// returns the optimized texture for a source texture or the source texture if there is none
+		MString getOptimizedPath(const MString& sourcePath) const;
+		// forgets the optimized textures of this rendering, the files and the manifest remain
+		void clear();
+		int convertedTextures = 0;
+		int reusedTextures = 0;
+		int failedTextures = 0;
+	private:
+		struct Job{
+			std::string sourcePath;
+			TextureInfo info;
+			// the manifest entry is outdated, but the content can still be the same
+			bool compareHash = false;
+			bool success = false;
+		};
+		void loadManifest();
+		void saveManifest();
+		std::string getTxPath(const std::string& sourcePath) const;
+		void collectTextures(std::vector<std::string>& sourcePaths);
+		void runJob(Job& job);
+		std::string optimizedDir;
+		std::string textureExtension = ".tx";
+		std::unordered_map<std::string, TextureInfo> manifest;
+		// source path -> .tx path of all textures which are up to date
+		std::unordered_map<std::string, std::string> optimizedPaths;
+		mutable std::mutex optimizedPathsMutex;
+	};
+
+	TextureOptimizer& getTextureOptimizer();
+}
+
+#endif
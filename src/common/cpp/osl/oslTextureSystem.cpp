@@ -0,0 +1,98 @@
+#include "oslTextureSystem.h"
+#include <sstream>
+#include <iomanip>
+#include "utilities/logging.h"
+
+namespace MAYATO_OSL{
+
+	OIIO::TextureSystem *TextureSystemManager::get()
+	{
+		std::lock_guard<std::mutex> lock(this->textureSystemMutex);
+		if (this->textureSystem == nullptr)
+		{
+			this->textureSystem = OIIO::TextureSystem::create(false);
+			this->applySettings();
+			Logging::debug("TextureSystemManager: created texture system.");
+		}
+		return this->textureSystem;
+	}
+
+	void TextureSystemManager::applySettings()
+	{
+		if (this->textureSystem == nullptr)
+			return;
+		this->textureSystem->attribute("grey_to_rgb", 1);
+		this->textureSystem->attribute("max_memory_MB", this->settings.maxMemoryMB);
+		this->textureSystem->attribute("max_open_files", this->settings.maxOpenFiles);
+		this->textureSystem->attribute("autotile", this->settings.autotile);
+		this->textureSystem->attribute("automip", this->settings.automip ? 1 : 0);
+		// with autotile the scanline textures are read in tiles, it is useless without accepting untiled files
+		this->textureSystem->attribute("accept_untiled", 1);
+	}
+
+	void TextureSystemManager::configure(const TextureSystemSettings& settings)
+	{
+		std::lock_guard<std::mutex> lock(this->textureSystemMutex);
+		this->settings = settings;
+		this->applySettings();
+		Logging::debug(MString("TextureSystemManager: cache ") + this->settings.maxMemoryMB + " MB, max open files " + this->settings.maxOpenFiles + ", autotile " + this->settings.autotile);
+	}
+
+	void TextureSystemManager::resetStatistics()
+	{
+		std::lock_guard<std::mutex> lock(this->textureSystemMutex);
+		if (this->textureSystem != nullptr)
+			this->textureSystem->reset_stats();
+	}
+
+	TextureIOStatistics TextureSystemManager::getStatistics()
+	{
+		std::lock_guard<std::mutex> lock(this->textureSystemMutex);
+		TextureIOStatistics stats;
+		if (this->textureSystem == nullptr)
+			return stats;
+		OIIO::TypeDesc int64Type(OIIO::TypeDesc::INT64);
+		this->textureSystem->getattribute("stat:bytes_read", int64Type, &stats.bytesRead);
+		this->textureSystem->getattribute("stat:cache_memory_used", int64Type, &stats.cacheMemoryUsed);
+		this->textureSystem->getattribute("stat:unique_files", OIIO::TypeDesc::TypeInt, &stats.uniqueFiles);
+		this->textureSystem->getattribute("stat:open_files_created", OIIO::TypeDesc::TypeInt, &stats.openFilesCreated);
+		this->textureSystem->getattribute("stat:fileio_time", OIIO::TypeDesc::TypeFloat, &stats.fileIOSeconds);
+		return stats;
+	}
+
+	std::string TextureSystemManager::getReport(int level)
+	{
+		TextureIOStatistics stats = this->getStatistics();
+		std::ostringstream report;
+		report << "Texture I/O: " << stats.uniqueFiles << " files, " << std::fixed << std::setprecision(1)
+			<< stats.bytesRead / (1024.0 * 1024.0) << " MB read in " << stats.fileIOSeconds << "s, "
+			<< stats.openFilesCreated << " file opens, cache " << stats.cacheMemoryUsed / (1024.0 * 1024.0) << " MB\n";
+		std::lock_guard<std::mutex> lock(this->textureSystemMutex);
+		if ((this->textureSystem != nullptr) && (level > 0))
+			report << this->textureSystem->getstats(level);
+		return report.str();
+	}
+
+	void TextureSystemManager::invalidate(bool force)
+	{
+		std::lock_guard<std::mutex> lock(this->textureSystemMutex);
+		if (this->textureSystem != nullptr)
+			this->textureSystem->invalidate_all(force);
+	}
+
+	void TextureSystemManager::destroy()
+	{
+		std::lock_guard<std::mutex> lock(this->textureSystemMutex);
+		if (this->textureSystem == nullptr)
+			return;
+		OIIO::TextureSystem::destroy(this->textureSystem);
+		this->textureSystem = nullptr;
+	}
+
+	static TextureSystemManager globalTextureSystemManager;
+
+	TextureSystemManager& getTextureSystemManager()
+	{
+		return globalTextureSystemManager;
+	}
+}
@@ -0,0 +1,65 @@
+#ifndef MT_OSL_TEXTURE_SYSTEM_H
+#define MT_OSL_TEXTURE_SYSTEM_H
+
+/*
+	One OIIO texture system for the whole plugin. At the moment only mayaToCorona uses it: every OSLShadingNetworkRenderer
+	creates its shading system with it, the one of the final rendering as well as the ones of the swatch and viewport
+	renderers, so a texture which is already in the cache is not read again in the next rendering or for a swatch.
+	appleseed creates its own texture system internally and does not use this one.
+
+	The texture system is not the OIIO process wide shared one, because other plugins in the same maya session can
+	use the shared one with completely different settings. Cache size, number of open files and autotile
+	are set from the render globals before every rendering. The statistics are reset at the start of a rendering,
+	so the report at the end only contains the texture I/O of this rendering.
+*/
+
+#include <string>
+#include <mutex>
+#include <OpenImageIO/texture.h>
+
+namespace MAYATO_OSL{
+
+	struct TextureSystemSettings{
+		// maximum memory of the tile cache in MB
+		float maxMemoryMB = 1024.0f;
+		int maxOpenFiles = 100;
+		// untiled textures are read in tiles of this size, 0 reads the complete image
+		int autotile = 64;
+		// untiled textures can be mipmapped on the fly, this needs a lot of memory for large textures
+		bool automip = false;
+	};
+
+	struct TextureIOStatistics{
+		long long bytesRead = 0;
+		long long cacheMemoryUsed = 0;
+		int uniqueFiles = 0;
+		int openFilesCreated = 0;
+		// time spent with reading textures, summed over all threads
+		float fileIOSeconds = 0.0f;
+	};
+
+	class TextureSystemManager
+	{
+	public:
+		// creates the texture system with the current settings on the first call
+		OIIO::TextureSystem *get();
+		void configure(const TextureSystemSettings& settings);
+		void resetStatistics();
+		TextureIOStatistics getStatistics();
+		// the short summary and the detailed OIIO statistics of the given level
+		std::string getReport(int level = 1);
+		// releases the cached tiles of all files which were modified since they were read, force releases everything
+		void invalidate(bool force = false);
+		// has to be called before the plugin is unloaded, the OSL shading systems must not use it anymore
+		void destroy();
+	private:
+		void applySettings();
+		OIIO::TextureSystem *textureSystem = nullptr;
+		TextureSystemSettings settings;
+		std::mutex textureSystemMutex;
+	};
+
+	TextureSystemManager& getTextureSystemManager();
+}
+
+#endif
@@ -1,5 +1,9 @@
 #include <filesystem>
+#include <unordered_map>
+#include <queue>
+#include <functional>
 #include "oslUtils.h"
+#include "oslTextureOptimizer.h"
 #include <maya/MPlugArray.h>
 #include <maya/MFnDependencyNode.h>
 #include "renderGlobals.h"
@@ -42,23 +46,16 @@ namespace MAYATO_OSLUTIL{
 	void OSLUtilClass::saveOSLNodeNameInArray(MString& oslNodeName)
 	{
 		if (MayaTo::getWorldPtr()->renderType == MayaTo::MayaToWorld::SWATCHRENDER)
-			this->definedOSLSWNodes.push_back(oslNodeName);
+			this->definedOSLSWNodes.insert(oslNodeName.asChar());
 		else
-			this->definedOSLNodes.push_back(oslNodeName);
+			this->definedOSLNodes.insert(oslNodeName.asChar());
 	}
 
 	bool OSLUtilClass::doesOSLNodeAlreadyExist(MString& oslNode)
 	{
-		std::vector<MString> nodes;
 		if (MayaTo::getWorldPtr()->renderType == MayaTo::MayaToWorld::SWATCHRENDER)
-			nodes = definedOSLSWNodes;
-		else
-			nodes = definedOSLNodes;
-
-		for (auto node : nodes)
-			if (node == oslNode)
-				return true;
-		return false;
+			return definedOSLSWNodes.count(oslNode.asChar()) > 0;
+		return definedOSLNodes.count(oslNode.asChar()) > 0;
 	}
 
 	bool OSLUtilClass::doesOSLNodeAlreadyExist(MObject& oslNode)
@@ -106,7 +103,7 @@ namespace MAYATO_OSLUTIL{
 			if (projectionNodeArray.size() > 0)
 			{
 				MAYATO_OSL::ProjectionUtil& util = projectionNodeArray.back();
-				Logging::debug(MString("node ") + depFn.name() + " has no incoming connections this is my leaf node.");
+				LOG_DEBUG(MString("node ") + depFn.name() + " has no incoming connections this is my leaf node.");
 				util.leafNodes.append(depFn.object());
 			}
 			return;
@@ -117,14 +114,14 @@ namespace MAYATO_OSLUTIL{
 		for (uint i = 0; i < inputNodes.length(); i++)
 		{
 			MString nodeName = getObjectName(inputNodes[i]);
-			Logging::debug(MString("Checking node ") + nodeName);
+			LOG_DEBUG(MString("Checking node ") + nodeName);
 			listProjectionHistory(inputNodes[i]);
 		}
 	}
 
 
 
-	void OSLUtilClass::defineOSLParameter(ShaderAttribute& sa, MFnDependencyNode& depFn, MAYATO_OSL::OSLParamArray& paramArray)
+	void OSLUtilClass::defineOSLParameter(const ShaderAttribute& sa, MFnDependencyNode& depFn, MAYATO_OSL::OSLParamArray& paramArray)
 	{
 		MStatus stat;
 		// if we have an array plug we have do deal with several plugs.
@@ -200,6 +197,8 @@ namespace MAYATO_OSLUTIL{
 			MString stringParameter = getString(sa.name.c_str(), depFn);
 			if (sa.name == "fileTextureName")
 			{
+				// a tiled and mipmapped version created before rendering, udim textures are not optimized
+				stringParameter = getTextureOptimizer().getOptimizedPath(stringParameter);
 				// to support udim textures we check if we have a file texture node here.
 				// if so, we take the fileTextureName and seperate base, ext.
 				if (depFn.object().hasFn(MFn::kFileTexture))
@@ -233,14 +232,14 @@ namespace MAYATO_OSLUTIL{
 					}
 					else{
 						ext = fileName.substr(pos + 1);
-						Logging::debug(MString("Extension for file texture: ") + fileName.c_str() + " is " + ext.c_str());
+						LOG_DEBUG(MString("Extension for file texture: ") + fileName.c_str() + " is " + ext.c_str());
 						//if (ext == "exr")
 						//{
 						std::string txFileName = fileName + ".exr.tx";
 						std::tr2::sys::path p = std::tr2::sys::path(txFileName);
 						if (std::tr2::sys::exists(p))
 						{
-							Logging::debug(MString("texture file has a .exr.tx extension, using ") + txFileName.c_str() + " instead of original one");
+							LOG_DEBUG(MString("texture file has a .exr.tx extension, using ") + txFileName.c_str() + " instead of original one");
 							ext = ext + ".exr.tx";
 							if (uvTilingMode == 0)
 								stringParameter = txFileName.c_str();
@@ -350,10 +349,10 @@ namespace MAYATO_OSLUTIL{
 			ca.push_back(MAYATO_OSL::Connection(pn.fullName, "worldInverseMatrix", sn.fullName, "placementMatrix"));
 			connectOSLShaders(ca);
 
-			Logging::debug(MString("Found projection node: ") + projectionNodeName);
+			LOG_DEBUG(MString("Found projection node: ") + projectionNodeName);
 			for (uint lId = 0; lId < util.leafNodes.length(); lId++)
 			{
-				Logging::debug(projectionNodeName + " has to be connected to " + getObjectName(util.leafNodes[lId]));
+				LOG_DEBUG(projectionNodeName + " has to be connected to " + getObjectName(util.leafNodes[lId]));
 				projectionNodes.push_back(util.projectionNode);
 				projectionConnectNodes.push_back(util.projectionNode);
 			}
@@ -466,7 +465,7 @@ namespace MAYATO_OSLUTIL{
 		MPlugArray validSourcePlugs, validDestPlugs;
 		for (uint pId = 0; pId < sourcePlugs.length(); pId++)
 		{
-			Logging::debug(MString("checking plug connection ") + sourcePlugs[pId].name() + "-->" + destPlugs[pId].name());
+			LOG_DEBUG(MString("checking plug connection ") + sourcePlugs[pId].name() + "-->" + destPlugs[pId].name());
 			MPlug sourcePlug = sourcePlugs[pId];
 			// in the ShadingNetwork only the main attribute names are saved, so we need to find the parent first.
 			while (sourcePlug.isChild())
@@ -661,28 +660,19 @@ namespace MAYATO_OSLUTIL{
 	// we have two lists: the local list of nodes/helpernodes for the current shading node and the global node list with all nodes in the shading group.
 	void OSLUtilClass::addNodeToList(MAYATO_OSL::OSLNodeStruct node)
 	{
-		bool found = false;
-		for (auto n : this->oslNodeArray)
-			if (n.nodeName == node.nodeName)
-				found = true;
-		if (!found)
+		if (!oslNodeNames.insert(node.nodeName.asChar()).second)
+			return;
+		if (!doesOSLNodeAlreadyExist(node.nodeName))
 		{
-			if (!doesOSLNodeAlreadyExist(node.nodeName))
-			{
-				oslNodeArray.push_back(node);
-				saveOSLNodeNameInArray(node.nodeName);
-			}
+			oslNodeArray.push_back(node);
+			saveOSLNodeNameInArray(node.nodeName);
 		}
 	}
 
 	void OSLUtilClass::addConnectionToList(MAYATO_OSL::Connection c)
 	{
-		for (auto conn : connectionList)
-		{
-			if (conn == c)
-				return;
-		}
-		connectionList.push_back(c);
+		if (connectionKeys.insert(c.key()).second)
+			connectionList.push_back(c);
 	}
 
 
@@ -691,42 +681,62 @@ namespace MAYATO_OSLUTIL{
 	// floatToVector node is created. If we then connect a component to a component, a outColor.g to a color.b
 	// a vectorToFloat node is created and added to the osl node list. If we now try to connect the output of the 
 	// vectorToFloat node to the previous created node floatToVector, we get an error. 
-	// For this reason we prefix the helperNodes with in_ and out_ and sort them in the correct order.
-
-	// a helper node always starts with in_ or out_ and with nodeName follwed by a _
-	// so for every node we first search for a in_nodename_ node then a out_nodename_
-	// this should transform the example above from:
-	// nodeA, in_floatToVector, out_vectorToFloat, nodeB  to nodeA, out_vectorToFloat, in_vectorToFloat, nodeB
+	// So the nodes are sorted by their connections: a node is only placed after all nodes connected to its inputs.
+	// If there are several possibilities, the node which was added first is used, so the order of the shading network is kept as far as possible.
+	// this transforms the example above from:
+	// nodeA, in_floatToVector, out_vectorToFloat, nodeB  to nodeA, out_vectorToFloat, in_floatToVector, nodeB
 	void OSLUtilClass::cleanupShadingNodeList()
 	{
-		MStringArray sa;
-		std::vector<MAYATO_OSL::OSLNodeStruct> cleanNodeArray;
-		for (auto node : oslNodeArray)
+		size_t numNodes = oslNodeArray.size();
+		std::unordered_map<std::string, size_t> nodeIndex;
+		for (size_t i = 0; i < numNodes; i++)
+			nodeIndex[oslNodeArray[i].nodeName.asChar()] = i;
+
+		std::vector<std::vector<size_t>> outputs(numNodes);
+		std::vector<int> numInputs(numNodes, 0);
+		std::unordered_set<std::string> edges;
+		for (auto& conn : connectionList)
 		{
-			if (pystring::startswith(node.nodeName.asChar(), "in_") || pystring::startswith(node.nodeName.asChar(), "out_"))
+			// connections to nodes outside of this group (e.g. projection nodes) do not influence the order
+			auto source = nodeIndex.find(conn.sourceNode.asChar());
+			auto dest = nodeIndex.find(conn.destNode.asChar());
+			if ((source == nodeIndex.end()) || (dest == nodeIndex.end()) || (source->second == dest->second))
 				continue;
-			MString inNodePattern = MString("in_") + node.nodeName;
-			MString outNodePattern = MString("out_") + node.nodeName;
-			for (auto helperNode : oslNodeArray)
-			{
-				if (!pystring::startswith(helperNode.nodeName.asChar(), "in_"))
-					continue;
-				if (pystring::startswith(helperNode.nodeName.asChar(), inNodePattern.asChar()))
-				{
-					cleanNodeArray.push_back(helperNode);
-				}
-			}
-			cleanNodeArray.push_back(node);
-			for (auto helperNode : oslNodeArray)
+			// several attributes can connect the same nodes, one edge is enough
+			if (!edges.insert(std::string(conn.sourceNode.asChar()) + ">" + conn.destNode.asChar()).second)
+				continue;
+			outputs[source->second].push_back(dest->second);
+			numInputs[dest->second]++;
+		}
+
+		std::priority_queue<size_t, std::vector<size_t>, std::greater<size_t>> readyNodes;
+		for (size_t i = 0; i < numNodes; i++)
+			if (numInputs[i] == 0)
+				readyNodes.push(i);
+
+		std::vector<MAYATO_OSL::OSLNodeStruct> cleanNodeArray;
+		cleanNodeArray.reserve(numNodes);
+		std::vector<bool> placed(numNodes, false);
+		while (!readyNodes.empty())
+		{
+			size_t id = readyNodes.top();
+			readyNodes.pop();
+			cleanNodeArray.push_back(oslNodeArray[id]);
+			placed[id] = true;
+			for (size_t outId : outputs[id])
 			{
-				if (!pystring::startswith(helperNode.nodeName.asChar(), "out_"))
-					continue;
-				if (pystring::startswith(helperNode.nodeName.asChar(), outNodePattern.asChar()))
-				{
-					cleanNodeArray.push_back(helperNode);
-				}
+				if (--numInputs[outId] == 0)
+					readyNodes.push(outId);
 			}
 		}
+
+		if (cleanNodeArray.size() < numNodes)
+		{
+			Logging::warning("OSL shading network contains a cycle, the node order may be invalid.");
+			for (size_t i = 0; i < numNodes; i++)
+				if (!placed[i])
+					cleanNodeArray.push_back(oslNodeArray[i]);
+		}
 		oslNodeArray = cleanNodeArray;
 	}
 
@@ -734,12 +744,12 @@ namespace MAYATO_OSLUTIL{
 	{
 		for (auto node : oslNodeArray)
 		{
-			Logging::debug(MString("NEW: Creating shading node: ") + node.nodeName + " type: " + node.typeName);
+			LOG_DEBUG(MString("NEW: Creating shading node: ") + node.nodeName + " type: " + node.typeName);
 			createOSLShader(node.typeName, node.nodeName, node.paramArray);
 		}
 		for (auto conn:connectionList)
 		{
-			Logging::debug(MString("NEW: Creating connection from: ") + conn.sourceNode + "." + conn.sourceAttribute + " --> " + conn.destNode + "." + conn.destAttribute);
+			LOG_DEBUG(MString("NEW: Creating connection from: ") + conn.sourceNode + "." + conn.sourceAttribute + " --> " + conn.destNode + "." + conn.destAttribute);
 		}
 		connectOSLShaders(connectionList);
 	}
@@ -759,7 +769,7 @@ namespace MAYATO_OSLUTIL{
 		// e.g. create node A, create node B connect B->A is not valid, only A->B
 		for (uint i = 0; i < snode.inputAttributes.size(); i++)
 		{
-			ShaderAttribute& sa = snode.inputAttributes[i];
+			const ShaderAttribute& sa = snode.inputAttributes[i];
 			MPlugArray sourcePlugs, destPlugs;
 			if (!getConnectedPlugs(sa.name.c_str(), depFn, sourcePlugs, destPlugs))
 				continue;
@@ -929,7 +939,7 @@ namespace MAYATO_OSLUTIL{
 		MAYATO_OSL::OSLParamArray paramArray;
 		for (uint i = 0; i < snode.inputAttributes.size(); i++)
 		{
-			ShaderAttribute& sa = snode.inputAttributes[i];
+			const ShaderAttribute& sa = snode.inputAttributes[i];
 			defineOSLParameter(sa, depFn, paramArray);
 		}
 		MAYATO_OSL::OSLNodeStruct oslNode;
@@ -988,7 +998,7 @@ namespace MAYATO_OSLUTIL{
 		{
 			if (projNode == projectionConnectNodes[i])
 			{
-				Logging::debug(MString("Place3dNode for projection input defined ") + pn.name());
+				LOG_DEBUG(MString("Place3dNode for projection input defined ") + pn.name());
 				MString sourceNode = (getObjectName(projectionNodes[i]) + "_ProjUtil");
 				MString sourceAttr = "outUVCoord";
 				MString destNode = pn.name();
@@ -28,6 +28,8 @@
 #include <maya/MFloatVector.h>
 #include <maya/MFnDependencyNode.h>
 #include <vector>
+#include <string>
+#include <unordered_set>
 #include "OSL/oslexec.h"
 #include "boost/variant.hpp"
 #include "math.h"
@@ -83,6 +85,11 @@ namespace MAYATO_OSL{
 							return true;
 			return false;
 		}
+		// unique string for a fast duplicate check
+		std::string key() const
+		{
+			return std::string(sourceNode.asChar()) + "." + sourceAttribute.asChar() + ">" + destNode.asChar() + "." + destAttribute.asChar();
+		}
 	};
 
 	struct SimpleVector{
@@ -263,15 +270,18 @@ namespace MAYATO_OSLUTIL{
 		std::vector<MObject> projectionNodes;
 		std::vector<MObject> projectionConnectNodes;
 
-		std::vector<MString> definedOSLNodes;
-		std::vector<MString> definedOSLSWNodes;
+		std::unordered_set<std::string> definedOSLNodes;
+		std::unordered_set<std::string> definedOSLSWNodes;
 		MAYATO_OSL::ConnectionArray connectionList;
 		std::vector<MAYATO_OSL::OSLNodeStruct> oslNodeArray;
+		// names of the nodes in oslNodeArray and keys of the connections in connectionList
+		std::unordered_set<std::string> oslNodeNames;
+		std::unordered_set<std::string> connectionKeys;
 
 
 		bool doesHelperNodeExist(MString& helperNode);
 		void listProjectionHistory(MObject& mobject);
-		void defineOSLParameter(ShaderAttribute& sa, MFnDependencyNode& depFn, MAYATO_OSL::OSLParamArray& paramArray);
+		void defineOSLParameter(const ShaderAttribute& sa, MFnDependencyNode& depFn, MAYATO_OSL::OSLParamArray& paramArray);
 		//MString createPlugHelperNodeName(MPlug& plug, bool outType);
 		//MString createPlugHelperNodeName(const char *attrName, MObject& node, bool outType);
 		//void createPlugHelperNode(MPlug plug, bool outType = false);
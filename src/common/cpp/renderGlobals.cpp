@@ -36,6 +36,9 @@ RenderGlobals::RenderGlobals()
 	this->motionBlurType = 0; // center
 	this->xftimesamples = 2;
 	this->geotimesamples = 2;
+	this->useVelocityMb = true;
+	this->velocitySetName = "velocity";
+	this->velocityScale = 1.0f;
 	this->createDefaultLight = false;
 	this->exportSceneFile = false;
 	this->adaptiveSampling = false;
@@ -44,6 +47,24 @@ RenderGlobals::RenderGlobals()
 	this->exportSceneFileName = "";
 	this->useSunLightConnection = false;
 	this->imagePath = "";
+	this->useOptimizedTextures = false;
+	this->optimizedTexturePath = "";
+	this->traceTranslation = false;
+	this->traceFilePath = "";
+	this->sceneStatistics = false;
+	this->statisticsFilePath = "";
+	this->pipelineSequence = false;
+	this->framesInFlight = 1;
+	this->pipelineFilePath = "";
+	this->checkpoints = false;
+	this->checkpointInterval = 15.0f;
+	this->checkpointFilePath = "";
+	this->regionCulling = false;
+	this->regionCullingMargin = 0.1f;
+	this->frustumCulling = false;
+	this->frustumCullingMargin = 0.1f;
+	this->cullingRayMargin = 0.0f;
+	this->minScreenSize = 0.0f;
 	this->getDefaultGlobals();
 	this->imageFormatString = getEnumString(MString("imageFormat"), MFnDependencyNode(getRenderGlobalsNode()));
 	this->internalUnit = MDistance::internalUnit();
@@ -334,6 +355,38 @@ bool RenderGlobals::getMbSteps()
 	return true;
 }
 
+void RenderGlobals::getGeoStepTimes(std::vector<float>& times)
+{
+	times.clear();
+	if (!this->doMb || (this->geotimesamples < 2))
+	{
+		times.push_back(0.0f);
+		return;
+	}
+	float geoStepSize = this->mbLength / (float)(this->geotimesamples - 1);
+	for (int step = 0; step < this->geotimesamples; step++)
+		times.push_back(this->mbStartTime + geoStepSize * step);
+}
+
+// If all deforming objects get their motion steps from velocities, we only need the very first
+// deform step, all other deform only steps would only cost additional viewFrame() calls.
+void RenderGlobals::removeGeoSteps()
+{
+	bool firstGeoStep = true;
+	std::vector<MbElement> elements;
+	for (auto mbel : this->mbElementList)
+	{
+		if (mbel.elementType == MbElement::Geo)
+		{
+			if (!firstGeoStep)
+				continue;
+			firstGeoStep = false;
+		}
+		elements.push_back(mbel);
+	}
+	this->mbElementList = elements;
+}
+
 bool RenderGlobals::isMbStartStep()
 {
 	return this->currentMbStep == 0;
@@ -422,6 +475,9 @@ bool RenderGlobals::getDefaultGlobals()
 	this->motionBlurType = 0; // center
 	this->xftimesamples = getIntAttr("xftimesamples", depFn, 2);
 	this->geotimesamples = getIntAttr("geotimesamples", depFn, 2);
+	this->useVelocityMb = getBoolAttr("useVelocityMotionBlur", depFn, true);
+	this->velocitySetName = getStringAttr("velocitySetName", depFn, "velocity");
+	this->velocityScale = getFloatAttr("velocityScale", depFn, 1.0f);
 	this->createDefaultLight = false;
 	this->renderType = RenderType::FINAL;
 	this->exportSceneFile = getBoolAttr("exportSceneFile", depFn, false);
@@ -432,11 +488,31 @@ bool RenderGlobals::getDefaultGlobals()
 	this->imagePath = getStringAttr("imagePath", depFn, "");
 	this->threads = getIntAttr("threads", depFn, 4);
 	this->translatorVerbosity = getEnumInt("translatorVerbosity", depFn);
+	// the enum fields of translatorVerbosity follow Logging::LogLevel
+	Logging::setLogLevel((Logging::LogLevel)this->translatorVerbosity);
 	this->rendererVerbosity = getEnumInt("rendererVerbosity", depFn);
 	this->useSunLightConnection = getBoolAttr("useSunLightConnection", depFn, false);
 	this->tilesize = getIntAttr("tileSize", depFn, 64);
 	this->sceneScale = getFloatAttr("sceneScale", depFn, 1.0f);
 	this->filterSize = getFloatAttr("filterSize", depFn, 3.0f);
+	this->useOptimizedTextures = getBoolAttr("useOptimizedTextures", depFn, false);
+	this->optimizedTexturePath = getStringAttr("optimizedTexturePath", depFn, "");
+	this->traceTranslation = getBoolAttr("traceTranslation", depFn, false);
+	this->traceFilePath = getStringAttr("traceFilePath", depFn, "");
+	this->sceneStatistics = getBoolAttr("sceneStatistics", depFn, false);
+	this->statisticsFilePath = getStringAttr("statisticsFilePath", depFn, "");
+	this->pipelineSequence = getBoolAttr("pipelineSequence", depFn, false);
+	this->framesInFlight = getIntAttr("framesInFlight", depFn, 1);
+	this->pipelineFilePath = getStringAttr("pipelineFilePath", depFn, "");
+	this->checkpoints = getBoolAttr("checkpoints", depFn, false);
+	this->checkpointInterval = getFloatAttr("checkpointInterval", depFn, 15.0f);
+	this->checkpointFilePath = getStringAttr("checkpointFilePath", depFn, "");
+	this->regionCulling = getBoolAttr("regionCulling", depFn, false);
+	this->regionCullingMargin = getFloatAttr("regionCullingMargin", depFn, 0.1f);
+	this->frustumCulling = getBoolAttr("frustumCulling", depFn, false);
+	this->frustumCullingMargin = getFloatAttr("frustumCullingMargin", depFn, 0.1f);
+	this->cullingRayMargin = getFloatAttr("cullingRayMargin", depFn, 0.0f);
+	this->minScreenSize = getFloatAttr("minScreenSize", depFn, 0.0f);
 	this->good = true;
 	return true;
 }
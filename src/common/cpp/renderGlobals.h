@@ -153,6 +153,9 @@ public:
 	float mbStartTime; // frame relative start time e.g. -0.2 frames
 	float mbEndTime; // frame relative end time e.g. 0.2 frames
 	float mbLength; // absolute length of motion blur, e.g. 0.4 frames
+	bool useVelocityMb; // derive deformation steps from vertex velocities if a mesh has some
+	MString velocitySetName; // name of the velocity color set or vector array attribute
+	float velocityScale;
 	bool doDof;
 	int bitdepth; // 8, 16, 16halfFloat, 32float
 	
@@ -198,6 +201,7 @@ public:
 	void setUseRenderRegion(bool useRegion){ useRenderRegion = useRegion; checkRenderRegion(); };
 	bool getUseRenderRegion() { return useRenderRegion; };
 	void getRenderRegion(int& left, int& bottom, int& right, int& top) { left = regionLeft; bottom = regionBottom; right = regionRight; top = regionTop; };
+	void setRenderRegion(int left, int bottom, int right, int top) { regionLeft = left; regionBottom = bottom; regionRight = right; regionTop = top; };
 	bool detectShapeDeform;
 	bool exportSceneFile;
 	MString exportSceneFileName;
@@ -211,6 +215,22 @@ public:
 	float sceneScale;
 	MString optimizedTexturePath;
 	bool useOptimizedTextures;
+	bool traceTranslation;
+	MString traceFilePath;
+	bool sceneStatistics;
+	MString statisticsFilePath;
+	bool pipelineSequence;
+	int framesInFlight;
+	MString pipelineFilePath;
+	bool checkpoints;
+	float checkpointInterval;
+	MString checkpointFilePath;
+	bool regionCulling;
+	float regionCullingMargin;
+	bool frustumCulling;
+	float frustumCullingMargin;
+	float cullingRayMargin;
+	float minScreenSize;
 
 	std::vector<RenderPass *> renderPasses;
 	RenderPass *currentRenderPass;
@@ -222,6 +242,8 @@ public:
 	bool getMbSteps();
 	bool isTransformStep();
 	bool isDeformStep();
+	void getGeoStepTimes(std::vector<float>& times); // frame relative times of all deformation steps
+	void removeGeoSteps(); // remove deform only steps if no object needs a real geometry evaluation
 	void getImageName();
 	MString getImageOutputFile();
 	MString getImageExt();
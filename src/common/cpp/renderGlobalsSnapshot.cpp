@@ -0,0 +1,222 @@
+#include "renderGlobalsSnapshot.h"
+#include <atomic>
+#include <maya/MFnDependencyNode.h>
+#include <maya/MFnAttribute.h>
+#include <maya/MFnNumericAttribute.h>
+#include <maya/MFnNumericData.h>
+#include <maya/MFnEnumAttribute.h>
+#include <maya/MFnTypedAttribute.h>
+#include <maya/MFnData.h>
+#include <maya/MNodeMessage.h>
+#include "utilities/tools.h"
+#include "utilities/logging.h"
+
+static std::atomic<unsigned int> snapshotVersion(0);
+static RenderGlobalsSnapshotPtr currentSnapshot;
+static MCallbackId snapshotCallbackId = 0;
+// returned before the first update, the getters return the default values
+static const RenderGlobalsSnapshotPtr emptySnapshot = std::make_shared<const RenderGlobalsSnapshot>(MObject());
+
+RenderGlobalsSnapshot::RenderGlobalsSnapshot(MObject globalsNode) : version(++snapshotVersion)
+{
+	if (globalsNode.isNull())
+		return;
+	MFnDependencyNode depFn(globalsNode);
+	for (unsigned int i = 0; i < depFn.attributeCount(); i++)
+	{
+		MObject attr = depFn.attribute(i);
+		MFnAttribute attrFn(attr);
+		if (attrFn.isArray() || !attrFn.isReadable())
+			continue;
+		MPlug plug = depFn.findPlug(attr, false);
+		if (plug.isNull())
+			continue;
+		Value value;
+		if (readValue(plug, value))
+			this->values[attrFn.name().asChar()] = value;
+	}
+}
+
+bool RenderGlobalsSnapshot::readValue(const MPlug& plug, Value& value)
+{
+	MObject attr = plug.attribute();
+	value.numbers[0] = value.numbers[1] = value.numbers[2] = 0.0;
+	if (attr.hasFn(MFn::kNumericAttribute))
+	{
+		MFnNumericAttribute numFn(attr);
+		switch (numFn.unitType())
+		{
+		case MFnNumericData::kBoolean:
+			value.type = VALUE_BOOL;
+			value.numbers[0] = plug.asBool() ? 1.0 : 0.0;
+			return true;
+		case MFnNumericData::kByte:
+		case MFnNumericData::kChar:
+		case MFnNumericData::kShort:
+		case MFnNumericData::kInt:
+			value.type = VALUE_INT;
+			value.numbers[0] = plug.asInt();
+			return true;
+		case MFnNumericData::kFloat:
+		case MFnNumericData::kDouble:
+			value.type = VALUE_FLOAT;
+			value.numbers[0] = plug.asDouble();
+			return true;
+		case MFnNumericData::k3Float:
+		case MFnNumericData::k3Double:
+			if (plug.numChildren() != 3)
+				return false;
+			value.type = VALUE_COLOR;
+			for (unsigned int c = 0; c < 3; c++)
+				value.numbers[c] = plug.child(c).asDouble();
+			return true;
+		default:
+			return false;
+		}
+	}
+	if (attr.hasFn(MFn::kEnumAttribute))
+	{
+		MFnEnumAttribute enumFn(attr);
+		value.type = VALUE_INT;
+		short enumValue = plug.asShort();
+		value.numbers[0] = enumValue;
+		value.text = enumFn.fieldName(enumValue).asChar();
+		return true;
+	}
+	if (attr.hasFn(MFn::kTypedAttribute))
+	{
+		MFnTypedAttribute typedFn(attr);
+		if (typedFn.attrType() != MFnData::kString)
+			return false;
+		value.type = VALUE_STRING;
+		value.text = plug.asString().asChar();
+		return true;
+	}
+	// distances and angles are saved in internal units
+	if (attr.hasFn(MFn::kUnitAttribute))
+	{
+		value.type = VALUE_FLOAT;
+		value.numbers[0] = plug.asDouble();
+		return true;
+	}
+	return false;
+}
+
+const RenderGlobalsSnapshot::Value *RenderGlobalsSnapshot::find(const char *attrName) const
+{
+	auto it = this->values.find(attrName);
+	if (it == this->values.end())
+		return nullptr;
+	return &it->second;
+}
+
+bool RenderGlobalsSnapshot::hasAttr(const char *attrName) const
+{
+	return this->find(attrName) != nullptr;
+}
+
+bool RenderGlobalsSnapshot::getBool(const char *attrName, bool defaultValue) const
+{
+	const Value *value = this->find(attrName);
+	if ((value == nullptr) || (value->type == VALUE_STRING) || (value->type == VALUE_COLOR))
+		return defaultValue;
+	return value->numbers[0] != 0.0;
+}
+
+int RenderGlobalsSnapshot::getInt(const char *attrName, int defaultValue) const
+{
+	const Value *value = this->find(attrName);
+	if ((value == nullptr) || (value->type == VALUE_STRING) || (value->type == VALUE_COLOR))
+		return defaultValue;
+	return (int)value->numbers[0];
+}
+
+float RenderGlobalsSnapshot::getFloat(const char *attrName, float defaultValue) const
+{
+	const Value *value = this->find(attrName);
+	if ((value == nullptr) || (value->type == VALUE_STRING) || (value->type == VALUE_COLOR))
+		return defaultValue;
+	return (float)value->numbers[0];
+}
+
+MString RenderGlobalsSnapshot::getString(const char *attrName, MString defaultValue) const
+{
+	const Value *value = this->find(attrName);
+	if ((value == nullptr) || (value->type != VALUE_STRING))
+		return defaultValue;
+	return MString(value->text.c_str());
+}
+
+MString RenderGlobalsSnapshot::getEnumString(const char *attrName, MString defaultValue) const
+{
+	const Value *value = this->find(attrName);
+	if ((value == nullptr) || (value->type != VALUE_INT) || value->text.empty())
+		return defaultValue;
+	return MString(value->text.c_str());
+}
+
+MColor RenderGlobalsSnapshot::getColor(const char *attrName, MColor defaultValue) const
+{
+	const Value *value = this->find(attrName);
+	if ((value == nullptr) || (value->type != VALUE_COLOR))
+		return defaultValue;
+	return MColor((float)value->numbers[0], (float)value->numbers[1], (float)value->numbers[2]);
+}
+
+void updateRenderGlobalsSnapshot()
+{
+	RenderGlobalsSnapshotPtr snapshot = std::make_shared<const RenderGlobalsSnapshot>(getRenderGlobalsNode());
+	std::atomic_store(&currentSnapshot, snapshot);
+	Logging::debug(MString("RenderGlobalsSnapshot: read ") + (int)snapshot->size() + " attributes.");
+}
+
+void updateRenderGlobalsSnapshotAttr(const MPlug& plug)
+{
+	// the color is saved in the parent plug, not in its children
+	MPlug valuePlug = plug;
+	if (plug.isChild())
+		valuePlug = plug.parent();
+	RenderGlobalsSnapshot::Value value;
+	if (!RenderGlobalsSnapshot::readValue(valuePlug, value))
+		return;
+	RenderGlobalsSnapshotPtr oldSnapshot = getRenderGlobalsSnapshot();
+	std::shared_ptr<RenderGlobalsSnapshot> snapshot = std::make_shared<RenderGlobalsSnapshot>(*oldSnapshot);
+	snapshot->version = ++snapshotVersion;
+	snapshot->values[MFnAttribute(valuePlug.attribute()).name().asChar()] = value;
+	std::atomic_store(&currentSnapshot, RenderGlobalsSnapshotPtr(snapshot));
+}
+
+RenderGlobalsSnapshotPtr getRenderGlobalsSnapshot()
+{
+	RenderGlobalsSnapshotPtr snapshot = std::atomic_load(&currentSnapshot);
+	if (snapshot)
+		return snapshot;
+	return emptySnapshot;
+}
+
+static void snapshotAttributeChangedCallback(MNodeMessage::AttributeMessage msg, MPlug& plug, MPlug& otherPlug, void *userPtr)
+{
+	if (msg & MNodeMessage::kAttributeSet)
+		updateRenderGlobalsSnapshotAttr(plug);
+}
+
+void addRenderGlobalsSnapshotCallback()
+{
+	removeRenderGlobalsSnapshotCallback();
+	MObject globalsNode = getRenderGlobalsNode();
+	if (globalsNode.isNull())
+		return;
+	MStatus stat;
+	MCallbackId id = MNodeMessage::addAttributeChangedCallback(globalsNode, snapshotAttributeChangedCallback, nullptr, &stat);
+	if (stat)
+		snapshotCallbackId = id;
+	else
+		Logging::error(MString("RenderGlobalsSnapshot: unable to add attribute callback: ") + stat.errorString());
+}
+
+void removeRenderGlobalsSnapshotCallback()
+{
+	if (snapshotCallbackId != 0)
+		MMessage::removeCallback(snapshotCallbackId);
+	snapshotCallbackId = 0;
+}
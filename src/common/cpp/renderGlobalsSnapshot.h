@@ -0,0 +1,77 @@
+#ifndef MAYA_RENDERGLOBALS_SNAPSHOT_H
+#define MAYA_RENDERGLOBALS_SNAPSHOT_H
+
+/*
+	A copy of all attribute values of the renderer globals node (e.g. coronaGlobals).
+
+	Reading attributes with MFnDependencyNode is only allowed in the main thread, but the framebuffer callbacks and
+	the image output run in other threads. So the main thread reads all attributes once per frame into a snapshot
+	and updates it if an attribute changes. A snapshot is never modified after it is published, every update creates
+	a new one, so the render threads can keep and read their snapshot without any lock.
+*/
+
+#include <maya/MObject.h>
+#include <maya/MString.h>
+#include <maya/MColor.h>
+#include <maya/MPlug.h>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+class RenderGlobalsSnapshot
+{
+public:
+	// reads all readable attributes of the globals node, main thread only
+	explicit RenderGlobalsSnapshot(MObject globalsNode);
+
+	bool hasAttr(const char *attrName) const;
+	bool getBool(const char *attrName, bool defaultValue) const;
+	int getInt(const char *attrName, int defaultValue) const;
+	float getFloat(const char *attrName, float defaultValue) const;
+	MString getString(const char *attrName, MString defaultValue) const;
+	// enum attributes return the field name, the value with getInt()
+	MString getEnumString(const char *attrName, MString defaultValue) const;
+	MColor getColor(const char *attrName, MColor defaultValue = MColor(1, 0, 1)) const;
+
+	// incremented with every new snapshot, a thread can check if its copy is outdated
+	unsigned int getVersion() const { return this->version; }
+	size_t size() const { return this->values.size(); }
+
+private:
+	friend void updateRenderGlobalsSnapshotAttr(const MPlug& plug);
+
+	enum ValueType{
+		VALUE_BOOL,
+		VALUE_INT,
+		VALUE_FLOAT,
+		VALUE_STRING,
+		VALUE_COLOR
+	};
+	struct Value{
+		ValueType type;
+		double numbers[3];
+		// string attributes and the field name of enum attributes
+		std::string text;
+	};
+	// returns false if the attribute type is not supported, e.g. messages and matrices
+	static bool readValue(const MPlug& plug, Value& value);
+	const Value *find(const char *attrName) const;
+
+	std::unordered_map<std::string, Value> values;
+	unsigned int version;
+};
+
+typedef std::shared_ptr<const RenderGlobalsSnapshot> RenderGlobalsSnapshotPtr;
+
+// main thread: reads the globals node again and publishes the new snapshot
+void updateRenderGlobalsSnapshot();
+// main thread: copies the current snapshot with the new value of the modified attribute
+void updateRenderGlobalsSnapshotAttr(const MPlug& plug);
+// any thread: returns the current snapshot, an empty one which returns the default values if none was created yet
+RenderGlobalsSnapshotPtr getRenderGlobalsSnapshot();
+
+// keep the snapshot up to date while rendering, the callback is added to the current globals node
+void addRenderGlobalsSnapshotCallback();
+void removeRenderGlobalsSnapshotCallback();
+
+#endif
@@ -5,32 +5,64 @@
 #include "renderGlobals.h"
 #include "mayaScene.h"
 #include "utilities/logging.h"
+#include "utilities/tracing.h"
+#include "utilities/smoothMeshCache.h"
+#include "shadingtools/material.h"
+#include "memory/memoryInfo.h"
 #include "threads/renderQueueWorker.h"
+#include "threads/cancelToken.h"
 
 namespace RenderProcess{
 
-	void doPreRenderJobs(){}
+	void doPreRenderJobs()
+	{
+		TRACE_ZONE("RenderProcess::doPreRenderJobs");
+	}
 	
 	void doPreFrameJobs()
 	{
+		TRACE_ZONE("RenderProcess::doPreFrameJobs");
 		MString result;
 		MGlobal::executeCommand(MayaTo::getWorldPtr()->worldRenderGlobalsPtr->preFrameScript, result, true);
 	}
-	void doPostFrameJobs()
+	void doPostFrameScript()
 	{
 		MString result;
 		MGlobal::executeCommand(MayaTo::getWorldPtr()->worldRenderGlobalsPtr->postFrameScript, result, true);
 	}
+	void doPostFrameJobs(bool runPostFrameScript)
+	{
+		TRACE_ZONE("RenderProcess::doPostFrameJobs");
+		if (runPostFrameScript)
+			doPostFrameScript();
+		// smooth meshes of objects which were not translated in this frame are not needed for the next one
+		MayaTo::getSmoothMeshCache().removeUnusedEntries();
+	}
 
-	void doPostRenderJobs(){}
+	void doPostRenderJobs()
+	{
+		// smoothed meshes, stencils and translated materials are only useful during one render session
+		MayaTo::getSmoothMeshCache().clear();
+		getMaterialCache().clear();
+	}
 	void doPrepareFrame()
 	{
+		TRACE_ZONE("RenderProcess::doPrepareFrame");
 		float currentFrame = MayaTo::getWorldPtr()->worldRenderGlobalsPtr->getFrameNumber();
 		std::shared_ptr<MayaScene> mayaScene = MayaTo::getWorldPtr()->worldScenePtr;
 		Logging::progress(MString("\n========== doPrepareFrame ") + currentFrame + " ==============\n");
+		resetMemoryPhases();
+		setMemoryPhase(MEMPHASE_PARSE);
 
 		mayaScene->parseScene();
+		if (MayaTo::isRenderCancelled())
+			return;
 		MayaTo::getWorldPtr()->worldRenderGlobalsPtr->getMbSteps();
+		if (mayaScene->updateVelocityMotionBlur())
+		{
+			Logging::debug("All deforming shapes are meshes with velocity motionblur, removing deform steps.");
+			MayaTo::getWorldPtr()->worldRenderGlobalsPtr->removeGeoSteps();
+		}
 
 		if (MayaTo::getWorldPtr()->worldRenderGlobalsPtr->mbElementList.size() == 0)
 		{
@@ -42,14 +74,14 @@ namespace RenderProcess{
 
 		for (auto camera : mayaScene->camList)
 		{
-			if (!isCameraRenderable(camera->mobject) && (!(camera->dagPath == mayaScene->uiCamera)))
+			if (!mayaScene->isRenderCamera(camera))
 			{
-				Logging::debug(MString("Camera ") + camera->shortName + " is not renderable, skipping.");
+				LOG_DEBUG(MString("Camera ") + camera->shortName + " is not renderable, skipping.");
 				continue;
 			}
 			Logging::info(MString("Rendering camera ") + camera->shortName);
 
-			for (int mbStepId = 0; mbStepId < numMbSteps; mbStepId++)
+			for (int mbStepId = 0; (mbStepId < numMbSteps) && !MayaTo::isRenderCancelled(); mbStepId++)
 			{
 				MayaTo::getWorldPtr()->worldRenderGlobalsPtr->currentMbStep = mbStepId;
 				MayaTo::getWorldPtr()->worldRenderGlobalsPtr->currentMbElement = MayaTo::getWorldPtr()->worldRenderGlobalsPtr->mbElementList[mbStepId];
@@ -91,6 +123,7 @@ namespace RenderProcess{
 
 	void doFrameJobs()
 	{
+		TRACE_ZONE("RenderProcess::doFrameJobs");
 		Logging::debug("doFrameJobs()");
 		std::shared_ptr<MayaScene> mayaScene = MayaTo::getWorldPtr()->worldScenePtr;
 		float currentFrame = MayaTo::getWorldPtr()->worldRenderGlobalsPtr->currentFrame;
@@ -109,9 +142,9 @@ namespace RenderProcess{
 
 		for (auto camera:mayaScene->camList)
 		{
-			if (!isCameraRenderable(camera->mobject) && (!(camera->dagPath == mayaScene->uiCamera)))
+			if (!mayaScene->isRenderCamera(camera))
 			{
-				Logging::debug(MString("Camera ") + camera->shortName + " is not renderable, skipping.");
+				LOG_DEBUG(MString("Camera ") + camera->shortName + " is not renderable, skipping.");
 				continue;
 			}
 			Logging::info(MString("Rendering camera ") + camera->shortName);
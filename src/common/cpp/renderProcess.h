@@ -4,7 +4,8 @@
 namespace RenderProcess{
 	void doPreRenderJobs();
 	void doPreFrameJobs();
-	void doPostFrameJobs();
+	void doPostFrameScript();
+	void doPostFrameJobs(bool runPostFrameScript = true);
 	void doPostRenderJobs();
 	void doFrameJobs();
 	void doPrepareFrame();
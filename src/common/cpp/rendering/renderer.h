@@ -15,6 +15,9 @@ namespace MayaTo{
 
 	public:
 		std::vector<InteractiveElement *>  interactiveUpdateList;
+		// set by render() if the frame was rendered to the end. A missing license, an error or a cancelled rendering
+		// leave it false, so the checkpoint of the frame is kept for the next try.
+		bool frameCompleted = false;
 		virtual ~Renderer() {};
 		virtual void defineCamera() = 0;
 		virtual void defineEnvironment() = 0;
@@ -45,6 +48,29 @@ namespace MayaTo{
 		virtual void abortRendering() = 0;
 		// make an interactive update of the scene. Before this call the interactiveUpdateList should be filled appropriatly
 		virtual void doInteractiveUpdate() = 0;
+		// IPR: returns true if the renderer can apply changes up to this IPRUpdateCost while it is rendering.
+		// In this case requestLiveUpdate() is called instead of abortRendering() and the renderer has to call
+		// RenderQueueWorker::applyLiveUpdates() as soon as it is safe to modify its scene.
+		virtual bool canUpdateWhileRendering(int maxUpdateCost){ return false; }
+		virtual void requestLiveUpdate(){}
+		// Pipelined sequence rendering: if the renderer can write a frame into a scene file for its standalone renderer,
+		// exportSceneFile() is called instead of render() and the file is rendered in a child process with the command
+		// of getSceneFileRenderCommand(). This way the next frame can be translated while the current one is rendered.
+		virtual bool canRenderSceneFile(){ return false; }
+		virtual MString getSceneFileExtension(){ return ""; }
+		virtual bool exportSceneFile(const MString& sceneFile){ return false; }
+		virtual MString getSceneFileRenderCommand(const MString& sceneFile, const MString& imageFile){ return ""; }
+		// Checkpoints of progressive renderings: writeCheckpoint() is called from another thread while the renderer renders and
+		// saves the accumulated samples in the renderer's own format. resumeFromCheckpoint() is called before render() if a
+		// checkpoint of the frame exists, the rendering should continue with these samples.
+		virtual bool canCheckpoint(){ return false; }
+		virtual MString getCheckpointExtension(){ return ""; }
+		virtual bool writeCheckpoint(const MString& fileName){ return false; }
+		virtual bool resumeFromCheckpoint(const MString& fileName){ return false; }
+		// IPR: the render region was changed in the render view, the new region is already set in the render globals.
+		// A renderer which can render the new region with its existing scene returns true, it is restarted then like for
+		// a cheap scene update. Otherwise the region is used with the next IPR start.
+		virtual bool updateRenderRegion(){ return false; }
 		virtual void handleUserEvent(int event, MString strData, float floatData, int intData) = 0;
 	private:
 
@@ -4,6 +4,11 @@
 #include <maya/MFnNurbsSurface.h>
 #include <maya/MFnMesh.h>
 #include <maya/MItMeshPolygon.h>
+#include <maya/MObjectHandle.h>
+#include <maya/MFnAttribute.h>
+#include <maya/MFnTypedAttribute.h>
+#include <maya/MFnMatrixData.h>
+#include <maya/MMatrix.h>
 
 #include "material.h"
 #include "utilities/attrTools.h"
@@ -13,6 +18,82 @@
 #include "shadingTools/shaderDefs.h"
 
 static Logging logger;
+
+namespace{
+
+	unsigned long long hashBytes(const void *data, size_t numBytes, unsigned long long hash)
+	{
+		const unsigned char *bytes = (const unsigned char *)data;
+		for (size_t i = 0; i < numBytes; i++)
+		{
+			hash ^= bytes[i];
+			hash *= 1099511628211ULL;
+		}
+		return hash;
+	}
+
+	template<typename T> unsigned long long hashValue(T value, unsigned long long hash)
+	{
+		return hashBytes(&value, sizeof(T), hash);
+	}
+
+	unsigned long long hashString(const MString& s, unsigned long long hash)
+	{
+		hash = hashValue(s.length(), hash);
+		return hashBytes(s.asChar(), s.length(), hash);
+	}
+
+	// hashes the value of a plug, arrays and compounds like ramps or colors are hashed with all their elements
+	// plugs connected to another node of the network are skipped, the connection is part of the network hash
+	unsigned long long hashPlugValue(MPlug& plug, ShadingNetwork& network, unsigned long long hash)
+	{
+		if (plug.isDestination())
+		{
+			MPlugArray sourcePlugs;
+			plug.connectedTo(sourcePlugs, true, false);
+			if ((sourcePlugs.length() > 0) && (network.getNodeIndex(sourcePlugs[0].node()) > -1))
+				return hash;
+		}
+		if (plug.isArray())
+		{
+			hash = hashValue(plug.numElements(), hash);
+			for (uint i = 0; i < plug.numElements(); i++)
+			{
+				MPlug element = plug.elementByPhysicalIndex(i);
+				hash = hashValue(element.logicalIndex(), hash);
+				hash = hashPlugValue(element, network, hash);
+			}
+			return hash;
+		}
+		if (plug.isCompound())
+		{
+			for (uint i = 0; i < plug.numChildren(); i++)
+			{
+				MPlug child = plug.child(i);
+				hash = hashPlugValue(child, network, hash);
+			}
+			return hash;
+		}
+		MObject attr = plug.attribute();
+		if (attr.hasFn(MFn::kMessageAttribute))
+			return hash;
+		if (attr.hasFn(MFn::kTypedAttribute))
+		{
+			MFnTypedAttribute tAttr(attr);
+			if (tAttr.attrType() == MFnData::kString)
+				return hashString(plug.asString(), hash);
+			if (tAttr.attrType() == MFnData::kMatrix)
+			{
+				MFnMatrixData matrixData(plug.asMObject());
+				MMatrix matrix = matrixData.matrix();
+				return hashBytes(matrix.matrix, sizeof(double) * 16, hash);
+			}
+			return hash;
+		}
+		return hashValue(plug.asDouble(), hash);
+	}
+}
+
 ShadingNetwork::ShadingNetwork(MObject& node) : rootNode(node)
 {
 	this->rootNodeName = getObjectName(node);
@@ -67,14 +148,14 @@ void ShadingNetwork::parseNetwork(MObject& shaderNode)
 
 	if (sn.nodeState == ShadingNode::INVALID)
 	{
-		Logging::debug(MString("Node is not supported (INVALID): ") + getObjectName(shaderNode));
+		LOG_DEBUG(MString("Node is not supported (INVALID): ") + getObjectName(shaderNode));
 		return;
 	}
 
-	// to avoid any dg node cycles
-	if (alreadyDefined(sn))
+	// the node is marked before its inputs are parsed, this way dg node cycles are no problem
+	if (!markVisited(sn.mobject))
 	{
-		Logging::debug("Node is already defined, skipping.");
+		LOG_DEBUG("Node is already defined, skipping.");
 		return;
 	}
 
@@ -82,12 +163,10 @@ void ShadingNetwork::parseNetwork(MObject& shaderNode)
 	sn.getConnectedInputObjects(connectedNodeList);
 	this->checkNodeList(connectedNodeList);
 
-	Logging::debug(MString("Node ") + sn.fullName + " has " + connectedNodeList.length() + " input connections.");
+	LOG_DEBUG(MString("Node ") + sn.fullName + " has " + connectedNodeList.length() + " input connections.");
 
 	for (uint i = 0; i < connectedNodeList.length(); i++)
 	{
-
-		MString connectedNode = getObjectName(connectedNodeList[i]);
 		ShadingNode source = findShadingNode(connectedNodeList[i]);
 		if (hasValidShadingNodeConnections(source, sn))
 		{
@@ -95,19 +174,44 @@ void ShadingNetwork::parseNetwork(MObject& shaderNode)
 		}
 	}
 
+	// all inputs are defined now, so the node can be placed behind them
+	findVisited(sn.mobject)->index = (int)shaderList.size();
 	shaderList.push_back(sn);
 }
 
-bool ShadingNetwork::alreadyDefined(ShadingNode& sn)
+ShadingNetwork::VisitedNode *ShadingNetwork::findVisited(const MObject& node)
 {
-	for (int i = 0; i < (int)shaderList.size(); i++)
+	auto range = visitedNodes.equal_range(MObjectHandle(node).hashCode());
+	for (auto it = range.first; it != range.second; it++)
 	{
-		if (shaderList[i].mobject == sn.mobject)
-		{
-			return true;
-		}
+		if (it->second.node == node)
+			return &it->second;
 	}
-	return false;
+	return nullptr;
+}
+
+bool ShadingNetwork::markVisited(MObject& node)
+{
+	if (findVisited(node) != nullptr)
+		return false;
+	VisitedNode visited;
+	visited.node = node;
+	visited.index = -1;
+	visitedNodes.insert(std::make_pair(MObjectHandle(node).hashCode(), visited));
+	return true;
+}
+
+int ShadingNetwork::getNodeIndex(const MObject& node)
+{
+	VisitedNode *visited = findVisited(node);
+	if (visited == nullptr)
+		return -1;
+	return visited->index;
+}
+
+bool ShadingNetwork::alreadyDefined(ShadingNode& sn)
+{
+	return getNodeIndex(sn.mobject) > -1;
 }
 
 void ShadingNetwork::checkNodeList(MObjectArray& mobjectArray)
@@ -122,105 +226,104 @@ void ShadingNetwork::checkNodeList(MObjectArray& mobjectArray)
 	mobjectArray = cleanArray;
 }
 
-void Material::checkNodeList(MObjectArray& nodeList)
-{
-	MObjectArray cleanArray;
-	for( uint oId = 0; oId < nodeList.length(); oId++)
-	{
-		ShadingNode sn = findShadingNode(nodeList[oId]);
-		if( sn.nodeState == ShadingNode::VALID)
-			cleanArray.append(nodeList[oId]);
-	}
-	nodeList = cleanArray;
-}
-
-// already defined means it appears more than 100 times. See material.h for a detailed explanation.
-bool Material::alreadyDefined(ShadingNode& sn, ShadingNetwork& network)
+unsigned long long ShadingNetwork::getHash()
 {
-	int occurences = 0;
-	for( int i = 0; i < (int)network.shaderList.size(); i++)
+	unsigned long long hash = 14695981039346656037ULL;
+	hash = hashValue(this->shaderList.size(), hash);
+	for (size_t nodeId = 0; nodeId < this->shaderList.size(); nodeId++)
 	{
-		if( network.shaderList[i].mobject == sn.mobject)
-		{
-			occurences++;
-		}
-	}
-	return occurences < 100;
-}
+		ShadingNode& sn = this->shaderList[nodeId];
+		hash = hashString(sn.typeName, hash);
+		MFnDependencyNode depFn(sn.mobject);
 
-// "source" is the node which is connected to the inputs of "dest"
-// the dest connections are already checked previously so we only have to check the 
-// outgoing connections from "source" for validity
-bool Material::hasValidShadingNodeConnections(ShadingNode& source, ShadingNode& dest)
-{
-	MPlugArray connectedOutPlugs;
-	MStatus stat;
-	MFnDependencyNode destFn(dest.mobject);
-	MObjectArray objectList;
-	int connCount = 0;
-	MPlugArray plugArray;
-	MPlugArray validPlugs;
-	destFn.getConnections(plugArray);
-	for (uint pId = 0; pId < plugArray.length(); pId++)
-	{
-		MString pname = plugArray[pId].name();
-		if (dest.isInPlugValid(plugArray[pId]))
+		// the supported input attributes, connected inputs are evaluated through the connection
+		for (size_t attrId = 0; attrId < sn.inputAttributes.size(); attrId++)
 		{
-			validPlugs.append(plugArray[pId]);
+			MStatus stat;
+			MPlug plug = depFn.findPlug(sn.inputAttributes[attrId].name.c_str(), &stat);
+			if (!stat)
+				continue;
+			hash = hashValue(attrId, hash);
+			hash = hashPlugValue(plug, *this, hash);
 		}
-	}
 
-	for (uint pId = 0; pId < validPlugs.length(); pId++)
-	{
-		MPlugArray sourcePlugs;
-		validPlugs[pId].connectedTo(sourcePlugs, true, false);
-		for (uint spId = 0; spId < sourcePlugs.length(); spId++)
+		// connections inside the network are described by the node indices, not by the node names
+		MPlugArray connections;
+		depFn.getConnections(connections);
+		for (uint connId = 0; connId < connections.length(); connId++)
 		{
-			MString pname = sourcePlugs[spId].name();
-			if (source.isOutPlugValid(sourcePlugs[spId]))
+			if (!connections[connId].isDestination())
+				continue;
+			MPlugArray sourcePlugs;
+			connections[connId].connectedTo(sourcePlugs, true, false);
+			for (uint spId = 0; spId < sourcePlugs.length(); spId++)
 			{
-				return true;
+				int sourceIndex = this->getNodeIndex(sourcePlugs[spId].node());
+				if (sourceIndex < 0)
+					continue;
+				hash = hashValue(sourceIndex, hash);
+				hash = hashString(sourcePlugs[spId].partialName(false, false, false, false, false, true), hash);
+				hash = hashString(connections[connId].partialName(false, false, false, false, false, true), hash);
 			}
 		}
 	}
-	return false;
+	return hash;
 }
 
-void Material::parseNetwork(MObject& shaderNode, ShadingNetwork& network)
+bool MaterialCache::findMaterial(unsigned long long networkHash, MString& materialName)
 {
-	ShadingNode sn = findShadingNode(shaderNode);
+	auto it = this->materialNames.find(networkHash);
+	if (it == this->materialNames.end())
+		return false;
+	materialName = it->second;
+	return true;
+}
 
-	if( sn.nodeState == ShadingNode::INVALID)
+void MaterialCache::addMaterial(unsigned long long networkHash, MString materialName)
+{
+	// if the material is translated again with a modified network, the old hash must not point to it any more
+	auto oldHash = this->shadingGroupHashes.find(materialName.asChar());
+	if ((oldHash != this->shadingGroupHashes.end()) && (oldHash->second != networkHash))
 	{
-		Logging::debug(MString("Node is not supported (INVALID): ") + getObjectName(shaderNode));
-		return;
+		auto oldMaterial = this->materialNames.find(oldHash->second);
+		if ((oldMaterial != this->materialNames.end()) && (oldMaterial->second == materialName))
+			this->materialNames.erase(oldMaterial);
 	}
+	this->translatedMaterials++;
+	this->materialNames[networkHash] = materialName;
+	this->shadingGroupHashes[materialName.asChar()] = networkHash;
+}
 
-	// to avoid any dg node cycles
-	if(alreadyDefined(sn, network))
-	{
-		Logging::debug("Node is already defined, skipping.");
-		return;
-	}
-	
-	MObjectArray connectedNodeList;
-	sn.getConnectedInputObjects(connectedNodeList);
-	this->checkNodeList(connectedNodeList);
+bool MaterialCache::hasChanged(MString shadingGroupName, unsigned long long networkHash)
+{
+	auto it = this->shadingGroupHashes.find(shadingGroupName.asChar());
+	if (it == this->shadingGroupHashes.end())
+		return true;
+	return it->second != networkHash;
+}
 
-	Logging::debug(MString("Node ") + sn.fullName + " has " + connectedNodeList.length() + " input connections.");
+void MaterialCache::clear()
+{
+	if ((this->reusedMaterials > 0) || (this->translatedMaterials > 0))
+		Logging::debug(MString("MaterialCache: translated ") + this->translatedMaterials + " materials, reused " + this->reusedMaterials);
+	this->materialNames.clear();
+	this->shadingGroupHashes.clear();
+	this->reusedMaterials = 0;
+	this->translatedMaterials = 0;
+}
 
-	for(uint i = 0; i < connectedNodeList.length(); i++)
-	{
+static MaterialCache globalMaterialCache;
 
-		MString connectedNode = getObjectName(connectedNodeList[i]);
-		ShadingNode source = findShadingNode(connectedNodeList[i]);
-		if( hasValidShadingNodeConnections(source, sn))
-		{
-			parseNetwork(source.mobject, network);
-		}
-	}
+MaterialCache& getMaterialCache()
+{
+	return globalMaterialCache;
+}
 
-	network.shaderList.push_back(sn);
+void Material::parseNetwork(MObject& shaderNode, ShadingNetwork& network)
+{
+	network.rootNode = shaderNode;
+	network.rootNodeName = getObjectName(shaderNode);
+	network.parseNetwork(shaderNode);
 }
 
 void Material::printNodes(ShadingNetwork& network)
@@ -234,23 +337,6 @@ void Material::printNodes(ShadingNetwork& network)
 	}
 }
 
-void Material::cleanNetwork(ShadingNetwork& network)
-{
-	ShadingNodeList cleanList;
-	for (auto sn : network.shaderList)
-	{
-		bool found = false;
-		for (auto cn : cleanList)
-		{
-			if (cn == sn)
-				found = true;
-		}
-		if (!found)
-			cleanList.push_back(sn);
-	}
-	network.shaderList = cleanList;
-}
-
 void Material::parseNetworks()
 {
 	MObject surfaceShaderNode = getOtherSideNode(MString("surfaceShader"), this->shadingEngineNode);
@@ -283,7 +369,7 @@ void Material::parseNetworks()
 		if(miVolumeShaderNode != MObject::kNullObj)
 			volumeShaderNode = miVolumeShaderNode;
 		ShadingNode *sn = nullptr;
-		this->parseNetwork(miVolumeShaderNode, this->volumeShaderNet);
+		this->parseNetwork(volumeShaderNode, this->volumeShaderNet);
 	}
 
 	// read displacement shader hierarchy
@@ -303,10 +389,6 @@ void Material::parseNetworks()
 		ShadingNode *sn = nullptr;
 		this->parseNetwork(this->shadingEngineNode, this->lightShaderNet);
 	}
-	cleanNetwork(this->surfaceShaderNet);
-	cleanNetwork(this->volumeShaderNet);
-	cleanNetwork(this->displacementShaderNet);
-	cleanNetwork(this->lightShaderNet);
 }
 
 Material::Material(MObject &shadingEngine)
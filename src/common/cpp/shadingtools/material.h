@@ -98,8 +98,13 @@
 	place2d
 	ramp
 
-	But now the ramp needs an input from the placement node what would result in an invalid order. To avoid these problem I simply add all nodes and filter later for 
-	duplicates from the back. To avoid cycles, I check for a high amount of the same nodes (>100), simply because i dont know another useful solution.
+	But now the ramp needs an input from the placement node what would result in an invalid order. To avoid this problem, a node is only added to the list
+	after all of its inputs are added (depth first, post order). So the placement node is always placed in front of the ramp and the file node.
+	Every node is marked as visited as soon as we reach it the first time, so it is added only once and cycles in the dg cannot cause an endless loop.
+
+	Big scenes often contain the same look dev network many times, e.g. from referenced asset libraries. To avoid translating them again and again,
+	a network can calculate a hash of its structure: node types, attribute values and connections, but not the node names.
+	Networks with the same hash will look the same, so the renderer can translate them once and reuse the result. See MaterialCache below.
 	*/
 
 #include <maya/MDagPath.h>
@@ -108,6 +113,8 @@
 #include <maya/MIntArray.h>
 
 #include <vector>
+#include <map>
+#include <unordered_map>
 #include "shadingNode.h"
 
 #define SNODE_LIST std::vector<ShadingNode>
@@ -130,8 +137,44 @@ public:
 	bool alreadyDefined(ShadingNode& sn);
 	void checkNodeList(MObjectArray& mobjectArray);
 	bool hasValidShadingNodeConnections(ShadingNode& source, ShadingNode& dest);
+	// structural hash of the network, identical networks with different node names have the same hash
+	unsigned long long getHash();
+	// index of the node in the shaderList or -1
+	int getNodeIndex(const MObject& node);
+private:
+	struct VisitedNode{
+		MObject node;
+		// index in shaderList, -1 as long as the inputs of the node are parsed
+		int index;
+	};
+	// key is the MObjectHandle hash code, different nodes can have the same hash code
+	std::unordered_multimap<unsigned int, VisitedNode> visitedNodes;
+	VisitedNode *findVisited(const MObject& node);
+	bool markVisited(MObject& node);
 };
 
+// Remembers which networks are already translated by the renderer.
+// In a normal rendering, shading groups with the same network hash can share one translated material.
+// In IPR every shading group needs its own material because a shader can be modified, here we only skip the
+// translation if the network of a shading group has not changed.
+class MaterialCache
+{
+public:
+	// returns true if a material with this hash was already translated, materialName is set to the name of the translated material
+	bool findMaterial(unsigned long long networkHash, MString& materialName);
+	void addMaterial(unsigned long long networkHash, MString materialName);
+	// returns true if the network of the shading group was never seen or has a different hash than the last time
+	bool hasChanged(MString shadingGroupName, unsigned long long networkHash);
+	void clear();
+	int reusedMaterials = 0;
+	int translatedMaterials = 0;
+private:
+	std::unordered_map<unsigned long long, MString> materialNames;
+	std::map<std::string, unsigned long long> shadingGroupHashes;
+};
+
+MaterialCache& getMaterialCache();
+
 
 class Material
 {
@@ -155,10 +198,6 @@ public:
 	
 private:
 	void parseNetwork(MObject& shaderNode, ShadingNetwork& network);
-	bool alreadyDefined(ShadingNode& sn, ShadingNetwork& network);
-	void checkNodeList(MObjectArray& nodeList);
-	bool hasValidShadingNodeConnections(ShadingNode& source, ShadingNode& dest);
-	void cleanNetwork(ShadingNetwork& network); // remove any duplicates
 };
 
 #endif
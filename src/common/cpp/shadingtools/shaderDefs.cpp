@@ -113,11 +113,7 @@ bool ShaderDefinitions::validString(std::string& line)
 
 void ShaderDefinitions::readShaderDefinitions()
 {
-
-	ShadingNode sn;
-	std::vector<ShadingNode> snodes;
-	snodes.push_back(sn);
-	this->shadingNodes.push_back(sn);
+	this->shadingNodes.clear();
 
 	Logging::debug(MString("home dir: ") + getRendererHome());
 	Logging::debug(MString("shader defs file: ") + getRendererHome() + "resources/shaderDefinitions.txt");
@@ -134,6 +130,7 @@ void ShaderDefinitions::readShaderDefinitions()
 	std::string line;
 
 	ShadingNode node;
+	std::vector<ShaderAttribute> inputAttributes, outputAttributes;
 
 	do{
 		std::getline(shaderFile, line);
@@ -147,10 +144,14 @@ void ShaderDefinitions::readShaderDefinitions()
 			{
 				// these nodes are automatically valid because they are supported
 				node.nodeState = ShadingNode::VALID;
+				node.inputAttributes = ShaderAttributeList(inputAttributes);
+				node.outputAttributes = ShaderAttributeList(outputAttributes);
 
-				this->shadingNodes.push_back(node);
+				this->shadingNodes[node.typeName.asChar()] = node;
 				// clean up old node
 				node = ShadingNode();
+				inputAttributes.clear();
+				outputAttributes.clear();
 			}
 
 			if(pystring::startswith(line, "shader_start"))
@@ -165,7 +166,7 @@ void ShaderDefinitions::readShaderDefinitions()
 					ShaderAttribute att;
 					att.name = stringArray[1];
 					att.type = stringArray[2];
-					node.inputAttributes.push_back(att);
+					inputAttributes.push_back(att);
 				}
 			}
 			if(pystring::startswith(line, "outatt"))
@@ -175,7 +176,7 @@ void ShaderDefinitions::readShaderDefinitions()
 					ShaderAttribute att;
 					att.name = stringArray[1];
 					att.type = stringArray[2];
-					node.outputAttributes.push_back(att);
+					outputAttributes.push_back(att);
 				}
 			}
 		}
@@ -185,23 +186,27 @@ void ShaderDefinitions::readShaderDefinitions()
 	//Logging::debug("Reading of shader def file done.");
 	shaderFile.close();
 	readDone = true;
+	Logging::debug(MString("Read ") + (int)this->shadingNodes.size() + " shader definitions.");
+}
+
+const ShadingNode *ShaderDefinitions::getDefinition(const MString& typeName) const
+{
+	auto it = this->shadingNodes.find(typeName.asChar());
+	if (it == this->shadingNodes.end())
+		return nullptr;
+	return &it->second;
 }
 
 ShadingNode ShaderDefinitions::findShadingNode(MObject node)
 {
 	ShadingNode sn;
-	MString nodeTypeName = getDepNodeTypeName(node);
-	for(size_t nodeId = 0; nodeId < this->shadingNodes.size(); nodeId++)
+	const ShadingNode *definition = this->getDefinition(getDepNodeTypeName(node));
+	if (definition != nullptr)
 	{
-		//Logging::debug(MString("Searching current node type ") + nodeTypeName + " in supported nodes " + this->shadingNodes[nodeId].typeName);
-		if( this->shadingNodes[nodeId].typeName == nodeTypeName)
-		{
-			// copy attributes to the shading node
-			sn = this->shadingNodes[nodeId];
-			// initialize the shading node with the correct mobject
-			sn.setMObject(node);
-			break;
-		}
+		// the attribute lists are shared, only the names are copied
+		sn = *definition;
+		// initialize the shading node with the correct mobject
+		sn.setMObject(node);
 	}
 	return sn;
 }
@@ -209,36 +214,29 @@ ShadingNode ShaderDefinitions::findShadingNode(MObject node)
 ShadingNode ShaderDefinitions::findShadingNode(MString nodeTypeName)
 {
 	ShadingNode sn;
-	for(size_t nodeId = 0; nodeId < this->shadingNodes.size(); nodeId++)
-	{
-		//Logging::debug(MString("Searching current node type ") + nodeTypeName + " in supported nodes " + this->shadingNodes[nodeId].typeName);
-		if( this->shadingNodes[nodeId].typeName == nodeTypeName)
-		{
-			// copy attributes to the shading node
-			sn = this->shadingNodes[nodeId];
-			break;
-		}
-	}
+	const ShadingNode *definition = this->getDefinition(nodeTypeName);
+	if (definition != nullptr)
+		sn = *definition;
 	return sn;
 }
 
 void ShaderDefinitions::printShaderDefs()
 {
-	for( uint i = 0; i < this->shadingNodes.size(); i++)
+	for (auto& it : this->shadingNodes)
 	{
-		ShadingNode node = shadingNodes[i];
-		Logging::debug(MString("Nodename: ") + node.fullName);
+		const ShadingNode& node = it.second;
+		LOG_DEBUG(MString("Nodename: ") + node.fullName);
 		Logging::debug(MString("In Attributes: "));
 		for( uint p = 0; p < node.inputAttributes.size(); p++)
 		{
-			Logging::debug(MString("\tinattName: ") + node.inputAttributes[p].name.c_str());
-			Logging::debug(MString("\tinattType: ") + node.inputAttributes[p].type.c_str());
+			LOG_DEBUG(MString("\tinattName: ") + node.inputAttributes[p].name.c_str());
+			LOG_DEBUG(MString("\tinattType: ") + node.inputAttributes[p].type.c_str());
 		}
 		Logging::debug(MString("Out Attributes: "));
 		for( uint p = 0; p < node.outputAttributes.size(); p++)
 		{
-			Logging::debug(MString("\tOutAttName: ") + node.outputAttributes[p].name.c_str());
-			Logging::debug(MString("\tOutAttType: ") + node.outputAttributes[p].type.c_str());
+			LOG_DEBUG(MString("\tOutAttName: ") + node.outputAttributes[p].name.c_str());
+			LOG_DEBUG(MString("\tOutAttType: ") + node.outputAttributes[p].type.c_str());
 		}
 	}
 }
@@ -4,14 +4,14 @@
 #include <fstream>
 #include <string>
 #include <vector>
-//#include "shadingNode.h"
-
-class ShadingNode;
+#include <unordered_map>
+#include "shadingNode.h"
 
+// The definitions are read only once and never modified afterwards. The lookup is done by a hash of the type name,
+// the returned shading nodes share their attribute lists with the definition.
 class ShaderDefinitions
 {
 public:
-	std::vector<ShadingNode> shadingNodes;
 	bool readDone;
 
 	ShaderDefinitions();
@@ -21,7 +21,10 @@ public:
 	void printShaderDefs();
 	ShadingNode findShadingNode(MObject mobject);
 	ShadingNode findShadingNode(MString typeName);
+	// returns nullptr if the node type is not supported
+	const ShadingNode *getDefinition(const MString& typeName) const;
 private:
+	std::unordered_map<std::string, ShadingNode> shadingNodes;
 };
 
 ShadingNode findShadingNode(MObject mobject);
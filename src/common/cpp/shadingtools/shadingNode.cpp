@@ -6,6 +6,60 @@
 
 static Logging logger;
 
+ShaderAttributeList::ShaderAttributeList()
+{}
+
+ShaderAttributeList::ShaderAttributeList(const std::vector<ShaderAttribute>& attributes)
+{
+	std::shared_ptr<Data> d = std::make_shared<Data>();
+	d->attributes = attributes;
+	for (size_t i = 0; i < attributes.size(); i++)
+		d->indices[attributes[i].name] = (int)i;
+	this->data = d;
+}
+
+size_t ShaderAttributeList::size() const
+{
+	return this->data ? this->data->attributes.size() : 0;
+}
+
+const ShaderAttribute& ShaderAttributeList::operator[](size_t index) const
+{
+	return this->data->attributes[index];
+}
+
+int ShaderAttributeList::find(const std::string& name) const
+{
+	if (!this->data)
+		return -1;
+	auto it = this->data->indices.find(name);
+	if (it == this->data->indices.end())
+		return -1;
+	return it->second;
+}
+
+int ShaderAttributeList::find(const MString& name) const
+{
+	return this->find(std::string(name.asChar()));
+}
+
+bool ShaderAttributeList::contains(const MString& name) const
+{
+	return this->find(name) > -1;
+}
+
+std::vector<ShaderAttribute>::const_iterator ShaderAttributeList::begin() const
+{
+	static const std::vector<ShaderAttribute> empty;
+	return this->data ? this->data->attributes.begin() : empty.begin();
+}
+
+std::vector<ShaderAttribute>::const_iterator ShaderAttributeList::end() const
+{
+	static const std::vector<ShaderAttribute> empty;
+	return this->data ? this->data->attributes.end() : empty.end();
+}
+
 void ShadingNode::init(void)
 {
 	this->mobject = MObject::kNullObj;
@@ -64,13 +118,7 @@ bool ShadingNode::isInPlugValid(MPlug plug)
 		tmpPlug = tmpPlug.array();
 
 	MString plugName = getAttributeNameFromPlug(tmpPlug);
-
-	for (size_t inattrId = 0; inattrId < this->inputAttributes.size(); inattrId++)
-	{
-		if (plugName == inputAttributes[inattrId].name.c_str())
-			return true;
-	}
-	return false;
+	return this->inputAttributes.contains(plugName);
 }
 
 bool ShadingNode::isOutPlugValid(MPlug plug)
@@ -88,17 +136,15 @@ bool ShadingNode::isOutPlugValid(MPlug plug)
 		tmpPlug = tmpPlug.array();
 
 	MString plugName = getAttributeNameFromPlug(tmpPlug);
-
-	for (size_t attrId = 0; attrId < this->outputAttributes.size(); attrId++)
-	{
-		if (plugName == outputAttributes[attrId].name.c_str())
-			return true;
-	}
-	return false;
+	return this->outputAttributes.contains(plugName);
 }
 
 bool ShadingNode::isAttributeValid(MString attributeName)
 {
+	// first check the definition, this is much cheaper than collecting the connections
+	if (!this->inputAttributes.contains(attributeName))
+		return false;
+
 	MStatus stat;
 	MFnDependencyNode depFn(this->mobject);
 	MPlugArray pa;
@@ -112,13 +158,7 @@ bool ShadingNode::isAttributeValid(MString attributeName)
 				parentPlug = parentPlug.parent();
 			MString plugName = getAttributeNameFromPlug(parentPlug);
 			if (plugName == attributeName)
-			{
-				for (size_t inattrId = 0; inattrId < this->inputAttributes.size(); inattrId++)
-				{
-					if (attributeName == inputAttributes[inattrId].name.c_str())
-						return true;
-				}
-			}
+				return true;
 		}
 	}
 
@@ -152,7 +192,8 @@ void ShadingNode::getConnectedInputObjects(MObjectArray& objectArray)
 		// name contains node.attributeName, so we have to get rid of the nodeName
 		mainPlug.name().split('.', stringArray);
 		MString plugName = stringArray[stringArray.length() - 1];
-		if (!this->isAttributeValid(plugName))
+		// p is already a connected destination, so we only have to check if the attribute is supported
+		if (!this->inputAttributes.contains(plugName))
 			continue;
 		getConnectedInNodes(p, objectList);
 		makeUniqueArray(objectList);
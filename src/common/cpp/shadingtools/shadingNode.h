@@ -7,6 +7,8 @@
 #include <maya/MString.h>
 #include <string>
 #include <vector>
+#include <memory>
+#include <unordered_map>
 
 struct ShaderAttribute
 {
@@ -35,6 +37,31 @@ struct ShaderAttribute
 	MObject connectedMObject;
 };
 
+// The attribute definitions of a node type are read once from the shader definitions file.
+// All shading nodes of this type share the same list, so copying a ShadingNode does not copy the attributes.
+class ShaderAttributeList
+{
+public:
+	ShaderAttributeList();
+	ShaderAttributeList(const std::vector<ShaderAttribute>& attributes);
+
+	size_t size() const;
+	const ShaderAttribute& operator[](size_t index) const;
+	// returns the index of the attribute or -1 if the node type does not support it
+	int find(const std::string& name) const;
+	int find(const MString& name) const;
+	bool contains(const MString& name) const;
+	std::vector<ShaderAttribute>::const_iterator begin() const;
+	std::vector<ShaderAttribute>::const_iterator end() const;
+
+private:
+	struct Data{
+		std::vector<ShaderAttribute> attributes;
+		std::unordered_map<std::string, int> indices;
+	};
+	std::shared_ptr<const Data> data;
+};
+
 #define SPLUG_LIST std::vector<ShadingPlug>
 
 class ShadingNode
@@ -50,8 +77,8 @@ public:
 	MString fullName; //myLambert1, mdivi_number_123
 	MObject mobject;
 	STATE nodeState;
-	std::vector<ShaderAttribute> inputAttributes;
-	std::vector<ShaderAttribute> outputAttributes;
+	ShaderAttributeList inputAttributes;
+	ShaderAttributeList outputAttributes;
 
 	ShadingNode(MObject& object);
 	ShadingNode(const ShadingNode &other);
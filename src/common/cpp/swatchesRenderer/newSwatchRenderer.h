@@ -4,6 +4,9 @@
 #include <maya/MSwatchRenderBase.h> 
 #include <maya/MString.h>
 #include <maya/MPlugArray.h>
+#include <memory>
+
+class SwatchJob;
 
 class NewSwatchRenderer : public MSwatchRenderBase
 {
@@ -23,6 +26,8 @@ public:
 	bool swatchRenderingDone = false;
 	MObject rNode;
 	MObject dNode;
+	// the swatch is rendered by the swatch service, doIteration() polls the job until it is finished
+	std::shared_ptr<SwatchJob> job;
 };
 
 #endif
\ No newline at end of file
@@ -9,6 +9,8 @@
 #include "utilities/tools.h"
 #include "utilities/logging.h"
 #include "swatchRendererInterfaceFactory.h"
+#include "swatchService.h"
+#include "shadingtools/material.h"
 #include "../world.h"
 
 MSwatchRenderBase* SwatchRenderer::creator(MObject dependNode, MObject renderNode, int imageResolution)
@@ -44,10 +46,27 @@ bool SwatchRenderer::doIteration()
 		image().convertPixelFormat(MImage::kByte);
 		return false;
 	}
+
+	// a material which did not change since its last swatch does not need to be rendered again
+	MObject shaderNode = this->node();
+	ShadingNetwork network(shaderNode);
+	unsigned long long networkHash = network.shaderList.empty() ? NO_SWATCH_HASH : network.getHash();
+	size_t numValues = (size_t)resolution() * resolution() * 4;
+	SwatchImageCache& imageCache = getSwatchService().imageCache;
+	std::vector<float> pixels;
+	if (imageCache.get(networkHash, resolution(), pixels) && (pixels.size() == numValues))
+	{
+		memcpy(image().floatPixels(), &pixels[0], numValues * sizeof(float));
+		image().convertPixelFormat(MImage::kByte);
+		return true;
+	}
+
 	MayaTo::getWorldPtr()->setRenderType(MayaTo::MayaToWorld::WorldRenderType::SWATCHRENDER);
 	MayaTo::getWorldPtr()->setRenderState(MayaTo::MayaToWorld::WorldRenderState::RSTATESWATCHRENDERING);
 	this->renderInterface->renderSwatch();
 	this->renderInterface->getImageData(this->image());
+	pixels.assign(image().floatPixels(), image().floatPixels() + numValues);
+	imageCache.put(networkHash, resolution(), pixels);
 	image().convertPixelFormat(MImage::kByte);
 	MayaTo::getWorldPtr()->setRenderState(MayaTo::MayaToWorld::WorldRenderState::RSTATENONE);
 	MayaTo::getWorldPtr()->setRenderType(MayaTo::MayaToWorld::WorldRenderType::RTYPENONE);
@@ -0,0 +1,267 @@
+#include "swatchService.h"
+#include <chrono>
+#include <iterator>
+#include "utilities/logging.h"
+#include "../world.h"
+
+static const int PAUSE_SLEEP_MS = 100;
+
+SwatchImageCache::SwatchImageCache(size_t maxBytes)
+{
+	this->maxBytes = maxBytes;
+}
+
+unsigned long long SwatchImageCache::getKey(unsigned long long networkHash, int resolution)
+{
+	return networkHash ^ ((unsigned long long)resolution * 0x9E3779B97F4A7C15ULL);
+}
+
+bool SwatchImageCache::get(unsigned long long networkHash, int resolution, std::vector<float>& pixels)
+{
+	if (networkHash == NO_SWATCH_HASH)
+		return false;
+	std::lock_guard<std::mutex> lock(this->cacheMutex);
+	auto range = this->entryMap.equal_range(getKey(networkHash, resolution));
+	for (auto it = range.first; it != range.second; it++)
+	{
+		std::list<Entry>::iterator entry = it->second;
+		if ((entry->networkHash != networkHash) || (entry->resolution != resolution))
+			continue;
+		this->entries.splice(this->entries.begin(), this->entries, entry);
+		pixels = entry->pixels;
+		this->hits++;
+		return true;
+	}
+	this->misses++;
+	return false;
+}
+
+void SwatchImageCache::put(unsigned long long networkHash, int resolution, const std::vector<float>& pixels)
+{
+	if (networkHash == NO_SWATCH_HASH)
+		return;
+	std::lock_guard<std::mutex> lock(this->cacheMutex);
+	unsigned long long key = getKey(networkHash, resolution);
+	auto range = this->entryMap.equal_range(key);
+	for (auto it = range.first; it != range.second; it++)
+	{
+		std::list<Entry>::iterator entry = it->second;
+		if ((entry->networkHash != networkHash) || (entry->resolution != resolution))
+			continue;
+		this->usedBytes -= entry->pixels.size() * sizeof(float);
+		entry->pixels = pixels;
+		this->usedBytes += pixels.size() * sizeof(float);
+		this->entries.splice(this->entries.begin(), this->entries, entry);
+		this->shrink();
+		return;
+	}
+	Entry entry;
+	entry.networkHash = networkHash;
+	entry.resolution = resolution;
+	entry.pixels = pixels;
+	this->entries.push_front(entry);
+	this->entryMap.insert(std::make_pair(key, this->entries.begin()));
+	this->usedBytes += pixels.size() * sizeof(float);
+	this->shrink();
+}
+
+void SwatchImageCache::setMaxBytes(size_t maxBytes)
+{
+	std::lock_guard<std::mutex> lock(this->cacheMutex);
+	this->maxBytes = maxBytes;
+	this->shrink();
+}
+
+// removes the least recently used images, the newest one is always kept
+void SwatchImageCache::shrink()
+{
+	while ((this->usedBytes > this->maxBytes) && (this->entries.size() > 1))
+	{
+		std::list<Entry>::iterator last = std::prev(this->entries.end());
+		auto range = this->entryMap.equal_range(getKey(last->networkHash, last->resolution));
+		for (auto it = range.first; it != range.second; it++)
+		{
+			if (it->second == last)
+			{
+				this->entryMap.erase(it);
+				break;
+			}
+		}
+		this->usedBytes -= last->pixels.size() * sizeof(float);
+		this->entries.erase(last);
+	}
+}
+
+void SwatchImageCache::clear()
+{
+	std::lock_guard<std::mutex> lock(this->cacheMutex);
+	if ((this->hits > 0) || (this->misses > 0))
+		Logging::debug(MString("SwatchImageCache: ") + this->hits + " hits, " + this->misses + " misses");
+	this->entries.clear();
+	this->entryMap.clear();
+	this->usedBytes = 0;
+	this->hits = 0;
+	this->misses = 0;
+}
+
+// joining the workers during the static destruction can deadlock when the plugin is unloaded, so the service is
+// stopped in uninitializePlugin(). Workers which are still there are detached, a joinable thread would call std::terminate.
+SwatchService::~SwatchService()
+{
+	for (auto& worker : this->workers)
+	{
+		if (worker.joinable())
+			worker.detach();
+	}
+}
+
+void SwatchService::start(int numWorkers, RenderFunction renderFunction)
+{
+	if (this->running)
+		this->stop();
+	if (numWorkers < 1)
+		numWorkers = 1;
+	this->renderFunction = renderFunction;
+	this->stopRequested = false;
+	this->running = true;
+	for (int i = 0; i < numWorkers; i++)
+		this->workers.push_back(std::thread(&SwatchService::workerLoop, this, i));
+	Logging::debug(MString("SwatchService: started ") + numWorkers + " swatch render threads.");
+}
+
+void SwatchService::stop()
+{
+	if (!this->running)
+		return;
+	this->stopRequested = true;
+	std::vector<SwatchJobPtr> queuedJobs;
+	this->queue.drain(queuedJobs);
+	for (auto& job : queuedJobs)
+	{
+		job->cancel();
+		job->state = SwatchJob::CANCELLED;
+	}
+	{
+		std::lock_guard<std::mutex> lock(this->nodeMutex);
+		this->queuedByNode.clear();
+	}
+	for (auto& worker : this->workers)
+	{
+		if (worker.joinable())
+			worker.join();
+	}
+	this->workers.clear();
+	this->running = false;
+	this->imageCache.clear();
+	Logging::debug("SwatchService: stopped.");
+}
+
+void SwatchService::submit(SwatchJobPtr job)
+{
+	{
+		std::lock_guard<std::mutex> lock(this->nodeMutex);
+		std::string nodeName = job->nodeName.asChar();
+		auto old = this->queuedByNode.find(nodeName);
+		if (old != this->queuedByNode.end())
+			old->second->cancel();
+		job->state = SwatchJob::QUEUED;
+		this->queuedByNode[nodeName] = job;
+	}
+	this->queue.push(job);
+}
+
+void SwatchService::raisePriority(SwatchJobPtr job)
+{
+	if ((job->state != SwatchJob::QUEUED) || (job->priority == SwatchJob::VISIBLE))
+		return;
+	job->priority = SwatchJob::VISIBLE;
+	this->queue.push(job);
+}
+
+bool SwatchService::getCachedImage(unsigned long long networkHash, int resolution, std::vector<float>& pixels)
+{
+	return this->imageCache.get(networkHash, resolution, pixels);
+}
+
+// swatches are not rendered while the main renderer needs the cpu
+bool SwatchService::mayRender()
+{
+	MayaTo::MayaToWorld *world = MayaTo::getWorldPtr();
+	if (world == nullptr)
+		return false;
+	return (world->getRenderState() != MayaTo::MayaToWorld::WorldRenderState::RSTATERENDERING) && (world->getRenderType() != MayaTo::MayaToWorld::WorldRenderType::IPRRENDER);
+}
+
+// waits a short time for a job which was not cancelled, returns an empty pointer if there is none.
+// The returned job is already in the RENDERING state.
+SwatchJobPtr SwatchService::popJob()
+{
+	SwatchJobPtr job;
+	while (this->queue.try_pop_for(job, std::chrono::milliseconds(PAUSE_SLEEP_MS)))
+	{
+		// the second entry of a job with raised priority, or a job which was already cancelled
+		if (job->state != SwatchJob::QUEUED)
+			continue;
+		{
+			std::lock_guard<std::mutex> lock(this->nodeMutex);
+			auto queued = this->queuedByNode.find(job->nodeName.asChar());
+			if ((queued != this->queuedByNode.end()) && (queued->second == job))
+				this->queuedByNode.erase(queued);
+		}
+		if (job->cancelled)
+		{
+			job->state = SwatchJob::CANCELLED;
+			continue;
+		}
+		int queued = SwatchJob::QUEUED;
+		if (!job->state.compare_exchange_strong(queued, SwatchJob::RENDERING))
+			continue;
+		return job;
+	}
+	return SwatchJobPtr();
+}
+
+void SwatchService::workerLoop(int workerId)
+{
+	while (!this->stopRequested)
+	{
+		if (!this->mayRender())
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(PAUSE_SLEEP_MS));
+			continue;
+		}
+
+		SwatchJobPtr job = this->popJob();
+		if (!job)
+			continue;
+		if (this->stopRequested)
+		{
+			job->state = SwatchJob::CANCELLED;
+			break;
+		}
+
+		LOG_DEBUG(MString("SwatchService: worker ") + workerId + " renders swatch for " + job->nodeName);
+		bool success = this->renderFunction(*job, workerId);
+		size_t numPixels = (size_t)job->resolution * job->resolution * 4;
+		if (job->cancelled)
+		{
+			job->state = SwatchJob::CANCELLED;
+		}
+		else if (success && (job->pixels.size() == numPixels))
+		{
+			this->imageCache.put(job->networkHash, job->resolution, job->pixels);
+			job->state = SwatchJob::DONE;
+		}
+		else{
+			Logging::warning(MString("SwatchService: unable to render swatch for ") + job->nodeName);
+			job->state = SwatchJob::FAILED;
+		}
+	}
+}
+
+static SwatchService swatchService;
+
+SwatchService& getSwatchService()
+{
+	return swatchService;
+}
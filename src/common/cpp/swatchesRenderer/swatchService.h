@@ -0,0 +1,135 @@
+#ifndef MAYATO_SWATCHSERVICE_H
+#define MAYATO_SWATCHSERVICE_H
+
+/*
+	Maya calls doIteration() of a swatch renderer from its idle loop until it returns true.
+	Instead of rendering the swatch there, the swatch renderer submits a job to this service and returns false
+	until the job is done, so maya stays responsive while a whole material library is rendered.
+
+	- a small pool of worker threads renders the jobs, every worker has its own renderer instance
+	- visible swatches are rendered first. A job has a priority, the queue has one lane per priority and the
+	  swatch renderer raises a queued job to VISIBLE if its node is selected, so it is shown in the attribute editor
+	  and highlighted in the hypershade. Inside a lane the newest request is rendered first, maya requests the swatches
+	  which are visible at the moment, so if the user scrolls through the hypershade the swatches on screen are done
+	  before the old ones
+	- a queued job for a node is cancelled if the node requests a new swatch or the swatch renderer is deleted
+	- the finished images are saved in a lru cache, the key is the hash of the shading network and the resolution,
+	  so an unchanged material is only rendered once per session. Nodes which are not in the shader definitions have
+	  an empty network whose hash says nothing about the node, they use NO_SWATCH_HASH and are never cached.
+	- the service has to be stopped in uninitializePlugin(), not by the static destructor
+	- workers do not start new jobs while a normal or ipr rendering is running, the jobs wait in the queue
+*/
+
+#include <maya/MString.h>
+#include <atomic>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "../threads/concurrentQueue.h"
+
+class SwatchJob
+{
+public:
+	enum State{
+		QUEUED = 0,
+		RENDERING,
+		DONE,
+		FAILED,
+		CANCELLED
+	};
+	// the priority is the lane of the job queue, higher lanes are served first
+	enum Priority{
+		BACKGROUND = 0,
+		VISIBLE,
+		NUM_PRIORITIES
+	};
+
+	SwatchJob() : state(QUEUED), priority(BACKGROUND), cancelled(false){}
+	virtual ~SwatchJob(){}
+
+	MString nodeName;
+	unsigned long long networkHash = 0;
+	int resolution = 0;
+	std::atomic<int> state;
+	std::atomic<int> priority;
+	std::atomic<bool> cancelled;
+	// rgba float pixels, written by the worker
+	std::vector<float> pixels;
+
+	void cancel(){ cancelled = true; }
+	bool isFinished() const { return state >= DONE; }
+};
+
+typedef std::shared_ptr<SwatchJob> SwatchJobPtr;
+
+// network hash of a swatch which must not be cached
+static const unsigned long long NO_SWATCH_HASH = 0;
+
+class SwatchImageCache
+{
+public:
+	SwatchImageCache(size_t maxBytes = 64 * 1024 * 1024);
+	bool get(unsigned long long networkHash, int resolution, std::vector<float>& pixels);
+	void put(unsigned long long networkHash, int resolution, const std::vector<float>& pixels);
+	void setMaxBytes(size_t maxBytes);
+	void clear();
+	int hits = 0;
+	int misses = 0;
+private:
+	struct Entry{
+		unsigned long long networkHash;
+		int resolution;
+		std::vector<float> pixels;
+	};
+	void shrink();
+	static unsigned long long getKey(unsigned long long networkHash, int resolution);
+	// most recently used entries are at the front
+	std::list<Entry> entries;
+	std::unordered_multimap<unsigned long long, std::list<Entry>::iterator> entryMap;
+	size_t usedBytes = 0;
+	size_t maxBytes;
+	std::mutex cacheMutex;
+};
+
+class SwatchService
+{
+public:
+	// renders the job with the renderer of the worker, returns false if rendering failed
+	typedef std::function<bool(SwatchJob& job, int workerId)> RenderFunction;
+
+	SwatchService() : queue(0, SwatchJob::NUM_PRIORITIES, MayaTo::QUEUE_LIFO, [](const SwatchJobPtr& job){ return (int)job->priority; }), running(false), stopRequested(false){}
+	~SwatchService();
+	void start(int numWorkers, RenderFunction renderFunction);
+	// cancels all jobs and waits until the workers are finished
+	void stop();
+	bool isRunning() const { return running; }
+	// a queued job for the same node is cancelled, the new job is rendered first
+	void submit(SwatchJobPtr job);
+	// moves a queued job into the VISIBLE lane
+	void raisePriority(SwatchJobPtr job);
+	bool getCachedImage(unsigned long long networkHash, int resolution, std::vector<float>& pixels);
+	SwatchImageCache imageCache;
+private:
+	void workerLoop(int workerId);
+	bool mayRender();
+	SwatchJobPtr popJob();
+	RenderFunction renderFunction;
+	std::vector<std::thread> workers;
+	// visible jobs first, newest job first inside a priority. A raised job is queued twice, the copy which
+	// is popped first claims the job, the other one is skipped.
+	MayaTo::ConcurrentQueue<SwatchJobPtr> queue;
+	// the last queued job of every node, so it can be cancelled by a newer request
+	std::unordered_map<std::string, SwatchJobPtr> queuedByNode;
+	std::mutex nodeMutex;
+	std::atomic<bool> running;
+	std::atomic<bool> stopRequested;
+};
+
+SwatchService& getSwatchService();
+
+#endif
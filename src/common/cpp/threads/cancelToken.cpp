@@ -0,0 +1,176 @@
+#include "cancelToken.h"
+#include <chrono>
+#include <csignal>
+#include <thread>
+#include <maya/MComputation.h>
+#include <maya/MGlobal.h>
+#include <maya/MRenderView.h>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include "../world.h"
+#include "utilities/logging.h"
+
+namespace MayaTo{
+
+	static const int INTERRUPT_POLL_MS = 100;
+
+	static CancelToken renderCancelToken;
+
+	// the watch is started and ended on the main thread, other threads only read computationWatchActive
+	static std::thread::id interruptWatchThreadId;
+	static bool signalWatchActive = false;
+	static std::atomic<bool> computationWatchActive(false);
+	static MComputation *userComputation = nullptr;
+	static std::chrono::steady_clock::time_point lastInterruptPoll;
+	typedef void(*SignalHandler)(int);
+	static SignalHandler oldSigIntHandler = SIG_DFL;
+	static SignalHandler oldSigTermHandler = SIG_DFL;
+
+#ifdef _WIN32
+	static MString setWaitCursorCmd = "import pymel.core as pm;pm.waitCursor(state=True);";
+	static MString releaseWaitCursorCmd = "import pymel.core as pm;pm.waitCursor(state=False);pm.refresh()";
+	static std::atomic<bool> escWatchDone(true);
+	static std::thread escWatchThread;
+
+	static void watchEscKey()
+	{
+		while (!escWatchDone)
+		{
+			if (GetAsyncKeyState(VK_ESCAPE) & 0x8000)
+				renderCancelToken.cancel(CANCEL_USER);
+			std::this_thread::sleep_for(std::chrono::milliseconds(INTERRUPT_POLL_MS));
+		}
+	}
+#endif
+
+	static void renderSignalHandler(int signalNumber)
+	{
+		// only lock free operations are allowed here, the rendering is stopped by the threads which check the token
+		renderCancelToken.cancel(CANCEL_SIGNAL);
+	}
+
+	CancelToken::CancelToken() : reason(CANCEL_NONE)
+	{}
+
+	void CancelToken::reset()
+	{
+		this->reason = CANCEL_NONE;
+	}
+
+	void CancelToken::cancel(CancelReason cancelReason)
+	{
+		int expected = CANCEL_NONE;
+		this->reason.compare_exchange_strong(expected, (int)cancelReason);
+	}
+
+	bool CancelToken::isCancelled() const
+	{
+		return this->reason.load() != CANCEL_NONE;
+	}
+
+	CancelReason CancelToken::getReason() const
+	{
+		return (CancelReason)this->reason.load();
+	}
+
+	CancelToken& getRenderCancelToken()
+	{
+		return renderCancelToken;
+	}
+
+	const char *getCancelReasonString(CancelReason reason)
+	{
+		switch (reason)
+		{
+		case CANCEL_USER:
+			return "interrupted by user";
+		case CANCEL_SIGNAL:
+			return "interrupted by signal";
+		case CANCEL_ABORT:
+			return "renderer aborted";
+		default:
+			return "not cancelled";
+		}
+	}
+
+	void beginInterruptWatch()
+	{
+		endInterruptWatch();
+		renderCancelToken.reset();
+		interruptWatchThreadId = std::this_thread::get_id();
+
+		if (MGlobal::mayaState() == MGlobal::kBatch)
+		{
+			oldSigIntHandler = std::signal(SIGINT, renderSignalHandler);
+			oldSigTermHandler = std::signal(SIGTERM, renderSignalHandler);
+			signalWatchActive = true;
+			return;
+		}
+
+		// IPR is stopped with the IPR stop event, only a normal UI rendering can be interrupted with esc
+		if (getWorldPtr()->getRenderType() != MayaToWorld::WorldRenderType::UIRENDER)
+			return;
+
+#ifdef _WIN32
+		// read an old esc press away, it would cancel the new rendering immediately
+		GetAsyncKeyState(VK_ESCAPE);
+		escWatchDone = false;
+		escWatchThread = std::thread(watchEscKey);
+		if (MRenderView::doesRenderEditorExist())
+			MGlobal::executePythonCommand(setWaitCursorCmd);
+#else
+		userComputation = new MComputation();
+		userComputation->beginComputation();
+		lastInterruptPoll = std::chrono::steady_clock::now();
+		computationWatchActive = true;
+#endif
+	}
+
+	void endInterruptWatch()
+	{
+		if (signalWatchActive)
+		{
+			std::signal(SIGINT, oldSigIntHandler == SIG_ERR ? SIG_DFL : oldSigIntHandler);
+			std::signal(SIGTERM, oldSigTermHandler == SIG_ERR ? SIG_DFL : oldSigTermHandler);
+			signalWatchActive = false;
+		}
+#ifdef _WIN32
+		if (escWatchThread.joinable())
+		{
+			escWatchDone = true;
+			escWatchThread.join();
+			if (MRenderView::doesRenderEditorExist())
+				MGlobal::executePythonCommand(releaseWaitCursorCmd);
+		}
+#endif
+		if (userComputation != nullptr)
+		{
+			computationWatchActive = false;
+			userComputation->endComputation();
+			delete userComputation;
+			userComputation = nullptr;
+		}
+		if (renderCancelToken.isCancelled())
+			Logging::warning(MString("Rendering cancelled: ") + getCancelReasonString(renderCancelToken.getReason()));
+		renderCancelToken.reset();
+	}
+
+	void pollUserInterrupt()
+	{
+		if (!computationWatchActive || (std::this_thread::get_id() != interruptWatchThreadId))
+			return;
+		std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		if (std::chrono::duration_cast<std::chrono::milliseconds>(now - lastInterruptPoll).count() < INTERRUPT_POLL_MS)
+			return;
+		lastInterruptPoll = now;
+		if (userComputation->isInterruptRequested())
+			renderCancelToken.cancel(CANCEL_USER);
+	}
+
+	bool isRenderCancelled()
+	{
+		pollUserInterrupt();
+		return renderCancelToken.isCancelled();
+	}
+}
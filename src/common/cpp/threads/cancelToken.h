@@ -0,0 +1,58 @@
+#ifndef MAYATO_CANCEL_TOKEN_H
+#define MAYATO_CANCEL_TOKEN_H
+
+/*
+	Cooperative cancellation of a rendering.
+
+	The render cancel token is a single atomic value which is checked by the long loops of the translation:
+	scene parsing, the scene updates of the motion steps, mesh extraction and the parallel loops. If it is set,
+	they stop as soon as possible and the render queue ends the rendering instead of starting the next frame.
+
+	The token is set from several sources:
+	- in the UI, Windows: a thread polls the esc key, so it works even if the main thread is busy
+	- in the UI, other platforms: Maya's MComputation is asked for an interrupt whenever the main thread checks the token
+	  and from the render queue timer callback while the renderer works in the render thread
+	- in batch mode: SIGINT and SIGTERM, the previous signal handlers are restored when the rendering is done
+	- renderer abort: the INTERRUPT and IPRSTOP events of the render queue
+*/
+
+#include <atomic>
+
+namespace MayaTo{
+
+	enum CancelReason{
+		CANCEL_NONE = 0,
+		// esc pressed in the UI
+		CANCEL_USER,
+		// SIGINT or SIGTERM in batch mode
+		CANCEL_SIGNAL,
+		// the renderer was aborted, e.g. IPR stopped
+		CANCEL_ABORT
+	};
+
+	class CancelToken
+	{
+	public:
+		CancelToken();
+		void reset();
+		// can be called from any thread and from signal handlers, the first reason is kept
+		void cancel(CancelReason reason);
+		bool isCancelled() const;
+		CancelReason getReason() const;
+	private:
+		std::atomic<int> reason;
+	};
+
+	CancelToken& getRenderCancelToken();
+	const char *getCancelReasonString(CancelReason reason);
+
+	// main thread: resets the token and starts to watch the interrupt sources which fit the current render mode
+	void beginInterruptWatch();
+	void endInterruptWatch();
+	// main thread: asks maya for an esc press if the watch uses MComputation, at most every 100ms
+	void pollUserInterrupt();
+	// any thread: true if the rendering should stop, on the main thread it polls the user interrupt too
+	bool isRenderCancelled();
+}
+
+#endif
@@ -0,0 +1,255 @@
+#ifndef MAYATO_CONCURRENT_QUEUE_H
+#define MAYATO_CONCURRENT_QUEUE_H
+
+/*
+A thread safe queue used by the render event queue and the swatch service.
+- capacity: if it is > 0, push() blocks while the queue is full, try_push() returns false
+- lanes: every lane is a queue of its own, pop() always takes the element from the highest lane which is not empty.
+  push() without a lane uses the lane selector or lane 0, so an interrupt can pass all waiting tile updates.
+- order: FIFO or LIFO inside a lane, LIFO is useful if the newest request is the most important one
+- statistics: how often a thread had to wait for the lock, for an element or for free space
+*/
+
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <deque>
+#include <vector>
+#include <functional>
+
+namespace MayaTo{
+
+	struct QueueStatistics{
+		size_t pushed = 0;
+		size_t popped = 0;
+		// the mutex was locked by another thread
+		size_t contended = 0;
+		// a consumer had to wait for an element
+		size_t emptyWaits = 0;
+		// a producer had to wait for free space
+		size_t fullWaits = 0;
+		size_t maxSize = 0;
+	};
+
+	enum QueueOrder{
+		QUEUE_FIFO = 0,
+		QUEUE_LIFO
+	};
+
+	template<typename Data>
+	class ConcurrentQueue
+	{
+	public:
+		typedef std::function<int(const Data&)> LaneSelector;
+
+		ConcurrentQueue(size_t capacity = 0, int numLanes = 1, QueueOrder order = QUEUE_FIFO, LaneSelector laneSelector = nullptr)
+			: lanes(numLanes > 0 ? numLanes : 1), capacity(capacity), order(order), laneSelector(laneSelector)
+		{}
+
+		void push(Data const& data)
+		{
+			push(data, selectLane(data));
+		}
+
+		void push(Data const& data, int lane)
+		{
+			std::unique_lock<std::mutex> lock = acquire();
+			if (full())
+			{
+				stats.fullWaits++;
+				notFull.wait(lock, [this]{ return !full(); });
+			}
+			insert(data, lane);
+			lock.unlock();
+			notEmpty.notify_one();
+		}
+
+		bool try_push(Data const& data)
+		{
+			return try_push(data, selectLane(data));
+		}
+
+		bool try_push(Data const& data, int lane)
+		{
+			std::unique_lock<std::mutex> lock = acquire();
+			if (full())
+				return false;
+			insert(data, lane);
+			lock.unlock();
+			notEmpty.notify_one();
+			return true;
+		}
+
+		bool empty() const
+		{
+			std::unique_lock<std::mutex> lock = acquire();
+			return numElements == 0;
+		}
+
+		size_t size() const
+		{
+			std::unique_lock<std::mutex> lock = acquire();
+			return numElements;
+		}
+
+		bool try_pop(Data& popped_value)
+		{
+			std::unique_lock<std::mutex> lock = acquire();
+			if (numElements == 0)
+				return false;
+			take(popped_value);
+			lock.unlock();
+			notFull.notify_one();
+			return true;
+		}
+
+		void wait_and_pop(Data& popped_value)
+		{
+			std::unique_lock<std::mutex> lock = acquire();
+			if (numElements == 0)
+			{
+				stats.emptyWaits++;
+				notEmpty.wait(lock, [this]{ return numElements > 0; });
+			}
+			take(popped_value);
+			lock.unlock();
+			notFull.notify_one();
+		}
+
+		// returns false if no element arrived within the timeout
+		template<typename Rep, typename Period>
+		bool try_pop_for(Data& popped_value, const std::chrono::duration<Rep, Period>& timeout)
+		{
+			std::unique_lock<std::mutex> lock = acquire();
+			if (numElements == 0)
+			{
+				stats.emptyWaits++;
+				if (!notEmpty.wait_for(lock, timeout, [this]{ return numElements > 0; }))
+					return false;
+			}
+			take(popped_value);
+			lock.unlock();
+			notFull.notify_one();
+			return true;
+		}
+
+		// moves up to maxElements (0 == all) elements in pop order into result with a single lock
+		size_t drain(std::vector<Data>& result, size_t maxElements = 0)
+		{
+			std::unique_lock<std::mutex> lock = acquire();
+			size_t num = numElements;
+			if ((maxElements > 0) && (maxElements < num))
+				num = maxElements;
+			result.reserve(result.size() + num);
+			for (size_t i = 0; i < num; i++)
+			{
+				Data data;
+				take(data);
+				result.push_back(data);
+			}
+			lock.unlock();
+			if (num > 0)
+				notFull.notify_all();
+			return num;
+		}
+
+		// removes all elements, returns the number of removed elements
+		size_t clear()
+		{
+			std::unique_lock<std::mutex> lock = acquire();
+			size_t num = numElements;
+			for (auto& lane : lanes)
+				lane.clear();
+			numElements = 0;
+			lock.unlock();
+			if (num > 0)
+				notFull.notify_all();
+			return num;
+		}
+
+		QueueStatistics getStatistics() const
+		{
+			std::unique_lock<std::mutex> lock = acquire();
+			return stats;
+		}
+
+		void resetStatistics()
+		{
+			std::unique_lock<std::mutex> lock = acquire();
+			stats = QueueStatistics();
+		}
+
+	private:
+		std::vector<std::deque<Data>> lanes;
+		size_t numElements = 0;
+		size_t capacity;
+		QueueOrder order;
+		LaneSelector laneSelector;
+		mutable std::mutex queueMutex;
+		std::condition_variable notEmpty;
+		std::condition_variable notFull;
+		mutable QueueStatistics stats;
+
+		// try first without waiting so we know how often the lock is contended
+		std::unique_lock<std::mutex> acquire() const
+		{
+			std::unique_lock<std::mutex> lock(queueMutex, std::try_to_lock);
+			if (!lock.owns_lock())
+			{
+				lock.lock();
+				stats.contended++;
+			}
+			return lock;
+		}
+
+		int selectLane(Data const& data) const
+		{
+			if (laneSelector)
+				return laneSelector(data);
+			return 0;
+		}
+
+		bool full() const
+		{
+			return (capacity > 0) && (numElements >= capacity);
+		}
+
+		void insert(Data const& data, int lane)
+		{
+			if (lane < 0)
+				lane = 0;
+			if (lane >= (int)lanes.size())
+				lane = (int)lanes.size() - 1;
+			lanes[lane].push_back(data);
+			numElements++;
+			stats.pushed++;
+			if (numElements > stats.maxSize)
+				stats.maxSize = numElements;
+		}
+
+		// the queue must not be empty
+		void take(Data& data)
+		{
+			for (int l = (int)lanes.size() - 1; l >= 0; l--)
+			{
+				std::deque<Data>& lane = lanes[l];
+				if (lane.empty())
+					continue;
+				if (order == QUEUE_LIFO)
+				{
+					data = lane.back();
+					lane.pop_back();
+				}
+				else{
+					data = lane.front();
+					lane.pop_front();
+				}
+				numElements--;
+				stats.popped++;
+				return;
+			}
+		}
+	};
+}
+
+#endif
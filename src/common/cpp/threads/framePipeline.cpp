@@ -0,0 +1,243 @@
+#include "framePipeline.h"
+#include <chrono>
+#include <thread>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <csignal>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+#include "cancelToken.h"
+#include "utilities/logging.h"
+
+namespace MayaTo{
+
+	static const int PIPELINE_POLL_MS = 100;
+
+	static FramePipeline framePipeline;
+
+	FramePipeline& getFramePipeline()
+	{
+		return framePipeline;
+	}
+
+	bool removeDirectory(const MString& directory)
+	{
+#ifdef _WIN32
+		WIN32_FIND_DATAA findData;
+		HANDLE find = FindFirstFileA((directory + "/*").asChar(), &findData);
+		if (find != INVALID_HANDLE_VALUE)
+		{
+			do{
+				MString name = findData.cFileName;
+				if ((name == ".") || (name == ".."))
+					continue;
+				MString path = directory + "/" + name;
+				if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+					removeDirectory(path);
+				else
+					DeleteFileA(path.asChar());
+			} while (FindNextFileA(find, &findData));
+			FindClose(find);
+		}
+		return RemoveDirectoryA(directory.asChar()) != 0;
+#else
+		DIR *dir = opendir(directory.asChar());
+		if (dir != nullptr)
+		{
+			struct dirent *entry;
+			while ((entry = readdir(dir)) != nullptr)
+			{
+				MString name = entry->d_name;
+				if ((name == ".") || (name == ".."))
+					continue;
+				MString path = directory + "/" + name;
+				struct stat fileInfo;
+				if ((lstat(path.asChar(), &fileInfo) == 0) && S_ISDIR(fileInfo.st_mode))
+					removeDirectory(path);
+				else
+					unlink(path.asChar());
+			}
+			closedir(dir);
+		}
+		return rmdir(directory.asChar()) == 0;
+#endif
+	}
+
+	FramePipeline::FramePipeline() : maxFramesInFlight(1), failedFrames(0)
+	{}
+
+	void FramePipeline::setMaxFramesInFlight(int frames)
+	{
+		this->maxFramesInFlight = (frames < 1) ? 1 : frames;
+	}
+
+	int FramePipeline::getMaxFramesInFlight() const
+	{
+		return this->maxFramesInFlight;
+	}
+
+	int FramePipeline::getNumFramesInFlight()
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->collectFinished();
+		return (int)this->processes.size();
+	}
+
+	void FramePipeline::collectFinished()
+	{
+		for (size_t i = 0; i < this->processes.size();)
+		{
+			FrameProcess& process = this->processes[i];
+			bool finished = false;
+			int exitCode = 0;
+#ifdef _WIN32
+			if (WaitForSingleObject((HANDLE)process.handle, 0) == WAIT_OBJECT_0)
+			{
+				DWORD code = 0;
+				GetExitCodeProcess((HANDLE)process.handle, &code);
+				CloseHandle((HANDLE)process.handle);
+				exitCode = (int)code;
+				finished = true;
+			}
+#else
+			int status = 0;
+			if (waitpid(process.pid, &status, WNOHANG) == process.pid)
+			{
+				exitCode = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+				finished = true;
+			}
+#endif
+			if (!finished)
+			{
+				i++;
+				continue;
+			}
+			if (exitCode != 0)
+			{
+				Logging::error(MString("Rendering of frame ") + process.frame + " failed, exit code " + exitCode);
+				this->failedFrames++;
+			}
+			else{
+				Logging::progress(MString("\n========== Rendering of frame ") + process.frame + " done ==============\n");
+				this->renderedFrames.push_back(process.frame);
+			}
+			removeDirectory(process.frameDirectory);
+			this->processes.erase(this->processes.begin() + i);
+		}
+	}
+
+	std::vector<float> FramePipeline::takeRenderedFrames()
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->collectFinished();
+		std::vector<float> frames;
+		frames.swap(this->renderedFrames);
+		return frames;
+	}
+
+	bool FramePipeline::launch(const MString& command, float frame, const MString& frameDirectory)
+	{
+		while (this->getNumFramesInFlight() >= this->maxFramesInFlight)
+		{
+			if (isRenderCancelled())
+			{
+				removeDirectory(frameDirectory);
+				return false;
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(PIPELINE_POLL_MS));
+		}
+		if (isRenderCancelled())
+		{
+			removeDirectory(frameDirectory);
+			return false;
+		}
+
+		Logging::info(MString("Starting rendering of frame ") + frame + ": " + command);
+		FrameProcess process;
+		process.frame = frame;
+		process.frameDirectory = frameDirectory;
+#ifdef _WIN32
+		STARTUPINFOA startupInfo;
+		PROCESS_INFORMATION processInfo;
+		ZeroMemory(&startupInfo, sizeof(startupInfo));
+		startupInfo.cb = sizeof(startupInfo);
+		ZeroMemory(&processInfo, sizeof(processInfo));
+		// CreateProcess may modify the command line, so it needs a copy
+		std::vector<char> commandLine(command.asChar(), command.asChar() + command.length() + 1);
+		if (!CreateProcessA(nullptr, &commandLine[0], nullptr, nullptr, FALSE, 0, nullptr, nullptr, &startupInfo, &processInfo))
+		{
+			Logging::error(MString("Unable to start the rendering of frame ") + frame + ", error " + (int)GetLastError());
+			removeDirectory(frameDirectory);
+			return false;
+		}
+		CloseHandle(processInfo.hThread);
+		process.handle = processInfo.hProcess;
+#else
+		// the string has to be ready before the fork, the child may only call exec
+		const char *commandLine = command.asChar();
+		pid_t pid = fork();
+		if (pid == 0)
+		{
+			// an own process group, so terminateAll() also stops the processes started by the shell
+			setpgid(0, 0);
+			execl("/bin/sh", "sh", "-c", commandLine, (char *)nullptr);
+			_exit(127);
+		}
+		if (pid < 0)
+		{
+			Logging::error(MString("Unable to start the rendering of frame ") + frame);
+			removeDirectory(frameDirectory);
+			return false;
+		}
+		// set in the parent too, the child could still be before its setpgid() when it is terminated
+		setpgid(pid, pid);
+		process.pid = (int)pid;
+#endif
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->processes.push_back(process);
+		return true;
+	}
+
+	void FramePipeline::waitForAll()
+	{
+		while (this->getNumFramesInFlight() > 0)
+		{
+			if (isRenderCancelled())
+			{
+				this->terminateAll();
+				break;
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(PIPELINE_POLL_MS));
+		}
+		std::lock_guard<std::mutex> lock(this->mutex);
+		if (this->failedFrames > 0)
+			Logging::error(MString("") + this->failedFrames + " frames of the sequence failed.");
+		this->failedFrames = 0;
+	}
+
+	void FramePipeline::terminateAll()
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		for (FrameProcess& process : this->processes)
+		{
+			Logging::warning(MString("Terminating rendering of frame ") + process.frame);
+#ifdef _WIN32
+			TerminateProcess((HANDLE)process.handle, 1);
+			WaitForSingleObject((HANDLE)process.handle, INFINITE);
+			CloseHandle((HANDLE)process.handle);
+#else
+			kill(-process.pid, SIGTERM);
+			int status = 0;
+			waitpid(process.pid, &status, 0);
+#endif
+			removeDirectory(process.frameDirectory);
+		}
+		this->processes.clear();
+		this->renderedFrames.clear();
+	}
+}
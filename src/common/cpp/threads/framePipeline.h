@@ -0,0 +1,71 @@
+#ifndef MAYATO_FRAME_PIPELINE_H
+#define MAYATO_FRAME_PIPELINE_H
+
+/*
+	Pipelined sequence rendering.
+
+	Renderers which can write a complete frame into a scene file for their standalone renderer (see
+	Renderer::canRenderSceneFile()) do not have to render the frame in the Maya process. In batch mode the frame
+	is exported, the standalone renderer is started as a child process and the next frame is exported while the
+	child renders. So the Maya DG evaluation and translation of frame N+1 overlaps the rendering of frame N.
+
+	maxFramesInFlight limits the number of children rendering at the same time. If the limit is reached, launch()
+	waits until one of the running frames is done. A cancelled rendering terminates all children.
+
+	Every frame is exported into its own directory, because renderers write additional files next to the scene file,
+	e.g. the appleseed meshes, and the child of the previous frame may still read them. The directory is removed
+	as soon as the child has exited.
+
+	For the render queue a frame is done as soon as its child is started, but the image only exists when the child
+	has exited. So the frames which were rendered successfully are collected and the render queue runs the post frame
+	script for them later with takeRenderedFrames().
+*/
+
+#include <mutex>
+#include <vector>
+#include <maya/MString.h>
+
+namespace MayaTo{
+
+	class FramePipeline
+	{
+	public:
+		FramePipeline();
+		void setMaxFramesInFlight(int frames);
+		int getMaxFramesInFlight() const;
+		// starts the command as a child process, waits for a free slot before. Returns false if the process
+		// could not be started or the rendering was cancelled while waiting. frameDirectory contains the exported
+		// files of the frame, it is removed when the child has exited or could not be started.
+		bool launch(const MString& command, float frame, const MString& frameDirectory);
+		// waits until all frames are rendered, terminates the running children if the rendering is cancelled
+		void waitForAll();
+		void terminateAll();
+		int getNumFramesInFlight();
+		// the frames whose child has exited successfully since the last call, in the order they were finished
+		std::vector<float> takeRenderedFrames();
+
+	private:
+		struct FrameProcess{
+			float frame;
+			MString frameDirectory;
+#ifdef _WIN32
+			void *handle;
+#else
+			int pid;
+#endif
+		};
+		// removes all finished children and reports their result, needs the lock
+		void collectFinished();
+		int maxFramesInFlight;
+		int failedFrames;
+		std::mutex mutex;
+		std::vector<FrameProcess> processes;
+		std::vector<float> renderedFrames;
+	};
+
+	FramePipeline& getFramePipeline();
+	// removes the directory with all files and subdirectories
+	bool removeDirectory(const MString& directory);
+}
+
+#endif
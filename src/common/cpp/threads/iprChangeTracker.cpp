@@ -0,0 +1,300 @@
+#include "iprChangeTracker.h"
+#include <algorithm>
+#include <maya/MObjectHandle.h>
+#include <maya/MDagPath.h>
+#include "../mayaScene.h"
+#include "utilities/logging.h"
+
+static const double MIN_DEBOUNCE_SECONDS = 0.05;
+static const double MAX_DEBOUNCE_SECONDS = 1.0;
+// used until the first restart was measured, the old fixed update interval
+static const double START_DEBOUNCE_SECONDS = 0.2;
+// while the user drags something the changes are handed over at least after this number of debounce intervals
+static const double MAX_LATENCY_FACTOR = 3.0;
+
+IPRChangeTracker::IPRChangeTracker() : dirtyCost(IPR_UPDATE_PARAMETER), updatePending(false), restartRequested(false), averageRestartSeconds(START_DEBOUNCE_SECONDS * 2.0)
+{}
+
+size_t IPRChangeTracker::getIndexNode(const MObject& node)
+{
+	IndexNode *existing = this->findIndexNode(node);
+	if (existing != nullptr)
+		return existing - &this->indexNodes[0];
+	IndexNode indexNode;
+	indexNode.node = node;
+	this->indexNodes.push_back(indexNode);
+	size_t id = this->indexNodes.size() - 1;
+	this->indexNodeMap.insert(std::make_pair(MObjectHandle(node).hashCode(), id));
+	return id;
+}
+
+IPRChangeTracker::IndexNode *IPRChangeTracker::findIndexNode(const MObject& node)
+{
+	auto range = this->indexNodeMap.equal_range(MObjectHandle(node).hashCode());
+	for (auto it = range.first; it != range.second; it++)
+	{
+		if (this->indexNodes[it->second].node == node)
+			return &this->indexNodes[it->second];
+	}
+	return nullptr;
+}
+
+void IPRChangeTracker::buildIndex(std::map<unsigned int, InteractiveElement>& interactiveUpdateMap)
+{
+	this->indexNodes.clear();
+	this->indexNodeMap.clear();
+	for (auto& element : interactiveUpdateMap)
+		this->addToIndex(&element.second);
+	Logging::debug(MString("IPRChangeTracker: index contains ") + (int)this->indexNodes.size() + " dag nodes.");
+}
+
+// only shapes are saved with their elements, the transforms above them are only used to find the shapes
+void IPRChangeTracker::addToIndex(InteractiveElement *element)
+{
+	if (!element->obj || !element->node.hasFn(MFn::kShape))
+		return;
+	MDagPath dagPath = element->obj->dagPath;
+	if (!dagPath.isValid())
+		return;
+
+	size_t childId = this->getIndexNode(element->node);
+	IndexNode& leaf = this->indexNodes[childId];
+	if (std::find(leaf.elements.begin(), leaf.elements.end(), element) == leaf.elements.end())
+		leaf.elements.push_back(element);
+
+	// instanced shapes have several paths, so we have to go up every path until we reach a parent which already knows the child
+	while (dagPath.length() > 1)
+	{
+		dagPath.pop();
+		size_t parentId = this->getIndexNode(dagPath.node());
+		std::vector<size_t>& children = this->indexNodes[parentId].children;
+		if (std::find(children.begin(), children.end(), childId) != children.end())
+			break;
+		children.push_back(childId);
+		childId = parentId;
+	}
+}
+
+void IPRChangeTracker::clear()
+{
+	this->indexNodes.clear();
+	this->indexNodeMap.clear();
+	this->dirtyElements.clear();
+	this->dirtySet.clear();
+	this->dirtyCost = IPR_UPDATE_PARAMETER;
+	std::lock_guard<std::mutex> lock(this->changeMutex);
+	this->changeList.clear();
+	this->changeIndex.clear();
+	this->updatePending = false;
+	this->restartRequested = false;
+}
+
+// the renderers update materials, lights and cameras in place and only set a new matrix for a shape below a moved transform,
+// everything else is translated again
+static IPRUpdateCost classify(const InteractiveElement *element, bool fromTransform)
+{
+	if (element->obj && element->obj->removed)
+		return IPR_UPDATE_GEOMETRY;
+	const MObject& node = element->node;
+	if (node.hasFn(MFn::kCamera) || node.hasFn(MFn::kLight))
+		return fromTransform ? IPR_UPDATE_TRANSFORM : IPR_UPDATE_PARAMETER;
+	if (node.hasFn(MFn::kShape))
+		return fromTransform ? IPR_UPDATE_TRANSFORM : IPR_UPDATE_GEOMETRY;
+	if (node.hasFn(MFn::kTransform))
+		return IPR_UPDATE_TRANSFORM;
+	if (node.hasFn(MFn::kDagNode))
+		return IPR_UPDATE_GEOMETRY;
+	return IPR_UPDATE_PARAMETER;
+}
+
+IPRUpdateCost IPRChangeTracker::classifyUpdate(const InteractiveElement *element, bool fromTransform)
+{
+	return classify(element, fromTransform);
+}
+
+void IPRChangeTracker::markDirty(InteractiveElement *element)
+{
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	this->lastDirtyTime = now;
+	if (!this->dirtySet.insert(element).second)
+		return;
+	if (this->dirtyElements.empty())
+	{
+		this->firstDirtyTime = now;
+		this->dirtyCost = IPR_UPDATE_PARAMETER;
+	}
+	this->dirtyElements.push_back(element);
+	// a dirty element is not resolved yet, everything except a transform is modified directly
+	this->dirtyCost = std::max(this->dirtyCost, classify(element, false));
+}
+
+bool IPRChangeTracker::hasDirtyElements() const
+{
+	return !this->dirtyElements.empty();
+}
+
+IPRUpdateCost IPRChangeTracker::getDirtyCost() const
+{
+	return this->dirtyCost;
+}
+
+bool IPRChangeTracker::isReadyToFlush(bool liveUpdate) const
+{
+	if (this->dirtyElements.empty())
+		return false;
+	double debounce = liveUpdate ? MIN_DEBOUNCE_SECONDS : this->getDebounceSeconds();
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	double quietTime = std::chrono::duration<double>(now - this->lastDirtyTime).count();
+	double waitingTime = std::chrono::duration<double>(now - this->firstDirtyTime).count();
+	return (quietTime >= debounce) || (waitingTime >= debounce * MAX_LATENCY_FACTOR);
+}
+
+void IPRChangeTracker::collectLeafElements(size_t indexNodeId, std::vector<InteractiveElement *>& leafElements, std::unordered_set<size_t>& visited)
+{
+	if (!visited.insert(indexNodeId).second)
+		return;
+	IndexNode& indexNode = this->indexNodes[indexNodeId];
+	leafElements.insert(leafElements.end(), indexNode.elements.begin(), indexNode.elements.end());
+	for (size_t childId : indexNode.children)
+		this->collectLeafElements(childId, leafElements, visited);
+}
+
+size_t IPRChangeTracker::flush()
+{
+	if (this->dirtyElements.empty())
+		return 0;
+
+	// a shape which was modified itself needs a complete update, a shape below a modified transform only a new instance matrix
+	std::vector<InteractiveElement *> directElements;
+	std::vector<InteractiveElement *> transformElements;
+	std::unordered_set<size_t> visited;
+	for (auto element : this->dirtyElements)
+	{
+		if (element->node.hasFn(MFn::kTransform))
+		{
+			IndexNode *indexNode = this->findIndexNode(element->node);
+			if (indexNode != nullptr)
+				this->collectLeafElements(indexNode - &this->indexNodes[0], transformElements, visited);
+		}
+		else{
+			directElements.push_back(element);
+		}
+	}
+	this->dirtyElements.clear();
+	this->dirtySet.clear();
+	this->dirtyCost = IPR_UPDATE_PARAMETER;
+
+	size_t numAppended = 0;
+	{
+		std::lock_guard<std::mutex> lock(this->changeMutex);
+		std::unordered_set<InteractiveElement *> directSet(directElements.begin(), directElements.end());
+		for (auto element : directElements)
+		{
+			IPRUpdateCost cost = classifyUpdate(element, false);
+			auto existing = this->changeIndex.find(element);
+			if (existing != this->changeIndex.end())
+			{
+				// it may be waiting as transform update, now it needs a complete update
+				this->changeList[existing->second].cost = cost;
+				this->changeList[existing->second].fromTransform = false;
+				continue;
+			}
+			Change change = { element, cost, false };
+			this->changeIndex[element] = this->changeList.size();
+			this->changeList.push_back(change);
+			numAppended++;
+		}
+		for (auto element : transformElements)
+		{
+			if ((directSet.find(element) != directSet.end()) || (this->changeIndex.find(element) != this->changeIndex.end()))
+				continue;
+			Change change = { element, classifyUpdate(element, true), true };
+			this->changeIndex[element] = this->changeList.size();
+			this->changeList.push_back(change);
+			numAppended++;
+		}
+		if (!this->updatePending)
+		{
+			this->flushTime = std::chrono::steady_clock::now();
+			this->updatePending = true;
+		}
+	}
+	this->changeCondition.notify_all();
+	Logging::debug(MString("IPRChangeTracker: flushed ") + (int)numAppended + " elements, debounce " + this->getDebounceSeconds() + "s");
+	return numAppended;
+}
+
+IPRUpdateCost IPRChangeTracker::getPendingCost() const
+{
+	std::lock_guard<std::mutex> lock(this->changeMutex);
+	IPRUpdateCost cost = IPR_UPDATE_PARAMETER;
+	for (auto& change : this->changeList)
+		cost = std::max(cost, change.cost);
+	return cost;
+}
+
+bool IPRChangeTracker::waitForChanges(int milliseconds)
+{
+	std::unique_lock<std::mutex> lock(this->changeMutex);
+	bool changed = this->changeCondition.wait_for(lock, std::chrono::milliseconds(milliseconds), [this]{ return !this->changeList.empty() || this->restartRequested; });
+	this->restartRequested = false;
+	return changed;
+}
+
+bool IPRChangeTracker::takeChanges(std::vector<InteractiveElement *>& elements, IPRUpdateCost maxCost)
+{
+	std::lock_guard<std::mutex> lock(this->changeMutex);
+	size_t numTaken = 0;
+	for (int cost = IPR_UPDATE_PARAMETER; cost <= maxCost; cost++)
+	{
+		for (auto& change : this->changeList)
+		{
+			if (change.cost != cost)
+				continue;
+			change.element->triggeredFromTransform = change.fromTransform;
+			elements.push_back(change.element);
+			numTaken++;
+		}
+	}
+	if (numTaken == 0)
+		return false;
+
+	std::vector<Change> remaining;
+	this->changeIndex.clear();
+	for (auto& change : this->changeList)
+	{
+		if (change.cost <= maxCost)
+			continue;
+		this->changeIndex[change.element] = remaining.size();
+		remaining.push_back(change);
+	}
+	this->changeList.swap(remaining);
+	return true;
+}
+
+void IPRChangeTracker::requestRestart()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->changeMutex);
+		this->restartRequested = true;
+	}
+	this->changeCondition.notify_all();
+}
+
+void IPRChangeTracker::updateDone()
+{
+	std::lock_guard<std::mutex> lock(this->changeMutex);
+	if (!this->updatePending)
+		return;
+	double restartSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - this->flushTime).count();
+	this->averageRestartSeconds = this->averageRestartSeconds * 0.7 + restartSeconds * 0.3;
+	this->updatePending = false;
+}
+
+// half of the restart time, changes which arrive while the renderer restarts are collected anyway
+double IPRChangeTracker::getDebounceSeconds() const
+{
+	std::lock_guard<std::mutex> lock(this->changeMutex);
+	double debounce = this->averageRestartSeconds * 0.5;
+	return std::max(MIN_DEBOUNCE_SECONDS, std::min(MAX_DEBOUNCE_SECONDS, debounce));
+}
@@ -0,0 +1,118 @@
+#ifndef MAYATO_IPR_CHANGETRACKER_H
+#define MAYATO_IPR_CHANGETRACKER_H
+
+/*
+	Collects the modified elements during IPR and hands them over to the render thread.
+
+	- the node dirty callbacks only mark an element as dirty, an element is saved only once no matter how often maya calls the callback
+	- renderers translate shapes, not hierarchies, so a dirty transform has to be resolved to all shapes below it.
+	  Before IPR starts, an index parent -> children is built from the dag paths of the translated shapes,
+	  so a transform with thousands of children is resolved by walking its subtree in the index without searching the scene elements.
+	- the dirty elements are handed over only if no new modification arrived for a short time. This time depends on how long the
+	  renderer needed for the last restart: as long as the renderer restarts anyway it makes no sense to interrupt it with every small change.
+	- the main thread appends to the change list and the render thread takes the complete list, both under a lock
+	- every change is classified by its cost for the renderer. Cheap changes are sent first and, if the renderer can update
+	  them while it is rendering, without the short debounce time and without stopping the renderer.
+	  Geometry changes are collected with the debounce time and need a restart of the renderer.
+*/
+
+#include <maya/MObject.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+struct InteractiveElement;
+
+enum IPRUpdateCost{
+	// shaders, shading groups, light and camera attributes
+	IPR_UPDATE_PARAMETER = 0,
+	// a new instance matrix of an already translated shape
+	IPR_UPDATE_TRANSFORM = 1,
+	// modified, new or removed shapes and everything unknown
+	IPR_UPDATE_GEOMETRY = 2
+};
+
+class IPRChangeTracker
+{
+public:
+	IPRChangeTracker();
+	// builds the parent -> children index for all translated shapes of the interactive update map
+	void buildIndex(std::map<unsigned int, InteractiveElement>& interactiveUpdateMap);
+	// adds a new translated element, e.g. a shape created during IPR
+	void addToIndex(InteractiveElement *element);
+	void clear();
+
+	// fromTransform: the element is a shape below a modified transform
+	static IPRUpdateCost classifyUpdate(const InteractiveElement *element, bool fromTransform);
+
+	// main thread, called from the node callbacks
+	void markDirty(InteractiveElement *element);
+	bool hasDirtyElements() const;
+	// highest cost of the dirty elements, a dirty transform counts as transform update
+	IPRUpdateCost getDirtyCost() const;
+	// true if there are dirty elements and no new modification arrived during the debounce time,
+	// liveUpdate means the renderer can apply the dirty elements while rendering, then the minimal debounce time is used
+	bool isReadyToFlush(bool liveUpdate = false) const;
+	// resolves dirty transforms to shapes and appends the elements to the change list, returns the number of appended elements
+	size_t flush();
+	// highest cost of the changes which are not yet taken by the renderer
+	IPRUpdateCost getPendingCost() const;
+
+	// render thread
+	// waits until the change list is not empty or the timeout is reached, returns true if there are changes
+	bool waitForChanges(int milliseconds);
+	// moves all changes up to maxCost into the list, the cheapest first, returns false if there are none.
+	// Sets InteractiveElement::triggeredFromTransform of the taken elements, the main thread never modifies the elements.
+	bool takeChanges(std::vector<InteractiveElement *>& elements, IPRUpdateCost maxCost = IPR_UPDATE_GEOMETRY);
+	// has to be called after the renderer has updated its database with the taken changes
+	void updateDone();
+	// wakes up the render thread without a change, e.g. to restart the renderer with a new render region
+	void requestRestart();
+
+	double getDebounceSeconds() const;
+
+private:
+	struct IndexNode{
+		MObject node;
+		std::vector<size_t> children;
+		std::vector<InteractiveElement *> elements;
+	};
+	size_t getIndexNode(const MObject& node);
+	IndexNode *findIndexNode(const MObject& node);
+	void collectLeafElements(size_t indexNodeId, std::vector<InteractiveElement *>& leafElements, std::unordered_set<size_t>& visited);
+
+	std::vector<IndexNode> indexNodes;
+	// key is the MObjectHandle hash code, different nodes can have the same hash code
+	std::unordered_multimap<unsigned int, size_t> indexNodeMap;
+
+	// elements dirtied by the callbacks, in order of arrival
+	std::vector<InteractiveElement *> dirtyElements;
+	std::unordered_set<InteractiveElement *> dirtySet;
+	IPRUpdateCost dirtyCost;
+	std::chrono::steady_clock::time_point lastDirtyTime;
+	std::chrono::steady_clock::time_point firstDirtyTime;
+
+	struct Change{
+		InteractiveElement *element;
+		IPRUpdateCost cost;
+		// only the render thread copies it to the element, it may still process the element from an earlier change
+		bool fromTransform;
+	};
+	std::vector<Change> changeList;
+	// index of every element in the change list
+	std::unordered_map<InteractiveElement *, size_t> changeIndex;
+	mutable std::mutex changeMutex;
+	std::condition_variable changeCondition;
+
+	// time from the flush until the renderer has updated its database, exponential moving average
+	std::chrono::steady_clock::time_point flushTime;
+	bool updatePending;
+	bool restartRequested;
+	double averageRestartSeconds;
+};
+
+#endif
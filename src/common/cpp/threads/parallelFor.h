@@ -0,0 +1,65 @@
+#ifndef PARALLEL_FOR_H
+#define PARALLEL_FOR_H
+
+/*
+A minimal parallel for loop. The work items are fetched from an atomic counter, so
+big and small meshes are distributed evenly over the worker threads.
+The callback must not touch any Maya API objects, Maya is not thread safe. Everything
+needed has to be collected on the main thread before.
+If the rendering is cancelled, no new work items are started. The caller has to check
+the cancel token afterwards, the results of the remaining elements are missing.
+*/
+
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <functional>
+#include "cancelToken.h"
+
+namespace MayaTo{
+
+	inline unsigned int getNumWorkerThreads(int requestedThreads = 0)
+	{
+		unsigned int numThreads = std::thread::hardware_concurrency();
+		if (requestedThreads > 0)
+			numThreads = (unsigned int)requestedThreads;
+		if (numThreads == 0)
+			numThreads = 1;
+		return numThreads;
+	}
+
+	inline void parallelFor(size_t numElements, std::function<void(size_t)> func, int requestedThreads = 0)
+	{
+		if (numElements == 0)
+			return;
+
+		unsigned int numThreads = getNumWorkerThreads(requestedThreads);
+		if (numThreads > numElements)
+			numThreads = (unsigned int)numElements;
+
+		// no need to start a thread for a single element
+		if (numThreads < 2)
+		{
+			for (size_t i = 0; (i < numElements) && !isRenderCancelled(); i++)
+				func(i);
+			return;
+		}
+
+		std::atomic<size_t> nextIndex(0);
+		auto worker = [&]()
+		{
+			for (size_t i = nextIndex++; (i < numElements) && !isRenderCancelled(); i = nextIndex++)
+				func(i);
+		};
+
+		std::vector<std::thread> workers;
+		// the calling thread works too
+		for (unsigned int t = 1; t < numThreads; t++)
+			workers.push_back(std::thread(worker));
+		worker();
+		for (auto& t : workers)
+			t.join();
+	}
+}
+
+#endif
@@ -2,6 +2,16 @@
 
 namespace EventQueue
 {
+static concurrent_queue<Event> EventList;
+static concurrent_queue<Event> LogEventList;
+
+int getEventLane(const Event& e)
+{
+	if ((e.type == Event::INTERRUPT) || (e.type == Event::IPRSTOP))
+		return URGENT_LANE;
+	return NORMAL_LANE;
+}
+
 concurrent_queue<Event> *theQueue()
 {
 	return &EventList;
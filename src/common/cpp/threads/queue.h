@@ -2,10 +2,8 @@
 #define MTAP_QUEUE_H
 
 #include <memory>
-#include <queue>
-#include "boost/thread/mutex.hpp"
-#include "boost/thread/condition_variable.hpp"
 #include <maya/MRenderView.h>
+#include "concurrentQueue.h"
 #include "../world.h"
 
 namespace EventQueue 
@@ -35,7 +33,8 @@ namespace EventQueue
 			INITRENDER = 19,
 			INTERACTIVEFBCALLBACK = 20,
 			ADDIPRCALLBACKS = 21,
-			FRAMERENDER = 22
+			FRAMERENDER = 22,
+			IPRUPDATEREGION = 23
 		};
 		enum PixelMode{
 			RECT = 0,
@@ -66,62 +65,17 @@ namespace EventQueue
 
 
 template<typename Data>
-class concurrent_queue
-{
-private:
-    std::queue<Data> the_queue;
-    mutable boost::mutex the_mutex;
-    boost::condition_variable the_condition_variable;
-public:
-    void push(Data const& data)
-    {
-        boost::mutex::scoped_lock lock(the_mutex);
-        the_queue.push(data);
-        lock.unlock();
-        the_condition_variable.notify_one();
-    }
-
-    bool empty() const
-    {
-        boost::mutex::scoped_lock lock(the_mutex);
-        return the_queue.empty();
-    }
-
-    size_t size() const
-    {
-		return the_queue.size();
-    }
-
-    bool try_pop(Data& popped_value)
-    {
-        boost::mutex::scoped_lock lock(the_mutex);
-        if(the_queue.empty())
-        {
-            return false;
-        }
-        
-        popped_value=the_queue.front();
-        the_queue.pop();
-        return true;
-    }
-
-    void wait_and_pop(Data& popped_value)
-    {
-        boost::mutex::scoped_lock lock(the_mutex);
-        while(the_queue.empty())
-        {
-            the_condition_variable.wait(lock);
-        }
-        popped_value=the_queue.front();
-        the_queue.pop();
-    }
+using concurrent_queue = MayaTo::ConcurrentQueue<Data>;
 
+// interrupts and ipr stops are handled before all waiting tile updates
+enum Lanes{
+	NORMAL_LANE = 0,
+	URGENT_LANE = 1,
+	NUM_LANES = 2
 };
+int getEventLane(const Event& e);
 
 
-static concurrent_queue<Event> EventList;
-static concurrent_queue<Event> LogEventList;
-
 concurrent_queue<Event> *theQueue();
 concurrent_queue<Event> *theLogQueue();
 
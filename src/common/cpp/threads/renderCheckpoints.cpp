@@ -0,0 +1,128 @@
+#include "renderCheckpoints.h"
+#include <chrono>
+#include <cstdio>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include "rendering/renderer.h"
+#include "utilities/logging.h"
+#include "utilities/tracing.h"
+#include "../world.h"
+
+namespace MayaTo{
+
+	static RenderCheckpoints renderCheckpoints;
+
+	RenderCheckpoints& getRenderCheckpoints()
+	{
+		return renderCheckpoints;
+	}
+
+	static bool fileExists(const MString& fileName)
+	{
+		struct stat fileInfo;
+		return stat(fileName.asChar(), &fileInfo) == 0;
+	}
+
+	// the previous checkpoint is only replaced by a completely written file
+	static bool replaceFile(const MString& source, const MString& destination)
+	{
+#ifdef _WIN32
+		return MoveFileExA(source.asChar(), destination.asChar(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+		return std::rename(source.asChar(), destination.asChar()) == 0;
+#endif
+	}
+
+	RenderCheckpoints::RenderCheckpoints() : interval(0.0f), active(false)
+	{}
+
+	void RenderCheckpoints::prepareFrame(const MString& fileBaseName, float intervalSeconds)
+	{
+		this->fileName = fileBaseName;
+		this->interval = (intervalSeconds < 1.0f) ? 1.0f : intervalSeconds;
+	}
+
+	bool RenderCheckpoints::isActive() const
+	{
+		return this->active;
+	}
+
+	void RenderCheckpoints::begin(std::shared_ptr<Renderer> frameRenderer)
+	{
+		if ((this->fileName.length() == 0) || !frameRenderer || !frameRenderer->canCheckpoint())
+			return;
+		this->renderer = frameRenderer;
+		MString baseName = this->fileName;
+		this->fileName = baseName + "." + this->renderer->getCheckpointExtension();
+		this->tempFileName = baseName + "_tmp." + this->renderer->getCheckpointExtension();
+
+		if (fileExists(this->fileName))
+		{
+			if (this->renderer->resumeFromCheckpoint(this->fileName))
+				Logging::info(MString("Resuming rendering from checkpoint ") + this->fileName);
+			else
+				Logging::warning(MString("Unable to resume from checkpoint ") + this->fileName + ", rendering from scratch.");
+		}
+
+		this->active = true;
+		this->watchThread = std::thread(&RenderCheckpoints::watch, this);
+	}
+
+	void RenderCheckpoints::end(bool frameCompleted)
+	{
+		if (!this->active)
+			return;
+		{
+			std::lock_guard<std::mutex> lock(this->watchMutex);
+			this->active = false;
+		}
+		this->watchCondition.notify_all();
+		if (this->watchThread.joinable())
+			this->watchThread.join();
+
+		std::lock_guard<std::mutex> lock(this->writeMutex);
+		if (frameCompleted)
+		{
+			std::remove(this->fileName.asChar());
+			Logging::debug(MString("Frame completed, checkpoint removed: ") + this->fileName);
+		}
+		std::remove(this->tempFileName.asChar());
+		this->renderer.reset();
+		this->fileName = "";
+	}
+
+	bool RenderCheckpoints::write()
+	{
+		std::lock_guard<std::mutex> lock(this->writeMutex);
+		if (!this->active || !this->renderer)
+			return false;
+		// before the first pass there is nothing to save
+		if (getWorldPtr()->getRenderState() != MayaToWorld::RSTATERENDERING)
+			return false;
+		TRACE_ZONE("RenderCheckpoints::write");
+		if (!this->renderer->writeCheckpoint(this->tempFileName) || !replaceFile(this->tempFileName, this->fileName))
+		{
+			Logging::error(MString("Unable to write checkpoint ") + this->fileName);
+			return false;
+		}
+		Logging::info(MString("Checkpoint saved: ") + this->fileName);
+		return true;
+	}
+
+	void RenderCheckpoints::watch()
+	{
+		setTraceThreadName("checkpoints");
+		std::chrono::milliseconds waitTime((long long)(this->interval * 1000.0f));
+		std::unique_lock<std::mutex> lock(this->watchMutex);
+		while (this->active)
+		{
+			if (this->watchCondition.wait_for(lock, waitTime, [this]{ return !this->active; }))
+				break;
+			lock.unlock();
+			this->write();
+			lock.lock();
+		}
+	}
+}
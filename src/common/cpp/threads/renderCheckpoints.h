@@ -0,0 +1,59 @@
+#ifndef MAYATO_RENDER_CHECKPOINTS_H
+#define MAYATO_RENDER_CHECKPOINTS_H
+
+/*
+	Checkpoints of long progressive renderings.
+
+	While a frame is rendered, a thread asks the renderer in regular intervals to save its accumulated samples
+	(Renderer::writeCheckpoint()). The renderer uses its own format which contains the float buffers and the
+	sample counts, e.g. the Corona framebuffer dump or the Lux film. The file is written under a temporary name
+	and then replaces the previous checkpoint, so a node which is killed while writing still has a valid one.
+
+	If the rendering is cancelled, e.g. a farm node is preempted with SIGTERM, a last checkpoint is written before
+	the renderer is aborted. The next rendering of the same frame finds the file and continues from the saved
+	samples. A completely rendered frame removes its checkpoint.
+*/
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <maya/MString.h>
+
+namespace MayaTo{
+
+	class Renderer;
+
+	class RenderCheckpoints
+	{
+	public:
+		RenderCheckpoints();
+		// main thread, before the frame is rendered: the checkpoint file without extension.
+		// An empty name switches the checkpoints off for this frame.
+		void prepareFrame(const MString& fileBaseName, float intervalSeconds);
+		// render thread, before Renderer::render(): resumes from an existing checkpoint and starts the periodic writing
+		void begin(std::shared_ptr<Renderer> renderer);
+		// render thread, after Renderer::render(): a completely rendered frame does not need its checkpoint anymore
+		void end(bool frameCompleted);
+		// writes a checkpoint immediately if the renderer is rendering
+		bool write();
+		bool isActive() const;
+
+	private:
+		void watch();
+		MString fileName;
+		MString tempFileName;
+		float interval;
+		std::shared_ptr<Renderer> renderer;
+		std::atomic<bool> active;
+		std::thread watchThread;
+		std::mutex watchMutex;
+		std::condition_variable watchCondition;
+		std::mutex writeMutex;
+	};
+
+	RenderCheckpoints& getRenderCheckpoints();
+}
+
+#endif
@@ -13,16 +13,21 @@
 #include <maya/MFnDagNode.h>
 #include <maya/MFnMesh.h>
 
-#include "Compute.h"
 #include "renderQueueWorker.h"
+#include "cancelToken.h"
+#include "framePipeline.h"
+#include "renderCheckpoints.h"
+#include "iprChangeTracker.h"
 #include "utilities/logging.h"
 #include "utilities/tools.h"
+#include "utilities/tracing.h"
+#include "utilities/sceneStatistics.h"
 #include "mayaSceneFactory.h"
 #include "memory/memoryInfo.h"
-#include "../dummyRenderer/dummyScene.h"
 #include "../mayaScene.h"
 #include "../world.h"
 #include "../renderProcess.h"
+#include "../renderGlobalsSnapshot.h"
 
 //static 
 std::thread RenderQueueWorker::sceneThread;
@@ -31,23 +36,26 @@ static int numTiles = 0;
 static int tilesDone = 0;
 //static MCallbackId timerCallbackId = 0;
 static MCallbackId idleCallbackId = 0;
-static MCallbackId computationInterruptCallbackId = 0;
 static MCallbackId sceneCallbackId0 = 0;
 static MCallbackId sceneCallbackId1 = 0;
 static MCallbackId pluginCallbackId = 0;
 static MCallbackId nodeAddedCallbackId = 0;
 static MCallbackId nodeRemovedCallbackId = 0;
 static std::vector<MCallbackId> nodeCallbacks;
-static std::vector<InteractiveElement *> modifiedElementList;
 static clock_t renderStartTime = 0;
 static clock_t renderEndTime = 0;
 static bool IprCallbacksDone = false;
+static bool pipelinedSequence = false;
 static std::map<MCallbackId, MObject> objIdMap;
-static std::map<MCallbackId, InteractiveElement *> idInteractiveMap;
+static IPRChangeTracker iprChangeTracker;
+// how often the timer callback checks if the modified elements can be sent to the renderer
+static const float IPR_UPDATE_CHECK_INTERVAL = 0.05f;
 
-static Compute renderComputation = Compute();
 static std::vector<Callback> callbackList;
 
+// unbounded because the main thread pushes events into the queue it works off
+static EventQueue::concurrent_queue<EventQueue::Event> RenderEventQueue(0, EventQueue::NUM_LANES, MayaTo::QUEUE_FIFO, EventQueue::getEventLane);
+
 EventQueue::concurrent_queue<EventQueue::Event> *theRenderEventQueue()
 {
 	return &RenderEventQueue;
@@ -107,6 +115,75 @@ MString RenderQueueWorker::getCaptionString()
 	return captionString;
 }
 
+static MString getReportSceneName()
+{
+	MString sceneName = "untitled";
+	if (MayaTo::getWorldPtr()->worldScenePtr && (MayaTo::getWorldPtr()->worldScenePtr->getFileName().length() > 0))
+		sceneName = MayaTo::getWorldPtr()->worldScenePtr->getFileName();
+	return sceneName;
+}
+
+// every frame gets its own file: fileDir/<scene>_<frame>, without extension.
+// If no directory is defined, the subdirectory of the project render data is used.
+static MString getFrameFilePath(MString fileDir, const MString& defaultSubDir)
+{
+	std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;
+	if (fileDir.length() == 0)
+		fileDir = renderGlobals->basePath + "/" + defaultSubDir;
+	MGlobal::executeCommand(MString("sysFile -makeDir \"") + fileDir + "\"");
+	return fileDir + "/" + getReportSceneName() + "_" + renderGlobals->getFrameNumber();
+}
+
+// batch sequences of renderers with a standalone renderer are exported frame by frame and rendered in child processes
+static bool usePipelinedSequence()
+{
+	std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;
+	if (!renderGlobals->pipelineSequence)
+		return false;
+	if ((MGlobal::mayaState() != MGlobal::kBatch) || (MayaTo::getWorldPtr()->renderType == MayaTo::MayaToWorld::WorldRenderType::IPRRENDER))
+	{
+		Logging::info("Pipelined sequence rendering is only used in batch mode.");
+		return false;
+	}
+	if (!MayaTo::getWorldPtr()->worldRendererPtr->canRenderSceneFile())
+	{
+		Logging::warning(getRendererName() + " cannot render exported scene files, pipelined sequence rendering is not used.");
+		return false;
+	}
+	MayaTo::getFramePipeline().setMaxFramesInFlight(renderGlobals->framesInFlight);
+	Logging::info(MString("Pipelined sequence rendering with ") + MayaTo::getFramePipeline().getMaxFramesInFlight() + " frames in flight.");
+	return true;
+}
+
+// in a pipelined sequence the post frame script is executed when the standalone renderer has written the image.
+// At this time maya is already at a later frame, the script cannot use the current time.
+static void runPipelinedPostFrameScripts()
+{
+	std::vector<float> frames = MayaTo::getFramePipeline().takeRenderedFrames();
+	for (float frame : frames)
+	{
+		Logging::debug(MString("Post frame script of frame ") + frame);
+		RenderProcess::doPostFrameScript();
+	}
+}
+
+static void writeFrameTrace()
+{
+	if (!MayaTo::isTracingEnabled())
+		return;
+	MayaTo::writeTrace(getFrameFilePath(MayaTo::getWorldPtr()->worldRenderGlobalsPtr->traceFilePath, "trace") + ".json");
+}
+
+static void writeFrameStatistics()
+{
+	if (!MayaTo::getSceneStatistics().isEnabled())
+		return;
+	std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;
+	if (MayaTo::getWorldPtr()->worldScenePtr)
+		MayaTo::getWorldPtr()->worldScenePtr->collectStatistics();
+	MayaTo::getSceneStatistics().writeReport(getFrameFilePath(renderGlobals->statisticsFilePath, "statistics"), getReportSceneName(), renderGlobals->getFrameNumber());
+}
+
 void RenderQueueWorker::callbackWorker(size_t cbId)
 {
 	while (callbackList[cbId].terminate == false)
@@ -182,7 +259,7 @@ void RenderQueueWorker::addIPRCallbacks()
 			MFnDependencyNode depFn(iae.mobj);
 			nodeDirty = iae.mobj;
 		}
-		Logging::debug(MString("Adding dirty callback node ") + getObjectName(nodeDirty));
+		LOG_DEBUG(MString("Adding dirty callback node ") + getObjectName(nodeDirty));
 		InteractiveElement *userData = &mayaScene->interactiveUpdateMap[elementId];
 		MCallbackId id = MNodeMessage::addNodeDirtyCallback(nodeDirty, RenderQueueWorker::IPRNodeDirtyCallback, userData, &stat);
 		objIdMap[id] = nodeDirty;
@@ -199,8 +276,10 @@ void RenderQueueWorker::addIPRCallbacks()
 		}
 	}
 
+	iprChangeTracker.buildIndex(mayaScene->interactiveUpdateMap);
+
 	//idleCallbackId = MEventMessage::addEventCallback("idle", RenderQueueWorker::renderQueueWorkerIPRIdleCallback, nullptr, &stat);
-	idleCallbackId = MTimerMessage::addTimerCallback(0.2, RenderQueueWorker::IPRIdleCallback, nullptr, &stat);
+	idleCallbackId = MTimerMessage::addTimerCallback(IPR_UPDATE_CHECK_INTERVAL, RenderQueueWorker::IPRIdleCallback, nullptr, &stat);
 	sceneCallbackId0 = MSceneMessage::addCallback(MSceneMessage::kBeforeNew, RenderQueueWorker::sceneCallback, nullptr, &stat);
 	sceneCallbackId1 = MSceneMessage::addCallback(MSceneMessage::kBeforeOpen, RenderQueueWorker::sceneCallback, nullptr, &stat);
 	pluginCallbackId = MSceneMessage::addCallback(MSceneMessage::kBeforePluginUnload, RenderQueueWorker::sceneCallback, nullptr, &stat);
@@ -231,7 +310,7 @@ void RenderQueueWorker::IPRUpdateCallbacks()
 		if (id == 0)
 		{
 			MObject nodeDirty = element->node;
-			Logging::debug(MString("IPRUpdateCallbacks. Found element without callback: ") + getObjectName(nodeDirty));
+			LOG_DEBUG(MString("IPRUpdateCallbacks. Found element without callback: ") + getObjectName(nodeDirty));
 			id = MNodeMessage::addNodeDirtyCallback(nodeDirty, RenderQueueWorker::IPRNodeDirtyCallback, element, &stat);
 			objIdMap[id] = nodeDirty;
 			if (stat)
@@ -242,7 +321,7 @@ void RenderQueueWorker::IPRUpdateCallbacks()
 
 void  RenderQueueWorker::IPRattributeChangedCallback(MNodeMessage::AttributeMessage msg, MPlug & plug,	MPlug & otherPlug, void *element)
 {
-	Logging::debug(MString("IPRattributeChangedCallback. attribA: ") + plug.name() + " attribB: " + otherPlug.name());
+	LOG_DEBUG(MString("IPRattributeChangedCallback. attribA: ") + plug.name() + " attribB: " + otherPlug.name());
 	InteractiveElement *userData = (InteractiveElement *)element;
 	std::shared_ptr<MayaScene> mayaScene = MayaTo::getWorldPtr()->worldScenePtr;
 
@@ -259,8 +338,7 @@ void  RenderQueueWorker::IPRattributeChangedCallback(MNodeMessage::AttributeMess
 			Logging::debug(MString("IPRattributeChangedCallback. InstObjGroups affected, checking other side."));
 			if (otherPlug.node().hasFn(MFn::kShadingEngine))
 			{ 
-				Logging::debug(MString("IPRattributeChangedCallback. Found shading group on the other side: ") + getObjectName(otherPlug.node()));
-				MCallbackId thisId = MMessage::currentCallbackId();
+				LOG_DEBUG(MString("IPRattributeChangedCallback. Found shading group on the other side: ") + getObjectName(otherPlug.node()));
 				MObject sgNode = otherPlug.node();
 				InteractiveElement iel;
 				iel.mobj = sgNode;
@@ -268,7 +346,7 @@ void  RenderQueueWorker::IPRattributeChangedCallback(MNodeMessage::AttributeMess
 				iel.node = sgNode;
 				iel.obj = userData->obj;
 				mayaScene->interactiveUpdateMap[mayaScene->interactiveUpdateMap.size()] = iel;
-				idInteractiveMap[thisId] = &mayaScene->interactiveUpdateMap[mayaScene->interactiveUpdateMap.size() -1];
+				iprChangeTracker.markDirty(&mayaScene->interactiveUpdateMap[mayaScene->interactiveUpdateMap.size() - 1]);
 			}
 		}
 	}
@@ -296,7 +374,7 @@ void  RenderQueueWorker::IPRattributeChangedCallback(MNodeMessage::AttributeMess
 
 // register new created nodes. We need the transform and the shape node to correctly use it in IPR.
 // So we simply use the shape node, get it's parent - a shape node and let the scene parser do the rest.
-// Then add a node dirty callback for the new elements. By adding the callback ids to the idInteractiveMap, the 
+// Then add a node dirty callback for the new elements. By marking the new shape as dirty, the
 // IPR should detect a modification during the netxt update cycle.
 
 // Handling of surface shaders is a bit different. A shader is not assigned directly to a surface but it is connected to a shading group
@@ -305,7 +383,7 @@ void  RenderQueueWorker::IPRattributeChangedCallback(MNodeMessage::AttributeMess
 
 void RenderQueueWorker::IPRNodeAddedCallback(MObject& node, void *userPtr)
 {
-	Logging::debug(MString("IPRNodeAddedCallback. Node: ") + getObjectName(node));
+	LOG_DEBUG(MString("IPRNodeAddedCallback. Node: ") + getObjectName(node));
 	std::shared_ptr<MayaScene> mayaScene = MayaTo::getWorldPtr()->worldScenePtr;
 	MStatus stat;
 
@@ -337,8 +415,6 @@ void RenderQueueWorker::IPRNodeAddedCallback(MObject& node, void *userPtr)
 	MString tname = getObjectName(transform);
 	mayaScene->parseSceneHierarchy(dagPath, 0, nullptr, nullptr);
 
-	idInteractiveMap.clear();
-	
 	MCallbackId transformId = 0;
 	InteractiveElement *userData = nullptr;
 
@@ -353,9 +429,10 @@ void RenderQueueWorker::IPRNodeAddedCallback(MObject& node, void *userPtr)
 			userData = &mayaScene->interactiveUpdateMap[riter->first];
 			MCallbackId id = MNodeMessage::addNodeDirtyCallback(ie.node, RenderQueueWorker::IPRNodeDirtyCallback, userData);
 			objIdMap[id] = ie.node;
+			iprChangeTracker.addToIndex(userData);
 
-			if ( ie.node == node ) // we only add the shape node to the update map because do not want a transform update
-				idInteractiveMap[id] = userData;
+			if ( ie.node == node ) // we only add the shape node to the update list because do not want a transform update
+				iprChangeTracker.markDirty(userData);
 
 			if (ie.node.hasFn(MFn::kMesh))
 			{
@@ -372,7 +449,7 @@ void RenderQueueWorker::IPRNodeAddedCallback(MObject& node, void *userPtr)
 
 void RenderQueueWorker::IPRNodeRemovedCallback(MObject& node, void *userPtr)
 {
-	Logging::debug(MString("IPRNodeRemovedCallback. Removing node: ") + getObjectName(node));
+	LOG_DEBUG(MString("IPRNodeRemovedCallback. Removing node: ") + getObjectName(node));
 
 	//get the callback id and remove the callback for this node and remove the callback from the list
 	std::map<MCallbackId, MObject>::iterator idIter;
@@ -402,7 +479,7 @@ void RenderQueueWorker::IPRNodeRemovedCallback(MObject& node, void *userPtr)
 			{
 				ie.obj->removed = true;
 				// trigger a ipr scene update
-				idInteractiveMap[nodeCallbackId] = &mayaScene->interactiveUpdateMap[iter->first];
+				iprChangeTracker.markDirty(&mayaScene->interactiveUpdateMap[iter->first]);
 				break;
 			}
 		}
@@ -453,90 +530,88 @@ void RenderQueueWorker::removeCallbacks()
 		MMessage::removeCallback(*iter);
 	nodeCallbacks.clear();
 	objIdMap.clear();
-	modifiedElementList.clear(); // make sure that the iprFindLeafNodes exits with an empty list
+	iprChangeTracker.clear();
+	removeRenderGlobalsSnapshotCallback();
 }
 
-// one problem: In most cases the renderer translates shapes only not complete hierarchies
-// To do a correct update of all interesting nodes, I have to find the shapes below a transform node.
-// Here we fill the modifiedElementList with shape nodes and non transform nodes
-
-void RenderQueueWorker::iprFindLeafNodes()
+// In most cases the renderer translates shapes only not complete hierarchies, so the change tracker
+// replaces a modified transform by the shapes below it before the elements are sent to the renderer.
+// Cheap changes like a color or a light intensity are sent without delay if the renderer can update them while rendering,
+// all other changes stop the renderer and are sent together after the debounce time.
+void RenderQueueWorker::IPRIdleCallback(float time, float lastTime, void *userPtr)
 {
-	std::shared_ptr<MayaScene> mayaScene = MayaTo::getWorldPtr()->worldScenePtr;
-	static std::map<MCallbackId, InteractiveElement *>::iterator it;
-	std::vector<InteractiveElement *> leafList;
-	for (auto element : idInteractiveMap)
-	{
-		MObject node = element.second->node;
-		if (node.hasFn(MFn::kTransform))
-		{
-			MItDag dagIter;
-			for (dagIter.reset(node); !dagIter.isDone(); dagIter.next())
-			{
-				if (dagIter.currentItem().hasFn(MFn::kShape))
-				{
-					//Logging::debug(MString("findLeaf: found shape node below transform: ") + dagIter.fullPathName());
-					for (auto sceneElement : mayaScene->interactiveUpdateMap)
-					{
-						if (sceneElement.second.node.hasFn(MFn::kShape))
-						{
-							InteractiveElement iel = sceneElement.second;
-							//Logging::debug(MString("findLeaf: sceneElement shape: ") + iel.obj->fullName + " dag " + iel.obj->dagPath.fullPathName() + " dagdga " + dagIter.fullPathName());
-							//if (dagIter.fullPathName() == iel.obj->dagPath.fullPathName())
-							//if (dagIter.currentItem() == sceneElement.second.obj->dagPath.node())
-							if (sceneElement.second.node == dagIter.currentItem())
-							{
-								//Logging::debug(MString("findLeaf: found element shape: ") + sceneElement.second.name + " for dag shape: " + dagIter.fullPathName());
-								InteractiveElement *ie = &mayaScene->interactiveUpdateMap[sceneElement.first];
-								ie->triggeredFromTransform = true;
-								leafList.push_back(&mayaScene->interactiveUpdateMap[sceneElement.first]);
-							}
-						}
-					}
-				}
-			}
-		}
-		else{
-			leafList.push_back(element.second);
-		}
-	}
+	std::shared_ptr<MayaTo::Renderer> renderer = MayaTo::getWorldPtr()->worldRendererPtr;
+	if (!iprChangeTracker.isReadyToFlush(renderer->canUpdateWhileRendering(iprChangeTracker.getDirtyCost())))
+		return;
 
-	Logging::debug(MString("iprFindLeafNodes ") + leafList.size());
-	
-	// the idea is that the renderer waits in IPR mode for an non empty modifiesElementList,
-	// it updates the render database with the elements and empties the list which is then free for the next run
-	while (modifiedElementList.size() > 0)
-		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	iprChangeTracker.flush();
+	if (renderer->canUpdateWhileRendering(iprChangeTracker.getPendingCost()))
+		renderer->requestLiveUpdate();
+	else
+		renderer->abortRendering();
+}
 
-	for (auto leaf : leafList)
-		modifiedElementList.push_back(leaf);
+bool RenderQueueWorker::applyInteractiveUpdates(int maxUpdateCost)
+{
+	std::shared_ptr<MayaTo::Renderer> renderer = MayaTo::getWorldPtr()->worldRendererPtr;
+	renderer->interactiveUpdateList.clear();
+	if (!iprChangeTracker.takeChanges(renderer->interactiveUpdateList, (IPRUpdateCost)maxUpdateCost))
+		return false;
+	Logging::debug(MString("applyInteractiveUpdates: ") + (int)renderer->interactiveUpdateList.size() + " elements.");
+	renderer->doInteractiveUpdate();
+	iprChangeTracker.updateDone();
+	return true;
 }
-void RenderQueueWorker::IPRIdleCallback(float time, float lastTime, void *userPtr)
+
+void RenderQueueWorker::applyLiveUpdates()
 {
-	if (idInteractiveMap.empty())
+	applyInteractiveUpdates(IPR_UPDATE_TRANSFORM);
+}
+
+// Only the part of the image which is rendered changes, so the renderer keeps its translated scene.
+// The render view returns the whole image if no region is drawn.
+void RenderQueueWorker::updateIprRenderRegion()
+{
+	std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;
+	std::shared_ptr<MayaTo::Renderer> renderer = MayaTo::getWorldPtr()->worldRendererPtr;
+	if (!renderGlobals || !renderer || !MRenderView::doesRenderEditorExist())
+		return;
+	int width, height;
+	renderGlobals->getWidthHeight(width, height);
+	uint left, right, bottom, top;
+	MRenderView::getRenderRegion(left, right, bottom, top);
+	bool useRegion = (left > 0) || (bottom > 0) || ((int)right < width - 1) || ((int)top < height - 1);
+	renderGlobals->setRenderRegion(left, bottom, right, top);
+	renderGlobals->setUseRenderRegion(useRegion);
+	Logging::debug(MString("updateIprRenderRegion: ") + (int)left + " " + (int)bottom + " " + (int)right + " " + (int)top + (useRegion ? "" : " (whole image)"));
+
+	if (!renderer->updateRenderRegion())
 	{
+		Logging::info("The new render region is used with the next IPR start.");
 		return;
 	}
-
-	Logging::debug(MString("renderQueueWorkerIdleCallback::Updatelist size ") + idInteractiveMap.size());
-
-	MayaTo::getWorldPtr()->worldRendererPtr->abortRendering();
-	iprFindLeafNodes();
-	idInteractiveMap.clear();
+	if (renderer->canUpdateWhileRendering(IPR_UPDATE_PARAMETER))
+	{
+		renderer->requestLiveUpdate();
+	}
+	else{
+		renderer->abortRendering();
+		iprChangeTracker.requestRestart();
+	}
 }
 
 void RenderQueueWorker::IPRNodeDirtyCallback(void *interactiveElement)
 {
 	MStatus stat;
 	InteractiveElement *userData = (InteractiveElement *)interactiveElement;
-
-	MCallbackId thisId = MMessage::currentCallbackId();
-	idInteractiveMap[thisId] = userData;
+	iprChangeTracker.markDirty(userData);
 }
 
 
 void RenderQueueWorker::renderQueueWorkerTimerCallback( float time, float lastTime, void *userPtr)
 {
+	// while the renderer works in the render thread, the main thread only comes here
+	MayaTo::pollUserInterrupt();
 	RenderQueueWorker::startRenderQueueWorker();
 }
 
@@ -544,17 +619,20 @@ void RenderQueueWorker::renderQueueWorkerTimerCallback( float time, float lastTi
 void RenderQueueWorker::computationEventThread()
 {
 	bool done = false;
-	bool renderingStarted = false;
 	while (!done)
 	{
-		if (MayaTo::getWorldPtr()->getRenderState() == MayaTo::MayaToWorld::RSTATERENDERING)
-			renderingStarted = true;
-		if (renderingStarted && (MayaTo::getWorldPtr()->getRenderState() != MayaTo::MayaToWorld::RSTATERENDERING))
+		// a cancelled translation never reaches the rendering state, so the thread runs until the whole rendering is finished.
+		// During translation the translation loops check the cancel token themselves, only a running renderer has to be aborted.
+		MayaTo::MayaToWorld::WorldRenderState renderState = MayaTo::getWorldPtr()->getRenderState();
+		if ((renderState == MayaTo::MayaToWorld::RSTATEDONE) || (renderState == MayaTo::MayaToWorld::RSTATENONE) || (renderState == MayaTo::MayaToWorld::RSTATEERROR) || (renderState == MayaTo::MayaToWorld::RSTATESTOPPED))
 			done = true;
-		if (renderComputation.isInterruptRequested() && (MayaTo::getWorldPtr()->getRenderState() == MayaTo::MayaToWorld::RSTATERENDERING))
+		if (!done && (renderState == MayaTo::MayaToWorld::RSTATERENDERING) && MayaTo::getRenderCancelToken().isCancelled())
 		{
 			Logging::debug("computationEventThread::InterruptRequested.");
 			done = true;
+			// a preempted or cancelled rendering keeps its samples for the next start
+			if (MayaTo::getRenderCheckpoints().isActive())
+				MayaTo::getRenderCheckpoints().write();
 			EventQueue::Event e;
 			e.type = EventQueue::Event::INTERRUPT;
 			theRenderEventQueue()->push(e);
@@ -570,24 +648,31 @@ void RenderQueueWorker::renderProcessThread()
 {
 	if (MayaTo::getWorldPtr()->renderType == MayaTo::MayaToWorld::WorldRenderType::IPRRENDER)
 	{
-		// the idea is that the renderer waits in IPR mode for an non empty modifiesElementList,
-		// it updates the render database with the elements and empties the list which is then free for the next run
+		// the idea is that the renderer waits in IPR mode for changes from the change tracker,
+		// it takes all of them, updates the render database with the elements and restarts rendering
 		while ((MayaTo::getWorldPtr()->renderType == MayaTo::MayaToWorld::WorldRenderType::IPRRENDER))
 		{
+			setMemoryPhase(MEMPHASE_RENDER);
 			MayaTo::getWorldPtr()->worldRendererPtr->render();
-			while ((modifiedElementList.size() == 0) && (MayaTo::getWorldPtr()->renderType == MayaTo::MayaToWorld::WorldRenderType::IPRRENDER) && (MayaTo::getWorldPtr()->renderState != MayaTo::MayaToWorld::WorldRenderState::RSTATESTOPPED))
-				std::this_thread::sleep_for(std::chrono::milliseconds(100));
+			while (!iprChangeTracker.waitForChanges(100) && (MayaTo::getWorldPtr()->renderType == MayaTo::MayaToWorld::WorldRenderType::IPRRENDER) && (MayaTo::getWorldPtr()->renderState != MayaTo::MayaToWorld::WorldRenderState::RSTATESTOPPED))
+			{}
 			if ((MayaTo::getWorldPtr()->renderType != MayaTo::MayaToWorld::WorldRenderType::IPRRENDER) || (MayaTo::getWorldPtr()->renderState == MayaTo::MayaToWorld::WorldRenderState::RSTATESTOPPED))
 				break;
-			//MayaTo::getWorldPtr()->worldRendererPtr->abortRendering();
-			MayaTo::getWorldPtr()->worldRendererPtr->interactiveUpdateList = modifiedElementList;
-			MayaTo::getWorldPtr()->worldRendererPtr->doInteractiveUpdate();
-			modifiedElementList.clear();
+			setMemoryPhase(MEMPHASE_TRANSLATE);
+			applyInteractiveUpdates(IPR_UPDATE_GEOMETRY);
 		}
 	}
 	else{
 		Logging::debug("RenderQueueWorker::renderProcessThread()");
-		MayaTo::getWorldPtr()->worldRendererPtr->render();
+		// renderers which translate the scene in render() switch to the translate phase there
+		setMemoryPhase(MEMPHASE_RENDER);
+		MayaTo::setTraceThreadName("render");
+		TRACE_ZONE("Renderer::render");
+		std::shared_ptr<MayaTo::Renderer> renderer = MayaTo::getWorldPtr()->worldRendererPtr;
+		renderer->frameCompleted = false;
+		MayaTo::getRenderCheckpoints().begin(renderer);
+		renderer->render();
+		MayaTo::getRenderCheckpoints().end(renderer->frameCompleted && !MayaTo::isRenderCancelled());
 		Logging::debug("RenderQueueWorker::renderProcessThread() - DONE.");
 	}
 	EventQueue::Event event;
@@ -595,6 +680,34 @@ void RenderQueueWorker::renderProcessThread()
 	theRenderEventQueue()->push(event);
 }
 
+// pipelined sequence: the frame is written to a scene file and rendered in a child process,
+// the frame is done for the render queue as soon as the child is started
+void RenderQueueWorker::sceneFileExportThread(MString sceneDirectory, MString sceneFile, MString imageFile, float frame)
+{
+	Logging::debug("RenderQueueWorker::sceneFileExportThread()");
+	setMemoryPhase(MEMPHASE_TRANSLATE);
+	MayaTo::setTraceThreadName("export");
+	std::shared_ptr<MayaTo::Renderer> renderer = MayaTo::getWorldPtr()->worldRendererPtr;
+	bool exported = false;
+	{
+		TRACE_ZONE("Renderer::exportSceneFile");
+		exported = renderer->exportSceneFile(sceneFile);
+	}
+	if (!exported)
+	{
+		if (!MayaTo::isRenderCancelled())
+			Logging::error(MString("Unable to export frame ") + frame + " to " + sceneFile);
+		MayaTo::removeDirectory(sceneDirectory);
+	}
+	else{
+		// if all slots are busy, this waits until one of the previous frames is rendered
+		MayaTo::getFramePipeline().launch(renderer->getSceneFileRenderCommand(sceneFile, imageFile), frame, sceneDirectory);
+	}
+	EventQueue::Event event;
+	event.type = EventQueue::Event::FRAMEDONE;
+	theRenderEventQueue()->push(event);
+}
+
 void RenderQueueWorker::updateRenderView(EventQueue::Event& e)
 {
 	std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;
@@ -698,6 +811,13 @@ void RenderQueueWorker::startRenderQueueWorker()
 				}
 				// Here we create the overall scene, renderer and renderGlobals objects
 				MayaTo::getWorldPtr()->initializeRenderEnvironment();
+				// the framebuffer callbacks and the image output read the globals from the snapshot, not from the node
+				updateRenderGlobalsSnapshot();
+				addRenderGlobalsSnapshotCallback();
+				MayaTo::setTracingEnabled(MayaTo::getWorldPtr()->worldRenderGlobalsPtr->traceTranslation);
+				MayaTo::setTraceThreadName("main");
+				MayaTo::getSceneStatistics().setEnabled(MayaTo::getWorldPtr()->worldRenderGlobalsPtr->sceneStatistics);
+				pipelinedSequence = usePipelinedSequence();
 						
 				RenderProcess::doPreRenderJobs();
 				MayaTo::getWorldPtr()->worldRenderGlobalsPtr->setWidthHeight(e.cmdArgsData->width, e.cmdArgsData->height);
@@ -715,23 +835,14 @@ void RenderQueueWorker::startRenderQueueWorker()
 				MayaTo::getWorldPtr()->setRenderState(MayaTo::MayaToWorld::RSTATETRANSLATING);
 				std::shared_ptr<MayaScene> mayaScene = MayaTo::getWorldPtr()->worldScenePtr;
 
-				if (MGlobal::mayaState() != MGlobal::kBatch)
-				{
-					// we only need renderComputation (means esc-able rendering) if we render in UI (==NORMAL)
-					if (MayaTo::getWorldPtr()->getRenderType() == MayaTo::MayaToWorld::WorldRenderType::UIRENDER)
-					{
-						renderComputation.beginComputation();
-						void *data = nullptr;
-					}
-				}
+				// esc in the UI, SIGINT/SIGTERM in batch mode
+				MayaTo::beginInterruptWatch();
 				e.type = EventQueue::Event::FRAMERENDER;
 				theRenderEventQueue()->push(e);
 
-				if (MGlobal::mayaState() != MGlobal::kBatch)
-				{
-					std::thread cet = std::thread(RenderQueueWorker::computationEventThread);
-					cet.detach();
-				}
+				// forwards a cancel request to the renderer
+				std::thread cet = std::thread(RenderQueueWorker::computationEventThread);
+				cet.detach();
 
 				// calculate numtiles
 				int numTX = (int)ceil((float)width/(float)MayaTo::getWorldPtr()->worldRenderGlobalsPtr->tilesize);
@@ -749,14 +860,42 @@ void RenderQueueWorker::startRenderQueueWorker()
 				if (RenderQueueWorker::sceneThread.joinable())
 					RenderQueueWorker::sceneThread.join();
 
-				if (!MayaTo::getWorldPtr()->worldRenderGlobalsPtr->frameListDone())
+				if (!MayaTo::getWorldPtr()->worldRenderGlobalsPtr->frameListDone() && !MayaTo::isRenderCancelled())
 				{ 
 					MayaTo::getWorldPtr()->worldRenderGlobalsPtr->updateFrameNumber();
+					MayaTo::clearTrace();
+					MayaTo::getSceneStatistics().clear();
+					// the globals can be animated
+					updateRenderGlobalsSnapshot();
 					RenderProcess::doPreFrameJobs();
 					RenderProcess::doPrepareFrame();
-					RenderQueueWorker::sceneThread = std::thread(RenderQueueWorker::renderProcessThread);					
+					if (pipelinedSequence)
+					{
+						// file names are created here because they need the maya api
+						std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;
+						// every frame has its own directory, the child of the previous frame may still read its files
+						MString sceneDirectory = getFrameFilePath(renderGlobals->pipelineFilePath, "sceneFiles");
+						MGlobal::executeCommand(MString("sysFile -makeDir \"") + sceneDirectory + "\"");
+						MString sceneFile = sceneDirectory + "/" + getReportSceneName() + "_" + renderGlobals->getFrameNumber() + "." + MayaTo::getWorldPtr()->worldRendererPtr->getSceneFileExtension();
+						RenderQueueWorker::sceneThread = std::thread(RenderQueueWorker::sceneFileExportThread, sceneDirectory, sceneFile, renderGlobals->getImageOutputFile(), renderGlobals->getFrameNumber());
+					}
+					else{
+						std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;
+						// an ipr rendering never finishes a frame, so checkpoints are only written for final renderings
+						if (renderGlobals->checkpoints && (MayaTo::getWorldPtr()->renderType != MayaTo::MayaToWorld::WorldRenderType::IPRRENDER))
+							MayaTo::getRenderCheckpoints().prepareFrame(getFrameFilePath(renderGlobals->checkpointFilePath, "checkpoints"), renderGlobals->checkpointInterval * 60.0f);
+						else
+							MayaTo::getRenderCheckpoints().prepareFrame("", 0.0f);
+						RenderQueueWorker::sceneThread = std::thread(RenderQueueWorker::renderProcessThread);
+					}
 				}
 				else{
+					// the last frames can still be in the standalone renderer
+					if (pipelinedSequence)
+					{
+						MayaTo::getFramePipeline().waitForAll();
+						runPipelinedPostFrameScripts();
+					}
 					e.type = EventQueue::Event::RENDERDONE;
 					theRenderEventQueue()->push(e);
 				}
@@ -778,8 +917,16 @@ void RenderQueueWorker::startRenderQueueWorker()
 
 		case EventQueue::Event::FRAMEDONE:
 			Logging::debug("Event::FRAMEDONE");
-			RenderProcess::doPostFrameJobs();
+			setMemoryPhase(MEMPHASE_WRITE);
+			// the image of a pipelined frame does not exist yet, its post frame script runs when the child is done
+			RenderProcess::doPostFrameJobs(!pipelinedSequence);
+			if (pipelinedSequence)
+				runPipelinedPostFrameScripts();
 			RenderQueueWorker::updateRenderView(e);
+			setMemoryPhase(MEMPHASE_NONE);
+			writeFrameTrace();
+			writeFrameStatistics();
+			Logging::info(MString("Memory usage per phase:\n") + getMemoryPhaseReport().c_str());
 			e.type = EventQueue::Event::FRAMERENDER;
 			theRenderEventQueue()->push(e);
 			break;
@@ -788,12 +935,20 @@ void RenderQueueWorker::startRenderQueueWorker()
 			{
 				// stopp callbacks and empty queue before finalizing the rendering.
 				Logging::debug("Event::RENDERDONE");
-				if (MGlobal::mayaState() != MGlobal::kBatch)
-					renderComputation.endComputation();
+				// after a render error, frames of a pipelined sequence may still be running
+				if (pipelinedSequence)
+					MayaTo::getFramePipeline().terminateAll();
+				pipelinedSequence = false;
+				MayaTo::endInterruptWatch();
 				if (MayaTo::getWorldPtr()->renderType == MayaTo::MayaToWorld::WorldRenderType::IPRRENDER)
 				{
 					RenderQueueWorker::removeCallbacks();
 				}
+				removeRenderGlobalsSnapshotCallback();
+				MayaTo::setTracingEnabled(false);
+				MayaTo::clearTrace();
+				MayaTo::getSceneStatistics().setEnabled(false);
+				MayaTo::getSceneStatistics().clear();
 				MayaTo::getWorldPtr()->setRenderState(MayaTo::MayaToWorld::RSTATEDONE);
 				terminateLoop = true;
 
@@ -807,7 +962,7 @@ void RenderQueueWorker::startRenderQueueWorker()
 					MGlobal::executePythonCommandOnIdle(captionCmd);
 
 					// clean the queue
-					while (RenderEventQueue.try_pop(e)){}
+					RenderEventQueue.clear();
 				}
 
 				RenderProcess::doPostRenderJobs();
@@ -830,12 +985,14 @@ void RenderQueueWorker::startRenderQueueWorker()
 
 		case EventQueue::Event::INTERRUPT:
 			Logging::debug("Event::INTERRUPT");
+			MayaTo::getRenderCancelToken().cancel(MayaTo::CANCEL_ABORT);
 			MayaTo::getWorldPtr()->worldRendererPtr->abortRendering();
 			break;
 
 		case EventQueue::Event::IPRSTOP:
 			Logging::debug("Event::IPRSTOP");
 			MayaTo::getWorldPtr()->setRenderState(MayaTo::MayaToWorld::WorldRenderState::RSTATESTOPPED);
+			MayaTo::getRenderCancelToken().cancel(MayaTo::CANCEL_ABORT);
 			MayaTo::getWorldPtr()->worldRendererPtr->abortRendering();
 			//if (RenderQueueWorker::sceneThread.joinable())
 			//	RenderQueueWorker::sceneThread.join();
@@ -845,7 +1002,7 @@ void RenderQueueWorker::startRenderQueueWorker()
 
 		case EventQueue::Event::TILEDONE:
 			{
-				Logging::debug(MString("Event::TILEDONE - queueSize: ") + theRenderEventQueue()->size());
+				LOG_TRACE(MString("Event::TILEDONE - queueSize: ") + theRenderEventQueue()->size());
 				RenderQueueWorker::updateRenderView(e);
 				if (MayaTo::getWorldPtr()->renderType != MayaTo::MayaToWorld::WorldRenderType::IPRRENDER)
 				{
@@ -901,6 +1058,12 @@ void RenderQueueWorker::startRenderQueueWorker()
 			}
 			break;
 
+		case EventQueue::Event::IPRUPDATEREGION:
+			Logging::debug("Event::IPRUPDATEREGION");
+			if (MayaTo::getWorldPtr()->renderType == MayaTo::MayaToWorld::WorldRenderType::IPRRENDER)
+				updateIprRenderRegion();
+			break;
+
 		case EventQueue::Event::INTERACTIVEFBCALLBACK:
 			Logging::debug("Event::INTERACTIVEFBCALLBACK");
 			MayaTo::getWorldPtr()->worldRendererPtr->interactiveFbCallback();
@@ -940,8 +1103,6 @@ RenderQueueWorker::~RenderQueueWorker()
 {
 	// clean the queue
 	Logging::debug("~RenderQueueWorker");
-	EventQueue::Event e;
-	while(RenderEventQueue.try_pop(e))
-	{}
+	RenderEventQueue.clear();
 }
 
@@ -8,7 +8,6 @@
 #include "queue.h"
 #include <map>
 
-static EventQueue::concurrent_queue<EventQueue::Event> RenderEventQueue;
 EventQueue::concurrent_queue<EventQueue::Event> *theRenderEventQueue();
 
 struct Callback{
@@ -49,6 +48,7 @@ public:
 	static void computationEventThread();
 	static std::thread sceneThread;
 	static void renderProcessThread();
+	static void sceneFileExportThread(MString sceneDirectory, MString sceneFile, MString imageFile, float frame);
 	static void sendFinalizeIfQueueEmpty(void *);
 	static void setStartTime();
 	static void setEndTime();
@@ -59,10 +59,15 @@ public:
 	static void unregisterCallback(size_t cbId);
 	static void callbackWorker(size_t cbId);
 	static bool iprCallbacksDone();
-	static void iprFindLeafNodes();
 	static void iprWaitForFinish(EventQueue::Event e);
 
 	static void interactiveStartThread();
+	// takes the pending IPR changes up to maxUpdateCost and lets the renderer update its database, returns false if there were none
+	static bool applyInteractiveUpdates(int maxUpdateCost);
+	// for renderers which can update cheap changes while rendering, see Renderer::canUpdateWhileRendering()
+	static void applyLiveUpdates();
+	// IPR: reads the region of the render view and restarts the renderer with it, the scene is not translated again
+	static void updateIprRenderRegion();
 private:
 
 };
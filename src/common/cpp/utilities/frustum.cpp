@@ -0,0 +1,160 @@
+#include "frustum.h"
+#include <maya/MFnCamera.h>
+#include <maya/MFnDagNode.h>
+#include <maya/MPoint.h>
+#include <limits>
+
+namespace MayaTo{
+
+	Frustum::Frustum() : windowLeft(0.0), windowRight(0.0), windowBottom(0.0), windowTop(0.0), imageWindowWidth(0.0), imageWindowHeight(0.0), imageWidth(0), orthographic(false), valid(false)
+	{}
+
+	bool Frustum::create(const MDagPath& camera, int imageWidth, int imageHeight)
+	{
+		return this->create(camera, imageWidth, imageHeight, 0, 0, imageWidth - 1, imageHeight - 1);
+	}
+
+	bool Frustum::create(const MDagPath& camera, int imageWidth, int imageHeight, int left, int bottom, int right, int top)
+	{
+		this->valid = false;
+		if ((imageWidth <= 0) || (imageHeight <= 0) || (left > right) || (bottom > top))
+			return false;
+		MStatus stat;
+		MFnCamera camFn(camera, &stat);
+		if (!stat)
+			return false;
+
+		// the window of the whole image at the near clipping plane, including the film fit
+		double fullLeft, fullRight, fullBottom, fullTop;
+		stat = camFn.getViewingFrustum((double)imageWidth / (double)imageHeight, fullLeft, fullRight, fullBottom, fullTop);
+		if (!stat)
+			return false;
+		this->orthographic = camFn.isOrtho();
+		if (!this->orthographic)
+		{
+			double nearClip = camFn.nearClippingPlane();
+			if (nearClip <= 0.0)
+				return false;
+			fullLeft /= nearClip;
+			fullRight /= nearClip;
+			fullBottom /= nearClip;
+			fullTop /= nearClip;
+		}
+		this->imageWindowWidth = fullRight - fullLeft;
+		this->imageWindowHeight = fullTop - fullBottom;
+
+		// outer edges of the border pixels
+		this->windowLeft = fullLeft + this->imageWindowWidth * (double)left / (double)imageWidth;
+		this->windowRight = fullLeft + this->imageWindowWidth * (double)(right + 1) / (double)imageWidth;
+		this->windowBottom = fullBottom + this->imageWindowHeight * (double)bottom / (double)imageHeight;
+		this->windowTop = fullBottom + this->imageWindowHeight * (double)(top + 1) / (double)imageHeight;
+
+		this->imageWidth = imageWidth;
+		this->inverseCameraMatrix = camera.inclusiveMatrix().inverse();
+		this->valid = true;
+		this->updatePlanes();
+		return true;
+	}
+
+	void Frustum::expand(float imageFraction)
+	{
+		this->windowLeft -= this->imageWindowWidth * imageFraction;
+		this->windowRight += this->imageWindowWidth * imageFraction;
+		this->windowBottom -= this->imageWindowHeight * imageFraction;
+		this->windowTop += this->imageWindowHeight * imageFraction;
+		if (this->valid)
+			this->updatePlanes();
+	}
+
+	bool Frustum::isValid() const
+	{
+		return this->valid;
+	}
+
+	// the planes are defined in camera space, the camera looks along -z, and then moved into world space.
+	// A point p is inside if normal * p + distance >= 0 for all planes.
+	void Frustum::updatePlanes()
+	{
+		Plane cameraPlanes[5];
+		if (this->orthographic)
+		{
+			cameraPlanes[0].normal = MVector(1.0, 0.0, 0.0);
+			cameraPlanes[0].distance = -this->windowLeft;
+			cameraPlanes[1].normal = MVector(-1.0, 0.0, 0.0);
+			cameraPlanes[1].distance = this->windowRight;
+			cameraPlanes[2].normal = MVector(0.0, 1.0, 0.0);
+			cameraPlanes[2].distance = -this->windowBottom;
+			cameraPlanes[3].normal = MVector(0.0, -1.0, 0.0);
+			cameraPlanes[3].distance = this->windowTop;
+		}
+		else{
+			// x / -z >= windowLeft  ->  x + windowLeft * z >= 0
+			cameraPlanes[0].normal = MVector(1.0, 0.0, this->windowLeft);
+			cameraPlanes[1].normal = MVector(-1.0, 0.0, -this->windowRight);
+			cameraPlanes[2].normal = MVector(0.0, 1.0, this->windowBottom);
+			cameraPlanes[3].normal = MVector(0.0, -1.0, -this->windowTop);
+			for (int i = 0; i < 4; i++)
+				cameraPlanes[i].distance = 0.0;
+		}
+		cameraPlanes[4].normal = MVector(0.0, 0.0, -1.0);
+		cameraPlanes[4].distance = 0.0;
+
+		// maya uses row vectors: pCamera = pWorld * inverse, so the world plane is inverse * (normal, distance)
+		const MMatrix& inverse = this->inverseCameraMatrix;
+		for (int i = 0; i < 5; i++)
+		{
+			const MVector& n = cameraPlanes[i].normal;
+			this->planes[i].normal = MVector(
+				inverse[0][0] * n.x + inverse[0][1] * n.y + inverse[0][2] * n.z,
+				inverse[1][0] * n.x + inverse[1][1] * n.y + inverse[1][2] * n.z,
+				inverse[2][0] * n.x + inverse[2][1] * n.y + inverse[2][2] * n.z);
+			this->planes[i].distance = inverse[3][0] * n.x + inverse[3][1] * n.y + inverse[3][2] * n.z + cameraPlanes[i].distance;
+		}
+	}
+
+	bool Frustum::intersects(const MBoundingBox& worldBox, double worldMargin) const
+	{
+		if (!this->valid)
+			return true;
+		// the plane normals are not normalized, so the box is grown instead of moving the planes
+		MVector margin(worldMargin, worldMargin, worldMargin);
+		MPoint boxMin = worldBox.min() - margin;
+		MPoint boxMax = worldBox.max() + margin;
+		for (int i = 0; i < 5; i++)
+		{
+			// the corner which lies farthest in direction of the normal, if even this one is outside, the whole box is outside
+			const MVector& n = this->planes[i].normal;
+			double x = (n.x >= 0.0) ? boxMax.x : boxMin.x;
+			double y = (n.y >= 0.0) ? boxMax.y : boxMin.y;
+			double z = (n.z >= 0.0) ? boxMax.z : boxMin.z;
+			if ((n.x * x + n.y * y + n.z * z + this->planes[i].distance) < 0.0)
+				return false;
+		}
+		return true;
+	}
+
+	double Frustum::getScreenSize(const MBoundingBox& worldBox) const
+	{
+		if (!this->valid)
+			return std::numeric_limits<double>::max();
+		double radius = (worldBox.max() - worldBox.min()).length() * 0.5;
+		double windowSize = 2.0 * radius;
+		if (!this->orthographic)
+		{
+			// the camera looks along -z
+			double depth = -(worldBox.center() * this->inverseCameraMatrix).z;
+			if (depth <= radius)
+				return std::numeric_limits<double>::max();
+			windowSize /= depth;
+		}
+		return windowSize / this->imageWindowWidth * (double)this->imageWidth;
+	}
+
+	MBoundingBox getWorldBoundingBox(const MDagPath& dagPath)
+	{
+		MFnDagNode dagNode(dagPath);
+		MBoundingBox box = dagNode.boundingBox();
+		box.transformUsing(dagPath.inclusiveMatrix());
+		return box;
+	}
+}
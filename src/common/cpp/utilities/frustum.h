@@ -0,0 +1,59 @@
+#ifndef MT_FRUSTUM_H
+#define MT_FRUSTUM_H
+
+/*
+	Viewing frustum of the render camera in world space, used to skip objects which cannot be seen.
+
+	The frustum can be limited to a pixel rectangle of the image, e.g. the render region, and widened by a part of the
+	image size. Objects are tested with their world space bounding box, a box which is only partly inside counts as inside.
+	A world space margin keeps objects near the frustum, they can still be seen in shadows or reflections.
+	Everything is conservative: if the camera cannot be read, the frustum is not valid and nothing is culled.
+*/
+
+#include <maya/MBoundingBox.h>
+#include <maya/MDagPath.h>
+#include <maya/MMatrix.h>
+#include <maya/MVector.h>
+
+namespace MayaTo{
+
+	class Frustum
+	{
+	public:
+		Frustum();
+		// the whole image of the camera, the image size is needed for the film fit
+		bool create(const MDagPath& camera, int imageWidth, int imageHeight);
+		// only the pixels left..right, bottom..top, render view coordinates with the origin at the bottom left
+		bool create(const MDagPath& camera, int imageWidth, int imageHeight, int left, int bottom, int right, int top);
+		// widens every side by this part of the image width or height, e.g. 0.1 adds 10%
+		void expand(float imageFraction);
+		bool isValid() const;
+		// true if the world space box is at least partly inside the frustum or closer than worldMargin
+		bool intersects(const MBoundingBox& worldBox, double worldMargin = 0.0) const;
+		// approximate size of the box in the image in pixels, measured with its bounding sphere.
+		// A box which contains the camera or lies behind it returns a very large size.
+		double getScreenSize(const MBoundingBox& worldBox) const;
+
+	private:
+		void updatePlanes();
+		struct Plane{
+			MVector normal;
+			double distance;
+		};
+		// left, right, bottom, top, behind the camera
+		Plane planes[5];
+		// window of the frustum in camera space: the slope x/-z and y/-z for a perspective camera, the position for an orthographic one
+		double windowLeft, windowRight, windowBottom, windowTop;
+		// size of the window of the whole image, the expansion is relative to it
+		double imageWindowWidth, imageWindowHeight;
+		int imageWidth;
+		bool orthographic;
+		MMatrix inverseCameraMatrix;
+		bool valid;
+	};
+
+	// bounding box of a dag node in world space
+	MBoundingBox getWorldBoundingBox(const MDagPath& dagPath);
+}
+
+#endif
@@ -4,9 +4,180 @@
 #include <maya/MGlobal.h>
 #include <stdio.h>
 #include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <string>
+#include <chrono>
+
+Logging::LogLevel log_level = Logging::Info;
+Logging::OutputType log_outtype = Logging::ScriptEditor;
+
+namespace{
+
+	// bounded multi producer ring buffer, every slot has a sequence number which tells if it is free or filled
+	// (D. Vyukov's bounded queue). Only the output thread reads from it.
+	const size_t RING_SIZE = 4096;
+	const size_t RING_MASK = RING_SIZE - 1;
+	const int MEMORY_SAMPLE_INTERVAL_MS = 250;
+
+	struct LogSlot{
+		std::atomic<size_t> sequence;
+		size_t memory;
+		std::string message;
+	};
+
+	LogSlot ring[RING_SIZE];
+	std::atomic<size_t> enqueuePos(0);
+	size_t dequeuePos = 0;
+
+	std::atomic<size_t> sampledMemory(0);
+	std::atomic<bool> sinkRunning(false);
+	std::atomic<bool> sinkStopRequested(false);
+	std::atomic<bool> sinkDisabled(false);
+	std::mutex sinkMutex;
+	std::thread sinkThread;
+
+	// the output thread sleeps until a message arrives. A producer only locks the mutex if the thread is sleeping,
+	// the fences make sure that either the producer sees sinkSleeping or the output thread sees the new message.
+	std::atomic<bool> sinkSleeping(false);
+	std::mutex wakeMutex;
+	std::condition_variable wakeCondition;
+
+	// the output thread is stopped by Logging::shutdown() in uninitializePlugin(). Static destructors run
+	// during dll unload under the loader lock, joining there can deadlock, so only detach a thread which was
+	// not shut down to avoid std::terminate in the std::thread destructor.
+	struct SinkOwner{
+		~SinkOwner()
+		{
+			if (sinkThread.joinable())
+				sinkThread.detach();
+		}
+	} sinkOwner;
+
+	void writeMessage(size_t memory, const std::string& message)
+	{
+		COUT("Mem: " << memory << "MB " << message);
+	}
+
+	bool hasNextMessage()
+	{
+		return ring[dequeuePos & RING_MASK].sequence.load(std::memory_order_acquire) == dequeuePos + 1;
+	}
+
+	void wakeSink()
+	{
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (!sinkSleeping.load(std::memory_order_relaxed))
+			return;
+		std::lock_guard<std::mutex> lock(wakeMutex);
+		wakeCondition.notify_one();
+	}
+
+	// returns false if there was nothing to read
+	bool writeNextMessage()
+	{
+		LogSlot& slot = ring[dequeuePos & RING_MASK];
+		size_t seq = slot.sequence.load(std::memory_order_acquire);
+		if (seq != dequeuePos + 1)
+			return false;
+		writeMessage(slot.memory, slot.message);
+		slot.message.clear();
+		slot.sequence.store(dequeuePos + RING_SIZE, std::memory_order_release);
+		dequeuePos++;
+		return true;
+	}
+
+	void sinkLoop()
+	{
+		auto lastSample = std::chrono::steady_clock::now();
+		while (true)
+		{
+			while (writeNextMessage()){}
+
+			auto now = std::chrono::steady_clock::now();
+			if (std::chrono::duration_cast<std::chrono::milliseconds>(now - lastSample).count() >= MEMORY_SAMPLE_INTERVAL_MS)
+			{
+				sampledMemory = getCurrentUsage();
+				lastSample = now;
+			}
+
+			if (sinkStopRequested)
+			{
+				while (writeNextMessage()){}
+				break;
+			}
+
+			// the timeout keeps the memory sample up to date while nothing is logged
+			std::unique_lock<std::mutex> lock(wakeMutex);
+			sinkSleeping = true;
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (!hasNextMessage() && !sinkStopRequested)
+				wakeCondition.wait_for(lock, std::chrono::milliseconds(MEMORY_SAMPLE_INTERVAL_MS));
+			sinkSleeping = false;
+		}
+	}
+
+	void startSink()
+	{
+		std::lock_guard<std::mutex> lock(sinkMutex);
+		if (sinkRunning || sinkDisabled)
+			return;
+		for (size_t i = 0; i < RING_SIZE; i++)
+			ring[i].sequence.store(i + enqueuePos.load(), std::memory_order_relaxed);
+		dequeuePos = enqueuePos.load();
+		sampledMemory = getCurrentUsage();
+		sinkStopRequested = false;
+		sinkThread = std::thread(sinkLoop);
+		sinkRunning = true;
+	}
+
+	void pushMessage(const MString& logString)
+	{
+		if (!sinkRunning)
+		{
+			startSink();
+			if (!sinkRunning)
+			{
+				// output thread is shut down, write directly
+				writeMessage(getCurrentUsage(), logString.asChar());
+				return;
+			}
+		}
+
+		size_t pos = enqueuePos.load(std::memory_order_relaxed);
+		LogSlot *slot;
+		while (true)
+		{
+			slot = &ring[pos & RING_MASK];
+			size_t seq = slot->sequence.load(std::memory_order_acquire);
+			ptrdiff_t diff = (ptrdiff_t)seq - (ptrdiff_t)pos;
+			if (diff == 0)
+			{
+				if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0)
+			{
+				// buffer is full, give the output thread some time
+				std::this_thread::yield();
+				pos = enqueuePos.load(std::memory_order_relaxed);
+			}
+			else{
+				pos = enqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+		slot->memory = sampledMemory.load(std::memory_order_relaxed);
+		slot->message = logString.asChar();
+		slot->sequence.store(pos + 1, std::memory_order_release);
+		wakeSink();
+	}
+}
 
 void Logging::setLogLevel( Logging::LogLevel level)
 {
+	if (level == log_level)
+		return;
 	if (level == Logging::Debug)
 	{
 		MGlobal::displayInfo("Set logging level to DEBUG");
@@ -32,70 +203,80 @@ void Logging::setLogLevel( Logging::LogLevel level)
 
 void Logging::info(MString logString)
 {
-	if (log_level == 5)
-		return;
-	MString outString = MString("Mem: ") + getCurrentUsage() + "MB " +  logString;
-	if (log_level >= Logging::Info)
-		COUT(outString);
+	if (isEnabled(Logging::Info))
+		pushMessage(logString);
 }
 
 void Logging::warning(MString logString)
 {
-	if (log_level == 5)
-		return;
-	MString outString = MString("Mem: ") + getCurrentUsage() + "MB " +  logString;
-	if (log_level >= Logging::Warning)
-		COUT(outString);
+	if (isEnabled(Logging::Warning))
+		pushMessage(logString);
 }
 
 void Logging::error(MString logString)
 {
-	if (log_level == 5)
-		return;
-	MString outString = MString("Mem: ") + getCurrentUsage() + "MB " +  logString;
-	if (log_level >= Logging::Error)
+	if (isEnabled(Logging::Error))
 	{
-		COUT(outString);
+		pushMessage(logString);
+		// errors often come right before a crash, so make sure they are visible
+		flush();
 	}
 }
 
 void Logging::debug(MString logString)
 {
-	if (log_level == 5)
-		return;
-	MString outString = MString("Mem: ") + getCurrentUsage() + "MB " +  logString;
-	if (log_level >= Logging::Debug)
-	{
-		COUT(outString);
-	}
+	if (isEnabled(Logging::Debug))
+		pushMessage(logString);
 }
 
 void Logging::debugs(MString logString, int level)
 {
-	if (log_level == 5)
-		return;
-	MString outString = MString("Mem: ") + getCurrentUsage() + "MB " + makeSpace(level) + logString;
-	if (log_level >= Logging::Debug)
-	{
-		COUT(outString);
-	}
+	if (isEnabled(Logging::Debug))
+		pushMessage(makeSpace(level) + logString);
 }
 
 void Logging::progress(MString logString)
 {
-	if (log_level == 5)
+	if (isEnabled(Logging::Progress))
+		pushMessage(logString);
+}
+
+void Logging::detail(MString logString)
+{
+	pushMessage(logString);
+}
+
+void Logging::flush()
+{
+	if (!sinkRunning || (std::this_thread::get_id() == sinkThread.get_id()))
 		return;
-	MString outString = MString("Mem: ") + getCurrentUsage() + "MB " +  logString;
-	if (log_level >= Logging::Progress)
+	size_t target = enqueuePos.load();
+	if (target == 0)
+		return;
+	// the output thread has written everything up to target if the slot before target was released
+	const LogSlot& slot = ring[(target - 1) & RING_MASK];
+	while (sinkRunning)
 	{
-		COUT(outString);
+		if (slot.sequence.load(std::memory_order_acquire) >= target - 1 + RING_SIZE)
+			break;
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
 	}
 }
 
-void Logging::detail(MString logString)
+void Logging::shutdown()
 {
-	MString outString = MString("Mem: ") + getCurrentUsage() + "MB " +  logString;
-	COUT(outString);
+	std::lock_guard<std::mutex> lock(sinkMutex);
+	sinkDisabled = true;
+	if (!sinkRunning)
+		return;
+	sinkStopRequested = true;
+	{
+		std::lock_guard<std::mutex> wakeLock(wakeMutex);
+		wakeCondition.notify_one();
+	}
+	if (sinkThread.joinable())
+		sinkThread.join();
+	sinkRunning = false;
 }
 
 MString makeSpace(int level)
@@ -8,6 +8,22 @@
 
 #define COUT(msg) MStreamUtils::stdOutStream() << msg << "\n"
 
+// The message expression is only evaluated if the level is active, so use these macros
+// in loops over objects, tiles or pixels where building the MString would cost too much.
+#define LOG_DEBUG(msg) do { if (Logging::isEnabled(Logging::Debug)) Logging::debug(msg); } while (0)
+#define LOG_DEBUGS(msg, level) do { if (Logging::isEnabled(Logging::Debug)) Logging::debugs(msg, level); } while (0)
+#define LOG_PROGRESS(msg) do { if (Logging::isEnabled(Logging::Progress)) Logging::progress(msg); } while (0)
+
+// Trace messages are removed completely at compile time unless MAYATO_LOG_TRACE is defined.
+#ifdef MAYATO_LOG_TRACE
+#define LOG_TRACE(msg) LOG_DEBUG(msg)
+#else
+#define LOG_TRACE(msg) do {} while (0)
+#endif
+
+// All messages are placed in a lock free ring buffer and written by a background thread,
+// so logging from render threads does not block them. The memory usage in front of every
+// message is sampled by the background thread in a fixed interval.
 class Logging
 {
 public:
@@ -25,6 +41,7 @@ public:
 	};
 
 	static void setLogLevel( Logging::LogLevel level);
+	static bool isEnabled(Logging::LogLevel level);
 	static void info(MString logString);
 	static void warning(MString logString);
 	static void error(MString logString);
@@ -32,10 +49,19 @@ public:
 	static void debugs(MString logString, int level);
 	static void progress(MString logString);
 	static void detail(MString logString);
+	// wait until all pending messages are written
+	static void flush();
+	// write all pending messages and stop the output thread, e.g. before the plugin is unloaded
+	static void shutdown();
 };
 
 MString makeSpace(int level);
-static  Logging::LogLevel log_level = Logging::Info;
-static  Logging::OutputType log_outtype = Logging::ScriptEditor;
+extern Logging::LogLevel log_level;
+extern Logging::OutputType log_outtype;
+
+inline bool Logging::isEnabled(Logging::LogLevel level)
+{
+	return (log_level != Logging::None) && (log_level >= level);
+}
 
 #endif
@@ -2,7 +2,6 @@
 
 #include <maya/MFnDependencyNode.h>
 #include <maya/MFnMesh.h>
-#include <maya/MItMeshPolygon.h>
 #include <maya/MPointArray.h>
 #include <maya/MFloatPointArray.h>
 #include <maya/MFloatArray.h>
@@ -12,181 +11,182 @@
 #include "utilities/tools.h"
 #include "utilities/attrTools.h"
 #include "utilities/logging.h"
+#include "utilities/smoothMeshCache.h"
 
 void getMeshData(MObject& meshObject, MPointArray& points, MFloatVectorArray& normals)
 {
 	MStatus stat;
-	MMeshSmoothOptions options;
-	MFnMesh tmpMesh(meshObject);
-	MFnMeshData meshData;
-	MObject dataObject;
-	MObject smoothedObj;
-	
+
 	// create smooth mesh if needed
-	if (tmpMesh.findPlug("displaySmoothMesh").asBool())
-	{
-		stat = tmpMesh.getSmoothMeshDisplayOptions(options);
-		if (stat)
-		{
-			if (!tmpMesh.findPlug("useSmoothPreviewForRender", false, &stat).asBool())
-			{
-				//Logging::debug(MString("useSmoothPreviewForRender turned off"));
-				int smoothLevel = tmpMesh.findPlug("renderSmoothLevel", false, &stat).asInt();
-				options.setDivisions(smoothLevel);
-			}
-			if (options.divisions() > 0)
-			{
-				dataObject = meshData.create();
-				smoothedObj = tmpMesh.generateSmoothMesh(dataObject, &options, &stat);
-				if (stat)
-				{
-					meshObject = smoothedObj;
-				}
-			}
-		}
-	}
+	MayaTo::getSmoothMeshCache().getRenderMesh(meshObject);
 
 	MFnMesh meshFn(meshObject, &stat);
+	if (!stat)
+	{
+		Logging::error(stat.errorString());
+		return;
+	}
 	meshFn.getPoints(points);
 	meshFn.getNormals(normals, MSpace::kObject);
 }
 
 
+// the array version is kept for the renderers which work with maya arrays, the data comes from the same
+// extraction as the parallel translation, so both paths export identical meshes
 void getMeshData(MObject& meshObject, MPointArray& points, MFloatVectorArray& normals, MFloatArray& uArray, 
 	MFloatArray& vArray, MIntArray& triPointIndices, MIntArray& triNormalIndices, 
 	MIntArray& triUvIndices, MIntArray& triMatIndices, MIntArray& perFaceAssignments)
 {
+	MeshExtract extract;
+	if (!extractMeshBuffers(meshObject, perFaceAssignments, extract))
+	{
+		Logging::error(MString("Unable to read mesh data from ") + getObjectName(meshObject));
+		return;
+	}
+	triangulateMeshExtract(extract);
+
+	size_t numPoints = extract.points.size() / 3;
+	points.setLength((uint)numPoints);
+	for (size_t i = 0; i < numPoints; i++)
+		points[(uint)i] = MPoint(extract.points[i * 3], extract.points[i * 3 + 1], extract.points[i * 3 + 2]);
+	size_t numNormals = extract.normals.size() / 3;
+	normals.setLength((uint)numNormals);
+	for (size_t i = 0; i < numNormals; i++)
+		normals[(uint)i] = MFloatVector(extract.normals[i * 3], extract.normals[i * 3 + 1], extract.normals[i * 3 + 2]);
+	uArray = MFloatArray(extract.u.data(), (uint)extract.u.size());
+	vArray = MFloatArray(extract.v.data(), (uint)extract.v.size());
+	triPointIndices = MIntArray(extract.triPointIds.data(), (uint)extract.triPointIds.size());
+	triNormalIndices = MIntArray(extract.triNormalIds.data(), (uint)extract.triNormalIds.size());
+	triUvIndices = MIntArray(extract.triUvIds.data(), (uint)extract.triUvIds.size());
+	triMatIndices = MIntArray(extract.triMatIds.data(), (uint)extract.triMatIds.size());
+}
 
+bool extractMeshBuffers(MObject meshObject, const MIntArray& perFaceAssignments, MeshExtract& extract)
+{
 	MStatus stat;
-	MMeshSmoothOptions options;
 	MFnMesh tmpMesh(meshObject, &stat);
-	MFnMeshData meshData;
-	MObject dataObject;
-	MObject smoothedObj;
-	MString meshName = tmpMesh.name();
+	if (!stat)
+		return false;
+	extract.name = tmpMesh.fullPathName().asChar();
 
 	// create smooth mesh if needed
-	if (tmpMesh.findPlug("displaySmoothMesh").asBool())
-	{
-		stat = tmpMesh.getSmoothMeshDisplayOptions(options);
-		if (stat)
-		{
-			if (!tmpMesh.findPlug("useSmoothPreviewForRender", false, &stat).asBool())
-			{
-				//Logging::debug(MString("useSmoothPreviewForRender turned off"));
-				int smoothLevel = tmpMesh.findPlug("renderSmoothLevel", false, &stat).asInt();
-				options.setDivisions(smoothLevel);
-			}
-			if (options.divisions() > 0)
-			{
-				dataObject = meshData.create();
-				smoothedObj = tmpMesh.generateSmoothMesh(dataObject, &options, &stat);
-				if (stat)
-				{
-					meshObject = smoothedObj;
-				}
-			}
-		}
-	}
+	MayaTo::getSmoothMeshCache().getRenderMesh(meshObject);
 
 	MFnMesh meshFn(meshObject, &stat);
-	CHECK_MSTATUS(stat);
-	MItMeshPolygon faceIt(meshObject, &stat);
-	CHECK_MSTATUS(stat);
+	if (!stat)
+		return false;
+
+	MFloatPointArray points;
+	MFloatVectorArray normals;
+	MFloatArray uArray, vArray;
+	MIntArray vertexCounts, vertexIds, normalCounts, normalIds, uvCounts, uvIds, triangleCounts, triangleVertices;
 
 	meshFn.getPoints(points);
 	meshFn.getNormals(normals, MSpace::kObject);
 	meshFn.getUVs(uArray, vArray);
+	meshFn.getVertices(vertexCounts, vertexIds);
+	meshFn.getNormalIds(normalCounts, normalIds);
+	meshFn.getAssignedUVs(uvCounts, uvIds);
+	meshFn.getTriangles(triangleCounts, triangleVertices);
 
-	uint numVertices = points.length();
-	uint numNormals = normals.length();
-	uint numUvs = uArray.length();
+	extract.points.resize(points.length() * 3);
+	for (uint i = 0; i < points.length(); i++)
+	{
+		extract.points[i * 3] = points[i].x;
+		extract.points[i * 3 + 1] = points[i].y;
+		extract.points[i * 3 + 2] = points[i].z;
+	}
+	extract.normals.resize(normals.length() * 3);
+	normals.get((float (*)[3])extract.normals.data());
+	for (uint nid = 0; nid < normals.length(); nid++)
+	{
+		if (normals[nid].length() < 0.1f)
+			Logging::warning(MString("Malformed normal in ") + tmpMesh.name());
+	}
 
 	// some meshes may have no uv's
 	// to avoid problems I add a default uv coordinate
-	if (numUvs == 0)
+	if (uArray.length() == 0)
 	{
+		Logging::warning(MString("Object has no uv's: ") + tmpMesh.name());
 		uArray.append(0.0);
 		vArray.append(0.0);
 	}
-	for (uint nid = 0; nid < numNormals; nid++)
+	extract.u.resize(uArray.length());
+	extract.v.resize(vArray.length());
+	uArray.get(extract.u.data());
+	vArray.get(extract.v.data());
+
+	uint numFaces = vertexCounts.length();
+	extract.faceVertexCounts.resize(numFaces);
+	vertexCounts.get(extract.faceVertexCounts.data());
+	extract.faceVertexIds.resize(vertexIds.length());
+	vertexIds.get(extract.faceVertexIds.data());
+	extract.faceNormalIds.resize(normalIds.length());
+	normalIds.get(extract.faceNormalIds.data());
+	extract.triangleCounts.resize(triangleCounts.length());
+	triangleCounts.get(extract.triangleCounts.data());
+	extract.triangleVertexIds.resize(triangleVertices.length());
+	triangleVertices.get(extract.triangleVertexIds.data());
+
+	// faces without uv's get the uv index 0
+	extract.faceUvIds.assign(vertexIds.length(), 0);
+	uint fvOffset = 0, uvOffset = 0;
+	for (uint faceId = 0; faceId < numFaces; faceId++)
 	{
-		if (normals[nid].length() < 0.1f)
-			Logging::warning(MString("Malformed normal in ") + meshName);
+		if (uvCounts[faceId] == vertexCounts[faceId])
+		{
+			for (int fv = 0; fv < vertexCounts[faceId]; fv++)
+				extract.faceUvIds[fvOffset + fv] = uvIds[uvOffset + fv];
+		}
+		fvOffset += vertexCounts[faceId];
+		uvOffset += uvCounts[faceId];
 	}
-	MPointArray triPoints;
-	MIntArray triVtxIds;
-	MIntArray faceVtxIds;
-	MIntArray faceNormalIds;
-
-	for (faceIt.reset(); !faceIt.isDone(); faceIt.next())
-	{
-		int faceId = faceIt.index();
-		int numTris;
-		faceIt.numTriangles(numTris);
-		faceIt.getVertices(faceVtxIds);
 
-		int perFaceShadingGroup = 0;
-		if (perFaceAssignments.length() > 0)
-			perFaceShadingGroup = perFaceAssignments[faceId];
+	extract.faceMaterialIds.assign(numFaces, 0);
+	if (perFaceAssignments.length() >= numFaces)
+		for (uint faceId = 0; faceId < numFaces; faceId++)
+			extract.faceMaterialIds[faceId] = perFaceAssignments[faceId];
 
-		MIntArray faceUVIndices;
-
-		faceNormalIds.clear();
-		for (uint vtxId = 0; vtxId < faceVtxIds.length(); vtxId++)
-		{
-			faceNormalIds.append(faceIt.normalIndex(vtxId));
-			int uvIndex;
-			if (numUvs == 0)
-			{
-				faceUVIndices.append(0);
-			}
-			else{
-				faceIt.getUVIndex(vtxId, uvIndex);
-				faceUVIndices.append(uvIndex);
-			}
-		}
+	extract.valid = true;
+	return true;
+}
 
-		for (int triId = 0; triId < numTris; triId++)
+void triangulateMeshExtract(MeshExtract& extract)
+{
+	size_t numTris = extract.triangleVertexIds.size() / 3;
+	extract.triPointIds.resize(numTris * 3);
+	extract.triNormalIds.resize(numTris * 3);
+	extract.triUvIds.resize(numTris * 3);
+	extract.triMatIds.resize(numTris);
+
+	size_t triIndex = 0;
+	size_t fvOffset = 0;
+	for (size_t faceId = 0; faceId < extract.faceVertexCounts.size(); faceId++)
+	{
+		int numFaceVertices = extract.faceVertexCounts[faceId];
+		for (int triId = 0; triId < extract.triangleCounts[faceId]; triId++)
 		{
-			int faceRelIds[3];
-			faceIt.getTriangle(triId, triPoints, triVtxIds);
-
-			for (uint triVtxId = 0; triVtxId < 3; triVtxId++)
+			for (int triVtxId = 0; triVtxId < 3; triVtxId++)
 			{
-				for (uint faceVtxId = 0; faceVtxId < faceVtxIds.length(); faceVtxId++)
+				int vtxId = extract.triangleVertexIds[triIndex * 3 + triVtxId];
+				// triangle vertices are object relative, so search the face relative id for normals and uvs
+				size_t faceRelId = fvOffset;
+				for (int fv = 0; fv < numFaceVertices; fv++)
 				{
-					if (faceVtxIds[faceVtxId] == triVtxIds[triVtxId])
+					if (extract.faceVertexIds[fvOffset + fv] == vtxId)
 					{
-						faceRelIds[triVtxId] = faceVtxId;
+						faceRelId = fvOffset + fv;
+						break;
 					}
 				}
+				extract.triPointIds[triIndex * 3 + triVtxId] = vtxId;
+				extract.triNormalIds[triIndex * 3 + triVtxId] = extract.faceNormalIds[faceRelId];
+				extract.triUvIds[triIndex * 3 + triVtxId] = extract.faceUvIds[faceRelId];
 			}
-
-			uint vtxId0 = faceVtxIds[faceRelIds[0]];
-			uint vtxId1 = faceVtxIds[faceRelIds[1]];
-			uint vtxId2 = faceVtxIds[faceRelIds[2]];
-			uint normalId0 = faceNormalIds[faceRelIds[0]];
-			uint normalId1 = faceNormalIds[faceRelIds[1]];
-			uint normalId2 = faceNormalIds[faceRelIds[2]];
-			uint uvId0 = faceUVIndices[faceRelIds[0]];
-			uint uvId1 = faceUVIndices[faceRelIds[1]];
-			uint uvId2 = faceUVIndices[faceRelIds[2]];
-
-			triPointIndices.append(vtxId0);
-			triPointIndices.append(vtxId1);
-			triPointIndices.append(vtxId2);
-
-			triNormalIndices.append(normalId0);
-			triNormalIndices.append(normalId1);
-			triNormalIndices.append(normalId2);
-
-			triUvIndices.append(uvId0);
-			triUvIndices.append(uvId1);
-			triUvIndices.append(uvId2);
-
-			triMatIndices.append(perFaceShadingGroup);
+			extract.triMatIds[triIndex] = extract.faceMaterialIds[faceId];
+			triIndex++;
 		}
+		fvOffset += numFaceVertices;
 	}
-
 }
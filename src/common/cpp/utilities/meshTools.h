@@ -6,11 +6,37 @@
 #include <maya/MFloatVectorArray.h>
 #include <maya/MObject.h>
 #include <maya/MIntArray.h>
+#include <vector>
+#include <string>
 
 void getMeshData(MObject& meshObject, MPointArray& points, MFloatVectorArray& normals);
 void getMeshData(MObject& meshObject, MPointArray& points, MFloatVectorArray& normals, MFloatArray& uArray,
 	MFloatArray& vArray, MIntArray& triPointIndices, MIntArray& triNormalIndices,
 	MIntArray& triUvIndices, MIntArray& triMatIndices, MIntArray& perFaceAssignments);
 
+// Plain buffer copy of a mesh. It is filled on the main thread with extractMeshBuffers() with the
+// bulk MFnMesh methods, everything afterwards, like triangulation or the creation of the renderer mesh,
+// does not need the Maya API any more and can be done in parallel.
+struct MeshExtract{
+	std::string name;
+	std::vector<float> points; // xyz
+	std::vector<float> normals; // xyz
+	std::vector<float> u, v;
+	std::vector<int> faceVertexCounts;
+	std::vector<int> faceVertexIds; // object relative vertex ids per face vertex
+	std::vector<int> faceNormalIds; // normal ids per face vertex
+	std::vector<int> faceUvIds; // uv ids per face vertex
+	std::vector<int> faceMaterialIds;
+	std::vector<int> triangleCounts; // triangles per face
+	std::vector<int> triangleVertexIds; // object relative vertex ids, 3 per triangle
+
+	// filled by triangulateMeshExtract()
+	std::vector<int> triPointIds, triNormalIds, triUvIds, triMatIds;
+	bool valid = false;
+};
+
+bool extractMeshBuffers(MObject meshObject, const MIntArray& perFaceAssignments, MeshExtract& extract);
+// thread safe, does not use any Maya API calls
+void triangulateMeshExtract(MeshExtract& extract);
 
 #endif
\ No newline at end of file
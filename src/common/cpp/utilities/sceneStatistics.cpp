@@ -0,0 +1,245 @@
+#include "sceneStatistics.h"
+#include <algorithm>
+#include <fstream>
+#include <vector>
+#include "logging.h"
+#include "tools.h"
+
+namespace MayaTo{
+
+	static SceneStatistics sceneStatistics;
+
+	SceneStatistics& getSceneStatistics()
+	{
+		return sceneStatistics;
+	}
+
+	// names can contain commas, so every name is quoted
+	static std::string escapeCsv(const std::string& text)
+	{
+		std::string escaped = "\"";
+		for (char c : text)
+		{
+			if (c == '"')
+				escaped += '"';
+			escaped += c;
+		}
+		return escaped + "\"";
+	}
+
+	template<class T> static std::vector<std::pair<std::string, T>> sortedEntries(const std::unordered_map<std::string, T>& entries, bool(*greater)(const T&, const T&))
+	{
+		std::vector<std::pair<std::string, T>> sorted(entries.begin(), entries.end());
+		std::sort(sorted.begin(), sorted.end(), [greater](const std::pair<std::string, T>& a, const std::pair<std::string, T>& b)
+		{
+			return greater(a.second, b.second);
+		});
+		return sorted;
+	}
+
+	static bool slowerObject(const ObjectStatistics& a, const ObjectStatistics& b)
+	{
+		return (a.extractionSeconds + a.exportSeconds) > (b.extractionSeconds + b.exportSeconds);
+	}
+
+	static bool slowerMaterial(const MaterialStatistics& a, const MaterialStatistics& b)
+	{
+		return a.seconds > b.seconds;
+	}
+
+	static bool biggerTexture(const TextureStatistics& a, const TextureStatistics& b)
+	{
+		return a.bytes > b.bytes;
+	}
+
+	SceneStatistics::SceneStatistics() : enabled(false)
+	{}
+
+	void SceneStatistics::setEnabled(bool enable)
+	{
+		this->enabled = enable;
+	}
+
+	bool SceneStatistics::isEnabled() const
+	{
+		return this->enabled;
+	}
+
+	void SceneStatistics::clear()
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->objects.clear();
+		this->materials.clear();
+		this->textures.clear();
+	}
+
+	ObjectStatistics& SceneStatistics::getObject(const MString& objectPath)
+	{
+		std::string path = objectPath.asChar();
+		ObjectStatistics& object = this->objects[path];
+		if (object.name.empty())
+		{
+			size_t separator = path.rfind('|');
+			object.name = (separator == std::string::npos) ? path : path.substr(separator + 1);
+		}
+		return object;
+	}
+
+	void SceneStatistics::addMeshExport(const MString& objectPath, long long vertices, long long triangles, long long bytes, double seconds)
+	{
+		if (!this->enabled)
+			return;
+		std::lock_guard<std::mutex> lock(this->mutex);
+		ObjectStatistics& object = this->getObject(objectPath);
+		object.vertices += vertices;
+		object.triangles += triangles;
+		object.bytes += bytes;
+		object.exportSeconds += seconds;
+	}
+
+	void SceneStatistics::addExtractionTime(const MString& objectPath, double seconds)
+	{
+		if (!this->enabled)
+			return;
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->getObject(objectPath).extractionSeconds += seconds;
+	}
+
+	void SceneStatistics::addDeformSample(const MString& objectPath, double seconds)
+	{
+		if (!this->enabled)
+			return;
+		std::lock_guard<std::mutex> lock(this->mutex);
+		ObjectStatistics& object = this->getObject(objectPath);
+		object.deformSamples++;
+		object.extractionSeconds += seconds;
+	}
+
+	void SceneStatistics::setTransformSamples(const MString& objectPath, int samples)
+	{
+		if (!this->enabled)
+			return;
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->getObject(objectPath).transformSamples = samples;
+	}
+
+	void SceneStatistics::addInstance(const MString& objectPath)
+	{
+		if (!this->enabled)
+			return;
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->getObject(objectPath).instances++;
+	}
+
+	void SceneStatistics::addMaterial(const MString& materialName, double seconds)
+	{
+		if (!this->enabled)
+			return;
+		std::lock_guard<std::mutex> lock(this->mutex);
+		MaterialStatistics& material = this->materials[materialName.asChar()];
+		material.seconds += seconds;
+		material.uses++;
+	}
+
+	void SceneStatistics::setTexture(const MString& fileName, long long bytes, int width, int height)
+	{
+		if (!this->enabled)
+			return;
+		std::lock_guard<std::mutex> lock(this->mutex);
+		TextureStatistics& texture = this->textures[fileName.asChar()];
+		texture.bytes = bytes;
+		texture.width = width;
+		texture.height = height;
+	}
+
+	bool SceneStatistics::writeReport(const MString& fileName, const MString& sceneName, float frame)
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		std::vector<std::pair<std::string, ObjectStatistics>> sortedObjects = sortedEntries(this->objects, slowerObject);
+		std::vector<std::pair<std::string, MaterialStatistics>> sortedMaterials = sortedEntries(this->materials, slowerMaterial);
+		std::vector<std::pair<std::string, TextureStatistics>> sortedTextures = sortedEntries(this->textures, biggerTexture);
+
+		ObjectStatistics totalObjects;
+		for (auto& it : sortedObjects)
+		{
+			totalObjects.vertices += it.second.vertices;
+			totalObjects.triangles += it.second.triangles;
+			totalObjects.bytes += it.second.bytes;
+			totalObjects.extractionSeconds += it.second.extractionSeconds;
+			totalObjects.exportSeconds += it.second.exportSeconds;
+		}
+		double materialSeconds = 0.0;
+		for (auto& it : sortedMaterials)
+			materialSeconds += it.second.seconds;
+		long long textureBytes = 0;
+		for (auto& it : sortedTextures)
+			textureBytes += it.second.bytes;
+
+		std::ofstream jsonFile((fileName + ".json").asChar());
+		if (!jsonFile.good())
+		{
+			Logging::error(MString("Unable to write scene statistics ") + fileName + ".json");
+			return false;
+		}
+		jsonFile << "{\n";
+		jsonFile << "  \"scene\": \"" << escapeJson(sceneName.asChar()) << "\",\n";
+		jsonFile << "  \"renderer\": \"" << escapeJson(getRendererName().asChar()) << "\",\n";
+		jsonFile << "  \"frame\": " << frame << ",\n";
+		jsonFile << "  \"totals\": {\"objects\": " << sortedObjects.size() << ", \"vertices\": " << totalObjects.vertices << ", \"triangles\": " << totalObjects.triangles;
+		jsonFile << ", \"bytes\": " << totalObjects.bytes << ", \"extractionSeconds\": " << totalObjects.extractionSeconds << ", \"exportSeconds\": " << totalObjects.exportSeconds;
+		jsonFile << ", \"materials\": " << sortedMaterials.size() << ", \"materialSeconds\": " << materialSeconds;
+		jsonFile << ", \"textures\": " << sortedTextures.size() << ", \"textureBytes\": " << textureBytes << "},\n";
+		jsonFile << "  \"objects\": [\n";
+		for (size_t i = 0; i < sortedObjects.size(); i++)
+		{
+			const ObjectStatistics& object = sortedObjects[i].second;
+			jsonFile << "    {\"name\": \"" << escapeJson(object.name) << "\", \"path\": \"" << escapeJson(sortedObjects[i].first) << "\", \"seconds\": " << (object.extractionSeconds + object.exportSeconds);
+			jsonFile << ", \"extractionSeconds\": " << object.extractionSeconds << ", \"exportSeconds\": " << object.exportSeconds;
+			jsonFile << ", \"vertices\": " << object.vertices << ", \"triangles\": " << object.triangles << ", \"bytes\": " << object.bytes;
+			jsonFile << ", \"transformSamples\": " << object.transformSamples << ", \"deformSamples\": " << object.deformSamples << ", \"instances\": " << object.instances << "}";
+			jsonFile << ((i + 1 < sortedObjects.size()) ? ",\n" : "\n");
+		}
+		jsonFile << "  ],\n";
+		jsonFile << "  \"materials\": [\n";
+		for (size_t i = 0; i < sortedMaterials.size(); i++)
+		{
+			jsonFile << "    {\"name\": \"" << escapeJson(sortedMaterials[i].first) << "\", \"seconds\": " << sortedMaterials[i].second.seconds << ", \"uses\": " << sortedMaterials[i].second.uses << "}";
+			jsonFile << ((i + 1 < sortedMaterials.size()) ? ",\n" : "\n");
+		}
+		jsonFile << "  ],\n";
+		jsonFile << "  \"textures\": [\n";
+		for (size_t i = 0; i < sortedTextures.size(); i++)
+		{
+			const TextureStatistics& texture = sortedTextures[i].second;
+			jsonFile << "    {\"file\": \"" << escapeJson(sortedTextures[i].first) << "\", \"bytes\": " << texture.bytes << ", \"width\": " << texture.width << ", \"height\": " << texture.height << "}";
+			jsonFile << ((i + 1 < sortedTextures.size()) ? ",\n" : "\n");
+		}
+		jsonFile << "  ]\n";
+		jsonFile << "}\n";
+		jsonFile.close();
+
+		// one table for all elements, so it can be sorted and filtered in a spreadsheet
+		std::ofstream csvFile((fileName + ".csv").asChar());
+		if (!csvFile.good())
+		{
+			Logging::error(MString("Unable to write scene statistics ") + fileName + ".csv");
+			return false;
+		}
+		csvFile << "type,name,path,seconds,extractionSeconds,exportSeconds,vertices,triangles,bytes,transformSamples,deformSamples,instances,uses,width,height\n";
+		for (auto& it : sortedObjects)
+		{
+			const ObjectStatistics& object = it.second;
+			csvFile << "object," << escapeCsv(object.name) << "," << escapeCsv(it.first) << "," << (object.extractionSeconds + object.exportSeconds) << "," << object.extractionSeconds << "," << object.exportSeconds;
+			csvFile << "," << object.vertices << "," << object.triangles << "," << object.bytes;
+			csvFile << "," << object.transformSamples << "," << object.deformSamples << "," << object.instances << ",,,\n";
+		}
+		for (auto& it : sortedMaterials)
+			csvFile << "material," << escapeCsv(it.first) << ",," << it.second.seconds << ",,,,,,,,," << it.second.uses << ",,\n";
+		for (auto& it : sortedTextures)
+			csvFile << "texture," << escapeCsv(it.first) << ",,,,,,," << it.second.bytes << ",,,,," << it.second.width << "," << it.second.height << "\n";
+		csvFile.close();
+
+		Logging::info(MString("Scene statistics saved in ") + fileName + ".json/.csv: " + (int)sortedObjects.size() + " objects, " + (int)sortedMaterials.size() + " materials, " + (int)sortedTextures.size() + " textures");
+		return true;
+	}
+}
@@ -0,0 +1,118 @@
+#ifndef MT_SCENE_STATISTICS_H
+#define MT_SCENE_STATISTICS_H
+
+/*
+	Export costs of the scene elements for one frame.
+
+	The translators report per object the time needed to read the mesh from Maya (extraction), the time to create
+	the renderer geometry (export), the number of vertices and triangles and the bytes given to the renderer.
+	MayaScene adds the motion samples, the instances and the file textures. Materials are reported per shading group
+	with their translation time.
+
+	At the end of a frame everything is written as <scene>_<frame>.json and .csv, the objects and materials sorted
+	by their time, the textures by their size. If a frame suddenly needs much more time, the report of the slow frame
+	can be compared with the report of an older one.
+
+	Objects are identified by their full dag path, so equal short names in different groups are not mixed up,
+	the short name is only written as display name.
+
+	Switched on with the sceneStatistics attribute of the render globals, all add methods are thread safe.
+*/
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <maya/MString.h>
+
+namespace MayaTo{
+
+	struct ObjectStatistics{
+		// short name for display, the map key is the full dag path
+		std::string name;
+		long long vertices = 0;
+		long long triangles = 0;
+		long long bytes = 0;
+		int transformSamples = 0;
+		int deformSamples = 0;
+		int instances = 0;
+		double extractionSeconds = 0.0;
+		double exportSeconds = 0.0;
+	};
+
+	struct MaterialStatistics{
+		double seconds = 0.0;
+		// number of objects which use the material
+		int uses = 0;
+	};
+
+	struct TextureStatistics{
+		long long bytes = 0;
+		int width = 0;
+		int height = 0;
+	};
+
+	class SceneStatistics
+	{
+	public:
+		SceneStatistics();
+		void setEnabled(bool enabled);
+		bool isEnabled() const;
+		void clear();
+
+		// the values of the same object are added, e.g. several motion steps of one mesh
+		void addMeshExport(const MString& objectPath, long long vertices, long long triangles, long long bytes, double seconds);
+		void addExtractionTime(const MString& objectPath, double seconds);
+		// a mesh motion step read from maya, the time is added to the extraction time
+		void addDeformSample(const MString& objectPath, double seconds);
+		void setTransformSamples(const MString& objectPath, int samples);
+		void addInstance(const MString& objectPath);
+		void addMaterial(const MString& materialName, double seconds);
+		void setTexture(const MString& fileName, long long bytes, int width, int height);
+
+		// writes fileName + ".json" and fileName + ".csv"
+		bool writeReport(const MString& fileName, const MString& sceneName, float frame);
+
+	private:
+		ObjectStatistics& getObject(const MString& objectPath);
+		std::atomic<bool> enabled;
+		std::mutex mutex;
+		std::unordered_map<std::string, ObjectStatistics> objects;
+		std::unordered_map<std::string, MaterialStatistics> materials;
+		std::unordered_map<std::string, TextureStatistics> textures;
+	};
+
+	SceneStatistics& getSceneStatistics();
+
+	// measures the time of a scope, used by the translators for the statistics
+	class StatisticsTimer
+	{
+	public:
+		StatisticsTimer() : start(std::chrono::steady_clock::now()){}
+		double getSeconds() const
+		{
+			return std::chrono::duration<double>(std::chrono::steady_clock::now() - this->start).count();
+		}
+	private:
+		std::chrono::steady_clock::time_point start;
+	};
+
+	// adds the time between construction and destruction to a material, so early returns and continues are measured too
+	class MaterialStatisticsScope
+	{
+	public:
+		explicit MaterialStatisticsScope(const MString& materialName) : name(materialName){}
+		~MaterialStatisticsScope()
+		{
+			getSceneStatistics().addMaterial(this->name, this->timer.getSeconds());
+		}
+	private:
+		MaterialStatisticsScope(const MaterialStatisticsScope&);
+		MaterialStatisticsScope& operator=(const MaterialStatisticsScope&);
+		MString name;
+		StatisticsTimer timer;
+	};
+}
+
+#endif
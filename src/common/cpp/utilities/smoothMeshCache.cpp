@@ -0,0 +1,454 @@
+#include "smoothMeshCache.h"
+
+#include <cmath>
+#include <maya/MFnMesh.h>
+#include <maya/MFnMeshData.h>
+#include <maya/MPlug.h>
+#include <maya/MIntArray.h>
+#include <maya/MUintArray.h>
+#include <maya/MDoubleArray.h>
+#include <maya/MFloatArray.h>
+#include <maya/MBoundingBox.h>
+#include <maya/MObjectHandle.h>
+
+#include "utilities/logging.h"
+
+static Logging logger;
+
+namespace MayaTo{
+
+	// we start building stencils if the points of a topology have changed this often
+	static const int STENCIL_BUILD_THRESHOLD = 2;
+	// stencils of high smooth levels can get huge, so limit the number of weights per mesh
+	static const size_t MAX_STENCIL_WEIGHTS = 32 * 1024 * 1024;
+	// two control points influence the same smoothed point only if they are max 4 face steps away from each other
+	static const int PROBE_COLOR_DISTANCE = 4;
+	static const int ID_BITS = 10;
+
+	static unsigned long long hashBytes(const void *data, size_t numBytes, unsigned long long hash)
+	{
+		const unsigned char *bytes = (const unsigned char *)data;
+		for (size_t i = 0; i < numBytes; i++)
+		{
+			hash ^= bytes[i];
+			hash *= 1099511628211ULL;
+		}
+		return hash;
+	}
+
+	template<typename T> static unsigned long long hashValue(T value, unsigned long long hash)
+	{
+		return hashBytes(&value, sizeof(T), hash);
+	}
+
+	static unsigned long long hashIntArray(const MIntArray& a, unsigned long long hash)
+	{
+		hash = hashValue(a.length(), hash);
+		for (uint i = 0; i < a.length(); i++)
+			hash = hashValue(a[i], hash);
+		return hash;
+	}
+
+	static unsigned long long hashTopology(MFnMesh& meshFn, MMeshSmoothOptions& options)
+	{
+		unsigned long long hash = 14695981039346656037ULL;
+		hash = hashValue(options.divisions(), hash);
+		hash = hashValue(options.smoothness(), hash);
+		hash = hashValue((int)options.boundaryRule(), hash);
+		hash = hashValue(options.propEdgeHardness(), hash);
+		hash = hashValue(options.keepBorder(), hash);
+		hash = hashValue(options.keepHardEdge(), hash);
+		hash = hashValue(options.smoothUVs(), hash);
+		hash = hashValue((int)options.keepMapBorders(), hash);
+
+		hash = hashValue(meshFn.numVertices(), hash);
+		MIntArray counts, ids;
+		meshFn.getVertices(counts, ids);
+		hash = hashIntArray(counts, hash);
+		hash = hashIntArray(ids, hash);
+
+		// uvs are copied from the cached smooth mesh, so they are part of the key
+		MFloatArray u, v;
+		meshFn.getUVs(u, v);
+		for (uint i = 0; i < u.length(); i++)
+		{
+			hash = hashValue(u[i], hash);
+			hash = hashValue(v[i], hash);
+		}
+		MIntArray uvCounts, uvIds;
+		meshFn.getAssignedUVs(uvCounts, uvIds);
+		hash = hashIntArray(uvCounts, hash);
+		hash = hashIntArray(uvIds, hash);
+
+		MUintArray creaseIds;
+		MDoubleArray creaseData;
+		if (meshFn.getCreaseEdges(creaseIds, creaseData))
+			for (uint i = 0; i < creaseIds.length(); i++)
+			{
+				hash = hashValue(creaseIds[i], hash);
+				hash = hashValue(creaseData[i], hash);
+			}
+		creaseIds.clear();
+		creaseData.clear();
+		if (meshFn.getCreaseVertices(creaseIds, creaseData))
+			for (uint i = 0; i < creaseIds.length(); i++)
+			{
+				hash = hashValue(creaseIds[i], hash);
+				hash = hashValue(creaseData[i], hash);
+			}
+
+		// hard edges are respected if keepHardEdge is on
+		int numEdges = meshFn.numEdges();
+		for (int e = 0; e < numEdges; e++)
+			hash = hashValue(meshFn.isEdgeSmooth(e), hash);
+
+		return hash;
+	}
+
+	static unsigned long long hashPoints(const MPointArray& points)
+	{
+		unsigned long long hash = 14695981039346656037ULL;
+		for (uint i = 0; i < points.length(); i++)
+		{
+			hash = hashValue(points[i].x, hash);
+			hash = hashValue(points[i].y, hash);
+			hash = hashValue(points[i].z, hash);
+		}
+		return hash;
+	}
+
+	static MObject smoothMesh(MObject meshObject, MMeshSmoothOptions& options, MObject& dataObject)
+	{
+		MStatus stat;
+		MFnMesh meshFn(meshObject);
+		MFnMeshData meshData;
+		dataObject = meshData.create();
+		MObject smoothed = meshFn.generateSmoothMesh(dataObject, &options, &stat);
+		if (!stat)
+			return MObject::kNullObj;
+		return smoothed;
+	}
+
+	bool SmoothMeshCache::getRenderMesh(MObject& meshObject)
+	{
+		MStatus stat;
+		MFnMesh meshFn(meshObject, &stat);
+		if (!stat)
+			return false;
+
+		if (!meshFn.findPlug("displaySmoothMesh").asBool())
+			return false;
+
+		MMeshSmoothOptions options;
+		stat = meshFn.getSmoothMeshDisplayOptions(options);
+		if (!stat)
+			return false;
+		if (!meshFn.findPlug("useSmoothPreviewForRender", false, &stat).asBool())
+		{
+			int smoothLevel = meshFn.findPlug("renderSmoothLevel", false, &stat).asInt();
+			options.setDivisions(smoothLevel);
+		}
+		if (options.divisions() <= 0)
+			return false;
+
+		MObject smoothed = getSmoothMesh(meshObject, options);
+		if (smoothed == MObject::kNullObj)
+			return false;
+		meshObject = smoothed;
+		return true;
+	}
+
+	SmoothMeshCache::Entry& SmoothMeshCache::getEntry(const MObject& meshNode)
+	{
+		unsigned int key = MObjectHandle(meshNode).hashCode();
+		auto range = this->entries.equal_range(key);
+		for (auto it = range.first; it != range.second; it++)
+		{
+			if (it->second.meshNode == meshNode)
+				return it->second;
+		}
+		Entry entry;
+		entry.meshNode = meshNode;
+		return this->entries.insert(std::make_pair(key, entry))->second;
+	}
+
+	MObject SmoothMeshCache::getSmoothMesh(MObject meshObject, MMeshSmoothOptions& options)
+	{
+		MStatus stat;
+		MFnMesh meshFn(meshObject, &stat);
+		if (!stat)
+			return MObject::kNullObj;
+
+		unsigned long long topologyHash = hashTopology(meshFn, options);
+		MPointArray points;
+		meshFn.getPoints(points);
+		unsigned long long pointHash = hashPoints(points);
+
+		Entry& entry = this->getEntry(meshObject);
+		entry.used = true;
+		if (entry.topologyHash != topologyHash)
+		{
+			// a new topology or other smooth options, nothing of the old entry can be reused
+			Entry newEntry;
+			newEntry.meshNode = meshObject;
+			newEntry.topologyHash = topologyHash;
+			newEntry.used = true;
+			entry = newEntry;
+		}
+		if (entry.smoothMesh != MObject::kNullObj)
+		{
+			if (entry.pointHash == pointHash)
+				return entry.smoothMesh;
+
+			if (!entry.stencilOffsets.empty())
+			{
+				MPointArray smoothPoints;
+				applyStencils(entry, points, smoothPoints);
+				MFnMesh smoothFn(entry.smoothMesh);
+				if (smoothFn.setPoints(smoothPoints))
+				{
+					entry.pointHash = pointHash;
+					return entry.smoothMesh;
+				}
+				Logging::debug("SmoothMeshCache: unable to update smooth mesh points, falling back to smoothing.");
+				entry.stencilsFailed = true;
+				entry.stencilOffsets.clear();
+				entry.stencilControlIds.clear();
+				entry.stencilWeights.clear();
+			}
+			entry.pointChanges++;
+		}
+
+		entry.smoothMesh = smoothMesh(meshObject, options, entry.dataObject);
+		if (entry.smoothMesh == MObject::kNullObj)
+		{
+			// the next call tries again with a fresh entry
+			entry.topologyHash = 0;
+			return MObject::kNullObj;
+		}
+		entry.pointHash = pointHash;
+
+		if ((entry.pointChanges >= STENCIL_BUILD_THRESHOLD) && !entry.stencilsFailed && entry.stencilOffsets.empty())
+		{
+			Logging::debug(MString("SmoothMeshCache: building refinement stencils for ") + meshFn.name());
+			if (!buildStencils(meshObject, options, points, entry))
+			{
+				Logging::debug(MString("SmoothMeshCache: stencils not usable for ") + meshFn.name() + ", using the Maya smoother.");
+				entry.stencilsFailed = true;
+				entry.stencilOffsets.clear();
+				entry.stencilControlIds.clear();
+				entry.stencilWeights.clear();
+			}
+		}
+		return entry.smoothMesh;
+	}
+
+	void SmoothMeshCache::applyStencils(const Entry& entry, const MPointArray& controlPoints, MPointArray& smoothPoints)
+	{
+		int numPoints = (int)entry.stencilOffsets.size() - 1;
+		smoothPoints.setLength(numPoints);
+		for (int pId = 0; pId < numPoints; pId++)
+		{
+			double x = 0.0, y = 0.0, z = 0.0;
+			for (int s = entry.stencilOffsets[pId]; s < entry.stencilOffsets[pId + 1]; s++)
+			{
+				const MPoint& cp = controlPoints[entry.stencilControlIds[s]];
+				double w = entry.stencilWeights[s];
+				x += cp.x * w;
+				y += cp.y * w;
+				z += cp.z * w;
+			}
+			smoothPoints[pId] = MPoint(x, y, z);
+		}
+	}
+
+	// Every probe displaces three groups of control points, one group per axis. The control points of one group
+	// are far enough apart that no smoothed point depends on more than one of them. The first probe returns the
+	// weight, the next two probes encode the low and high bits of the control point id in the displacement.
+	bool SmoothMeshCache::buildStencils(MObject meshObject, MMeshSmoothOptions& options, const MPointArray& controlPoints, Entry& entry)
+	{
+		MStatus stat;
+		MFnMesh meshFn(meshObject);
+		int numControls = controlPoints.length();
+		if (numControls >= (1 << (2 * ID_BITS)))
+			return false;
+
+		// vertex -> face adjacency
+		MIntArray counts, ids;
+		meshFn.getVertices(counts, ids);
+		std::vector<int> faceOffsets(counts.length() + 1, 0);
+		for (uint f = 0; f < counts.length(); f++)
+			faceOffsets[f + 1] = faceOffsets[f] + counts[f];
+		std::vector<int> vtxFaceOffsets(numControls + 1, 0);
+		for (uint i = 0; i < ids.length(); i++)
+			vtxFaceOffsets[ids[i] + 1]++;
+		for (int v = 0; v < numControls; v++)
+			vtxFaceOffsets[v + 1] += vtxFaceOffsets[v];
+		std::vector<int> vtxFaces(ids.length());
+		std::vector<int> fill(vtxFaceOffsets.begin(), vtxFaceOffsets.end() - 1);
+		for (uint f = 0; f < counts.length(); f++)
+			for (int i = faceOffsets[f]; i < faceOffsets[f + 1]; i++)
+				vtxFaces[fill[ids[i]]++] = f;
+
+		// greedy coloring, control points with the same color are more than PROBE_COLOR_DISTANCE face steps apart
+		std::vector<int> colors(numControls, -1);
+		std::vector<int> visited(numControls, -1);
+		std::vector<int> front, nextFront;
+		std::vector<char> usedColors;
+		int numColors = 0;
+		for (int v = 0; v < numControls; v++)
+		{
+			usedColors.assign(numColors + 1, 0);
+			front.assign(1, v);
+			visited[v] = v;
+			for (int d = 0; d < PROBE_COLOR_DISTANCE && !front.empty(); d++)
+			{
+				nextFront.clear();
+				for (int fv : front)
+					for (int fi = vtxFaceOffsets[fv]; fi < vtxFaceOffsets[fv + 1]; fi++)
+					{
+						int f = vtxFaces[fi];
+						for (int i = faceOffsets[f]; i < faceOffsets[f + 1]; i++)
+						{
+							int nv = ids[i];
+							if (visited[nv] == v)
+								continue;
+							visited[nv] = v;
+							if (colors[nv] >= 0)
+								usedColors[colors[nv]] = 1;
+							nextFront.push_back(nv);
+						}
+					}
+				front.swap(nextFront);
+			}
+			int c = 0;
+			while (usedColors[c])
+				c++;
+			colors[v] = c;
+			if (c == numColors)
+				numColors++;
+		}
+
+		MPointArray basePoints;
+		MFnMesh(entry.smoothMesh).getPoints(basePoints);
+		int numPoints = basePoints.length();
+
+		MBoundingBox bbox;
+		for (int v = 0; v < numControls; v++)
+			bbox.expand(controlPoints[v]);
+		double scale = (bbox.width() + bbox.height() + bbox.depth() + 1.0) * 10.0;
+		const double weightEpsilon = 1.0e-6;
+
+		MFnMeshData probeData;
+		MObject probeDataObject = probeData.create();
+		MObject probeMesh = meshFn.copy(meshObject, probeDataObject, &stat);
+		if (!stat)
+			return false;
+		MFnMesh probeFn(probeMesh);
+
+		std::vector<std::vector<std::pair<int, float>>> stencils(numPoints);
+		size_t numWeights = 0;
+		const int idMask = (1 << ID_BITS) - 1;
+
+		for (int firstColor = 0; firstColor < numColors; firstColor += 3)
+		{
+			MPointArray probes[3] = { controlPoints, controlPoints, controlPoints };
+			for (int v = 0; v < numControls; v++)
+			{
+				int axis = colors[v] - firstColor;
+				if ((axis < 0) || (axis > 2))
+					continue;
+				probes[0][v][axis] += scale;
+				probes[1][v][axis] += scale * ((v & idMask) + 1);
+				probes[2][v][axis] += scale * ((v >> ID_BITS) + 1);
+			}
+			MPointArray results[3];
+			for (int p = 0; p < 3; p++)
+			{
+				probeFn.setPoints(probes[p]);
+				MObject dataObject;
+				MObject smoothed = smoothMesh(probeMesh, options, dataObject);
+				if (smoothed == MObject::kNullObj)
+					return false;
+				MFnMesh(smoothed).getPoints(results[p]);
+				if (results[p].length() != numPoints)
+					return false;
+			}
+
+			for (int pId = 0; pId < numPoints; pId++)
+			{
+				for (int axis = 0; axis < 3; axis++)
+				{
+					double w = (results[0][pId][axis] - basePoints[pId][axis]) / scale;
+					if (std::fabs(w) < weightEpsilon)
+						continue;
+					double lowId = (results[1][pId][axis] - basePoints[pId][axis]) / (scale * w) - 1.0;
+					double highId = (results[2][pId][axis] - basePoints[pId][axis]) / (scale * w) - 1.0;
+					int low = (int)std::floor(lowId + 0.5);
+					int high = (int)std::floor(highId + 0.5);
+					if ((std::fabs(lowId - low) > 0.1) || (std::fabs(highId - high) > 0.1))
+						return false;
+					int controlId = (high << ID_BITS) | low;
+					if ((low < 0) || (high < 0) || (controlId >= numControls) || (colors[controlId] != firstColor + axis))
+						return false;
+					stencils[pId].push_back(std::pair<int, float>(controlId, (float)w));
+					if (++numWeights > MAX_STENCIL_WEIGHTS)
+						return false;
+				}
+			}
+		}
+
+		entry.stencilOffsets.assign(numPoints + 1, 0);
+		entry.stencilControlIds.reserve(numWeights);
+		entry.stencilWeights.reserve(numWeights);
+		for (int pId = 0; pId < numPoints; pId++)
+		{
+			for (auto& s : stencils[pId])
+			{
+				entry.stencilControlIds.push_back(s.first);
+				entry.stencilWeights.push_back(s.second);
+			}
+			entry.stencilOffsets[pId + 1] = (int)entry.stencilControlIds.size();
+		}
+
+		// the stencils have to reproduce the current smooth mesh, otherwise something is not linear here
+		MPointArray check;
+		applyStencils(entry, controlPoints, check);
+		double tolerance = 1.0e-4 * (bbox.width() + bbox.height() + bbox.depth() + 1.0);
+		for (int pId = 0; pId < numPoints; pId++)
+			if (check[pId].distanceTo(basePoints[pId]) > tolerance)
+				return false;
+
+		Logging::debug(MString("SmoothMeshCache: ") + numColors + " probe groups, " + (int)numWeights + " weights for " + numPoints + " points.");
+		return true;
+	}
+
+	void SmoothMeshCache::removeUnusedEntries()
+	{
+		size_t numRemoved = 0;
+		for (auto it = this->entries.begin(); it != this->entries.end();)
+		{
+			if (!it->second.used)
+			{
+				it = this->entries.erase(it);
+				numRemoved++;
+				continue;
+			}
+			it->second.used = false;
+			it++;
+		}
+		if (numRemoved > 0)
+			Logging::debug(MString("SmoothMeshCache: removed ") + (int)numRemoved + " unused smooth meshes.");
+	}
+
+	void SmoothMeshCache::clear()
+	{
+		this->entries.clear();
+	}
+
+	SmoothMeshCache& getSmoothMeshCache()
+	{
+		static SmoothMeshCache cache;
+		return cache;
+	}
+}
@@ -0,0 +1,66 @@
+#ifndef SMOOTH_MESH_CACHE_H
+#define SMOOTH_MESH_CACHE_H
+
+/*
+Cache for the results of MFnMesh::generateSmoothMesh().
+
+Entries are keyed by the mesh node. Every entry saves a hash of the control cage topology (face vertices,
+uvs, creases, hard edges) and the smooth options incl. the smooth level. If the same mesh is smoothed
+again with the same topology and unchanged points, the cached smooth mesh is returned directly, a new
+topology replaces the entry. Entries of meshes which were not smoothed during a frame are removed
+at the end of the frame, so a sequence does not collect the smooth meshes of all frames.
+
+If only the point positions change, we do not want to run the Maya smoother again. The subdivision
+is linear in the control points, so every smoothed point is a weighted sum of some control points.
+As soon as a topology is seen with changing points, these weights (stencils) are read back once
+by probing the smoother with displaced control points. Afterwards a point change only needs
+the stencil evaluation and a setPoints() on the cached smooth mesh.
+Building the stencils costs some smooth calls, so it is only done for meshes which are really animated.
+*/
+
+#include <unordered_map>
+#include <vector>
+#include <maya/MObject.h>
+#include <maya/MPointArray.h>
+#include <maya/MMeshSmoothOptions.h>
+
+namespace MayaTo{
+
+	class SmoothMeshCache
+	{
+	public:
+		// If the mesh has to be smoothed for rendering, meshObject is replaced by the smoothed version.
+		// Returns false if no smoothing is needed.
+		bool getRenderMesh(MObject& meshObject);
+		MObject getSmoothMesh(MObject meshObject, MMeshSmoothOptions& options);
+		// end of a frame: removes the entries which were not used since the last call
+		void removeUnusedEntries();
+		void clear();
+
+	private:
+		struct Entry{
+			MObject meshNode;
+			unsigned long long topologyHash = 0;
+			bool used = false;
+			MObject dataObject;
+			MObject smoothMesh;
+			unsigned long long pointHash = 0;
+			int pointChanges = 0;
+			bool stencilsFailed = false;
+			// stencils in compressed rows, one row per smoothed point
+			std::vector<int> stencilOffsets;
+			std::vector<int> stencilControlIds;
+			std::vector<float> stencilWeights;
+		};
+		// key is the MObjectHandle hash code, different nodes can have the same hash code
+		std::unordered_multimap<unsigned int, Entry> entries;
+		Entry& getEntry(const MObject& meshNode);
+
+		bool buildStencils(MObject meshObject, MMeshSmoothOptions& options, const MPointArray& controlPoints, Entry& entry);
+		void applyStencils(const Entry& entry, const MPointArray& controlPoints, MPointArray& smoothPoints);
+	};
+
+	SmoothMeshCache& getSmoothMeshCache();
+}
+
+#endif
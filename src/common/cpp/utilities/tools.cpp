@@ -8,6 +8,8 @@
 #include <maya/MSelectionList.h>
 #include <maya/MTransformationMatrix.h>
 #include <maya/MFnAttribute.h>
+#include <maya/MObjectHandle.h>
+#include <mutex>
 
 #include "utilities/tools.h"
 #include "utilities/attrTools.h"
@@ -76,10 +78,20 @@ MString getRendererHome()
 	return RendererHome;
 }
 
+// the globals node is requested very often, so we keep its handle and only search it again if it was deleted, e.g. by a new scene
+static MObjectHandle globalsNodeHandle;
+static std::mutex globalsNodeMutex;
+
 MObject getRenderGlobalsNode()
 {
+	std::lock_guard<std::mutex> lock(globalsNodeMutex);
+	if (globalsNodeHandle.isValid() && globalsNodeHandle.isAlive())
+		return globalsNodeHandle.object();
 	MString globalsNodeName = MString(pystring::lower(getRendererName().asChar()).c_str()) + "Globals";
-	return objectFromName(globalsNodeName);
+	MObject globalsNode = objectFromName(globalsNodeName);
+	if (!globalsNode.isNull())
+		globalsNodeHandle = MObjectHandle(globalsNode);
+	return globalsNode;
 }
 
 
@@ -134,6 +146,20 @@ MString makeHierarchyString(MString& oldString)
 		newString = std::string("/") + newString;
 	return MString(newString.c_str());
 }
+
+std::string escapeJson(const std::string& text)
+{
+	std::string escaped;
+	for (char c : text)
+	{
+		if ((c == '"') || (c == '\\'))
+			escaped += '\\';
+		if ((unsigned char)c < 0x20)
+			continue;
+		escaped += c;
+	}
+	return escaped;
+}
 MString makeGoodHierarchyString(MString& oldString)
 {
 	MString returnString, workString = oldString;
@@ -15,6 +15,7 @@
 #include <math.h>
 #include <memory>
 #include <vector>
+#include <string>
 
 static MString RendererName;
 static MString RendererShortCut;
@@ -53,6 +54,9 @@ MString makeGoodHierarchyString(MString& oldString);
 
 MString makeHierarchyString(MString& oldString);
 
+// escapes a string for a json string value, control characters are removed
+std::string escapeJson(const std::string& text);
+
 MString getPlugName(MString& longPlugname);
 
 bool IsVisible(MFnDagNode& node);
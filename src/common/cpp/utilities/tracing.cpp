@@ -0,0 +1,211 @@
+#include "tracing.h"
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <stdio.h>
+#include "logging.h"
+#include "tools.h"
+
+// vs2013 does not support thread_local, only plain pointers are saved per thread
+#ifdef _WIN32
+#define MT_THREAD_LOCAL __declspec(thread)
+#else
+#define MT_THREAD_LOCAL __thread
+#endif
+
+namespace MayaTo{
+
+	struct TraceEvent{
+		const char *name;
+		std::string detail;
+		long long startTime; // nanoseconds since traceEpoch
+		long long duration;
+	};
+
+	struct TraceThreadBuffer{
+		int threadId = 0;
+		// trace generation in which a thread has taken the buffer, 0 while it is free
+		unsigned int generation = 0;
+		std::string threadName;
+		// only contended while the trace is cleared or written
+		std::mutex mutex;
+		std::vector<TraceEvent> events;
+	};
+
+	static std::atomic<bool> tracingEnabled(false);
+	static const std::chrono::steady_clock::time_point traceEpoch = std::chrono::steady_clock::now();
+	// the buffers are not deleted, because a thread can still hold the pointer to its buffer. clearTrace() releases
+	// all of them and the threads which trace in the next frame take the free ones again, so the parallelFor threads of
+	// many frames do not add up, there are only as many buffers as threads were tracing within one frame.
+	static std::mutex traceBuffersMutex;
+	static std::vector<std::unique_ptr<TraceThreadBuffer>> traceBuffers;
+	static unsigned int traceGeneration = 1;
+	static int numTraceThreads = 0;
+	static MT_THREAD_LOCAL TraceThreadBuffer *threadTraceBuffer = nullptr;
+	static MT_THREAD_LOCAL unsigned int threadTraceGeneration = 0;
+	static MT_THREAD_LOCAL const char *threadTraceName = nullptr;
+
+	static long long getTraceTime()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - traceEpoch).count();
+	}
+
+	static TraceThreadBuffer *getThreadTraceBuffer()
+	{
+		if (threadTraceBuffer != nullptr)
+			return threadTraceBuffer;
+		std::lock_guard<std::mutex> lock(traceBuffersMutex);
+		TraceThreadBuffer *buffer = nullptr;
+		for (auto& it : traceBuffers)
+		{
+			if (it->generation == 0)
+			{
+				buffer = it.get();
+				break;
+			}
+		}
+		if (buffer == nullptr)
+		{
+			traceBuffers.push_back(std::unique_ptr<TraceThreadBuffer>(new TraceThreadBuffer));
+			buffer = traceBuffers.back().get();
+		}
+		std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+		buffer->generation = traceGeneration;
+		buffer->threadId = ++numTraceThreads;
+		buffer->threadName = (threadTraceName != nullptr) ? threadTraceName : "";
+		threadTraceGeneration = traceGeneration;
+		threadTraceBuffer = buffer;
+		return threadTraceBuffer;
+	}
+
+	// returns the buffer of the current thread with its mutex locked
+	static TraceThreadBuffer *lockThreadTraceBuffer(std::unique_lock<std::mutex>& lock)
+	{
+		for (;;)
+		{
+			TraceThreadBuffer *buffer = getThreadTraceBuffer();
+			lock = std::unique_lock<std::mutex>(buffer->mutex);
+			if (buffer->generation == threadTraceGeneration)
+				return buffer;
+			// clearTrace() has released the buffer, it can belong to another thread now
+			lock.unlock();
+			threadTraceBuffer = nullptr;
+		}
+	}
+
+	static void addTraceEvent(const char *name, std::string& detail, long long startTime, long long endTime)
+	{
+		TraceEvent event;
+		event.name = name;
+		event.detail.swap(detail);
+		event.startTime = startTime;
+		event.duration = endTime - startTime;
+		std::unique_lock<std::mutex> lock;
+		TraceThreadBuffer *buffer = lockThreadTraceBuffer(lock);
+		buffer->events.push_back(std::move(event));
+	}
+
+	void setTracingEnabled(bool enabled)
+	{
+		tracingEnabled = enabled;
+	}
+
+	bool isTracingEnabled()
+	{
+		return tracingEnabled;
+	}
+
+	void clearTrace()
+	{
+		std::lock_guard<std::mutex> lock(traceBuffersMutex);
+		for (auto& it : traceBuffers)
+		{
+			std::lock_guard<std::mutex> bufferLock(it->mutex);
+			std::vector<TraceEvent>().swap(it->events);
+			it->threadName.clear();
+			it->generation = 0;
+		}
+		traceGeneration++;
+		numTraceThreads = 0;
+	}
+
+	void setTraceThreadName(const char *threadName)
+	{
+		threadTraceName = threadName;
+		std::unique_lock<std::mutex> lock;
+		TraceThreadBuffer *buffer = lockThreadTraceBuffer(lock);
+		buffer->threadName = threadName;
+	}
+
+	bool writeTrace(const MString& fileName)
+	{
+		std::ofstream traceFile(fileName.asChar());
+		if (!traceFile.good())
+		{
+			Logging::error(MString("Unable to write trace file ") + fileName);
+			return false;
+		}
+
+		size_t numEvents = 0;
+		char timeString[64];
+		traceFile << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+		traceFile << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": 0, \"args\": {\"name\": \"mayaTo" << getRendererName().asChar() << "\"}}";
+		std::lock_guard<std::mutex> lock(traceBuffersMutex);
+		for (auto& it : traceBuffers)
+		{
+			TraceThreadBuffer& buffer = *it;
+			std::lock_guard<std::mutex> bufferLock(buffer.mutex);
+			if ((buffer.generation == 0) || buffer.events.empty())
+				continue;
+			std::string threadName = buffer.threadName.empty() ? "thread " + std::to_string(buffer.threadId) : buffer.threadName;
+			traceFile << ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << buffer.threadId << ", \"args\": {\"name\": \"" << escapeJson(threadName) << "\"}}";
+			for (const TraceEvent& event : buffer.events)
+			{
+				// chrome expects microseconds
+				snprintf(timeString, sizeof(timeString), "\"ts\": %.3f, \"dur\": %.3f", event.startTime / 1000.0, event.duration / 1000.0);
+				traceFile << ",\n{\"name\": \"" << event.name << "\", \"cat\": \"translation\", \"ph\": \"X\", " << timeString << ", \"pid\": 1, \"tid\": " << buffer.threadId;
+				if (!event.detail.empty())
+					traceFile << ", \"args\": {\"detail\": \"" << escapeJson(event.detail) << "\"}";
+				traceFile << "}";
+			}
+			numEvents += buffer.events.size();
+		}
+		traceFile << "\n]}\n";
+		traceFile.close();
+		Logging::info(MString("Saved ") + (int)numEvents + " trace events in " + fileName);
+		return true;
+	}
+
+	TraceZone::TraceZone(const char *zoneName) : name(zoneName), startTime(0), active(isTracingEnabled())
+	{
+		if (this->active)
+			this->startTime = getTraceTime();
+	}
+
+	TraceZone::TraceZone(const char *zoneName, const MString& zoneDetail) : name(zoneName), startTime(0), active(isTracingEnabled())
+	{
+		if (this->active)
+		{
+			this->detail = zoneDetail.asChar();
+			this->startTime = getTraceTime();
+		}
+	}
+
+	TraceZone::TraceZone(const char *zoneName, const std::string& zoneDetail) : name(zoneName), startTime(0), active(isTracingEnabled())
+	{
+		if (this->active)
+		{
+			this->detail = zoneDetail;
+			this->startTime = getTraceTime();
+		}
+	}
+
+	TraceZone::~TraceZone()
+	{
+		if (this->active)
+			addTraceEvent(this->name, this->detail, this->startTime, getTraceTime());
+	}
+}
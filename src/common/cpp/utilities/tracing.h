@@ -0,0 +1,54 @@
+#ifndef MT_TRACING_H
+#define MT_TRACING_H
+
+/*
+	Scoped tracing of the scene translation.
+
+	A TraceZone measures the time between its construction and destruction with the monotonic clock and saves it
+	in a buffer of the current thread, so the zones of the worker threads do not wait for each other. At the end
+	of a frame all buffers are written as Chrome trace events, the file can be opened in chrome://tracing or in
+	Perfetto. A zone can carry a detail string like the object name, so slow objects can be found in the trace.
+
+	Tracing is switched on with the traceTranslation attribute of the render globals. If it is off, a zone only
+	reads an atomic flag.
+*/
+
+#include <string>
+#include <maya/MString.h>
+
+namespace MayaTo{
+
+	void setTracingEnabled(bool enabled);
+	bool isTracingEnabled();
+	// removes all recorded events, called at the start of every frame
+	void clearTrace();
+	// name of the current thread in the trace viewer, it has to be a string literal, it is kept for later frames
+	void setTraceThreadName(const char *threadName);
+	// writes all recorded events as Chrome trace json
+	bool writeTrace(const MString& fileName);
+
+	class TraceZone
+	{
+	public:
+		// the name has to be a string literal, it is not copied
+		explicit TraceZone(const char *zoneName);
+		TraceZone(const char *zoneName, const MString& detail);
+		// for worker threads which must not touch maya objects
+		TraceZone(const char *zoneName, const std::string& detail);
+		~TraceZone();
+	private:
+		TraceZone(const TraceZone&);
+		TraceZone& operator=(const TraceZone&);
+		const char *name;
+		std::string detail;
+		long long startTime;
+		bool active;
+	};
+}
+
+#define TRACE_ZONE_NAME2(line) traceZone##line
+#define TRACE_ZONE_NAME(line) TRACE_ZONE_NAME2(line)
+#define TRACE_ZONE(name) MayaTo::TraceZone TRACE_ZONE_NAME(__LINE__)(name)
+#define TRACE_ZONE_DETAIL(name, detail) MayaTo::TraceZone TRACE_ZONE_NAME(__LINE__)(name, detail)
+
+#endif
@@ -0,0 +1,240 @@
+"""
+Translation benchmark
+
+Creates synthetic scenes and translates them with the benchmark renderer of the plugin (the -benchmark flag of the
+render command). Nothing is rendered, only the time of the translation phases is measured: parse, light linking,
+motion sampling, mesh extraction, mesh triangulation and material translation.
+
+Run it with mayapy:
+
+    mayapy translationBenchmark.py --renderer corona --output results.json
+    mayapy translationBenchmark.py --renderer corona --output new.json --baseline results.json
+    mayapy translationBenchmark.py --renderer corona --plugin C:/build/x64/Release/mayatoCorona_maya2016.mll
+
+The plugin is loaded by the default name of the renderer below, use --plugin to load a build with another name
+or from a path which is not part of the MAYA_PLUG_IN_PATH.
+
+The results file contains one entry per scene. With a baseline file every phase which became slower than the
+threshold is reported and the script exits with 1, so it can be used in automatic tests.
+"""
+
+import sys
+import json
+import logging
+import argparse
+import platform
+
+log = logging.getLogger("renderLogger")
+
+RENDERERS = {
+    "corona": {"plugin": "mayatoCorona", "command": "mayatoCorona", "globals": "coronaGlobals"},
+    "appleseed": {"plugin": "mayatoappleseed", "command": "mayatoappleseed", "globals": "appleseedGlobals"},
+}
+
+# plugin is only the default name, the built binaries often carry a maya version suffix, see --plugin
+# every case is a dict with the scene settings, missing values use the defaults below
+DEFAULT_CASE = {
+    "meshes": 0,            # number of meshes
+    "triangles": 2000,      # triangles per mesh
+    "instances": 0,         # instances of one extra mesh
+    "lights": 0,            # number of point lights
+    "linkedLights": 0,      # lights which illuminate only every second mesh
+    "hierarchyDepth": 0,    # number of nested groups, one mesh per level
+    "networkSize": 1,       # shading nodes per material
+    "uniqueNetworks": True, # every mesh gets its own material, else all meshes share one network structure
+    "motionBlur": False,    # animated transforms and deformations with 3 motion steps
+}
+
+SUITES = {
+    "quick": [
+        {"name": "meshes_100x2k", "meshes": 100, "triangles": 2000},
+        {"name": "instances_1k", "meshes": 1, "instances": 1000},
+        {"name": "lights_50_linked", "meshes": 100, "lights": 50, "linkedLights": 25},
+        {"name": "hierarchy_200", "hierarchyDepth": 200},
+        {"name": "networks_100x20", "meshes": 100, "triangles": 200, "networkSize": 20},
+        {"name": "motionblur_100", "meshes": 100, "triangles": 2000, "motionBlur": True},
+    ],
+    "full": [
+        {"name": "meshes_1000x2k", "meshes": 1000, "triangles": 2000},
+        {"name": "meshes_10x1m", "meshes": 10, "triangles": 1000000},
+        {"name": "instances_10k", "meshes": 1, "instances": 10000},
+        {"name": "lights_200_linked", "meshes": 1000, "triangles": 200, "lights": 200, "linkedLights": 100},
+        {"name": "hierarchy_1000", "hierarchyDepth": 1000},
+        {"name": "networks_1000x50", "meshes": 1000, "triangles": 200, "networkSize": 50},
+        {"name": "networks_shared_1000x50", "meshes": 1000, "triangles": 200, "networkSize": 50, "uniqueNetworks": False},
+        {"name": "motionblur_1000", "meshes": 1000, "triangles": 2000, "motionBlur": True},
+    ],
+}
+
+
+def createMesh(name, triangles):
+    import pymel.core as pm
+    # a plane with n x n faces has 2 * n * n triangles
+    subdivisions = max(1, int((triangles / 2.0) ** 0.5))
+    return pm.polyPlane(name=name, sx=subdivisions, sy=subdivisions, ch=False)[0]
+
+
+def createShadingNetwork(name, networkSize, uniqueIndex):
+    import pymel.core as pm
+    shader = pm.shadingNode("lambert", asShader=True, name=name + "_mat")
+    shadingGroup = pm.sets(renderable=True, noSurfaceShader=True, empty=True, name=name + "_SG")
+    shader.outColor >> shadingGroup.surfaceShader
+    # a chain of utility nodes, the unique index changes the structure so that the networks cannot share a material
+    lastNode = None
+    for i in range(networkSize - 1):
+        node = pm.shadingNode("multiplyDivide", asUtility=True, name="{0}_md{1}".format(name, i))
+        node.input2.set(1.0, 1.0, 1.0 + (uniqueIndex % 7) * 0.1)
+        node.operation.set(1 + (uniqueIndex + i) % 2)
+        if lastNode is not None:
+            lastNode.output >> node.input1
+        lastNode = node
+    if lastNode is not None:
+        lastNode.output >> shader.color
+    return shadingGroup
+
+
+def assignNetwork(mesh, shadingGroup):
+    import pymel.core as pm
+    pm.sets(shadingGroup, forceElement=mesh)
+
+
+def animate(transform, deform):
+    import pymel.core as pm
+    pm.setKeyframe(transform, attribute="translateY", time=1, value=0.0)
+    pm.setKeyframe(transform, attribute="translateY", time=10, value=5.0)
+    if deform:
+        bend = pm.nonLinear(transform, type="bend")
+        pm.setKeyframe(bend[0], attribute="curvature", time=1, value=0.0)
+        pm.setKeyframe(bend[0], attribute="curvature", time=10, value=1.0)
+
+
+def buildScene(case, globalsNode):
+    import pymel.core as pm
+    meshes = []
+    for i in range(case["meshes"]):
+        mesh = createMesh("mesh{0}".format(i), case["triangles"])
+        mesh.translate.set(i % 100, 0, i // 100)
+        meshes.append(mesh)
+        # networks with the same structure are translated only once by the material cache
+        uniqueIndex = i if case["uniqueNetworks"] else 0
+        assignNetwork(mesh, createShadingNetwork("network{0}".format(i), case["networkSize"], uniqueIndex))
+        if case["motionBlur"]:
+            animate(mesh, deform=(i % 2 == 0))
+
+    if case["instances"] > 0:
+        original = createMesh("instanced", case["triangles"])
+        for i in range(case["instances"]):
+            instance = pm.instance(original)[0]
+            instance.translate.set(i % 100, 2, i // 100)
+
+    parent = None
+    for level in range(case["hierarchyDepth"]):
+        group = pm.group(empty=True, name="level{0}".format(level))
+        if parent is not None:
+            pm.parent(group, parent)
+        mesh = createMesh("levelMesh{0}".format(level), case["triangles"])
+        pm.parent(mesh, group)
+        group.translate.set(0.1, 0, 0)
+        parent = group
+
+    for i in range(case["lights"]):
+        light = pm.pointLight(name="light{0}".format(i))
+        lightTransform = light.getParent()
+        lightTransform.translate.set(i % 20, 5, i // 20)
+        if i < case["linkedLights"]:
+            pm.lightlink(b=True, light=lightTransform, object=meshes[1::2])
+
+    globalsNode.doMotionBlur.set(case["motionBlur"])
+    if case["motionBlur"]:
+        globalsNode.xftimesamples.set(3)
+        globalsNode.geotimesamples.set(3)
+        pm.currentTime(5)
+
+
+def runCase(renderer, case):
+    import pymel.core as pm
+    settings = dict(DEFAULT_CASE)
+    settings.update(case)
+    pm.newFile(force=True)
+    rendererInfo = RENDERERS[renderer]
+    if len(pm.ls(rendererInfo["globals"])) == 0:
+        globalsNode = pm.createNode(rendererInfo["globals"])
+        globalsNode.rename(rendererInfo["globals"])
+    globalsNode = pm.PyNode(rendererInfo["globals"])
+    pm.PyNode("defaultRenderGlobals").currentRenderer.set(renderer)
+
+    log.info("Building scene {0}".format(settings["name"]))
+    buildScene(settings, globalsNode)
+    import maya.cmds as cmds
+    command = getattr(cmds, rendererInfo["command"])
+    result = json.loads(command(benchmark=("", settings["name"])))
+    result["settings"] = settings
+    return result
+
+
+def compareResults(results, baselineFile, threshold):
+    baseline = json.load(open(baselineFile))
+    baselinePhases = {}
+    for result in baseline["results"]:
+        for phase in result["phases"]:
+            baselinePhases[(result["scene"], phase["name"])] = phase["seconds"]
+    regressions = []
+    for result in results:
+        for phase in result["phases"]:
+            oldSeconds = baselinePhases.get((result["scene"], phase["name"]))
+            # very short phases are dominated by noise
+            if oldSeconds is None or oldSeconds < 0.01:
+                continue
+            ratio = phase["seconds"] / oldSeconds
+            if ratio > threshold:
+                regressions.append("{0} {1}: {2:.3f}s -> {3:.3f}s ({4:.2f}x)".format(result["scene"], phase["name"], oldSeconds, phase["seconds"], ratio))
+    return regressions
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description="Translation benchmark with synthetic scenes.")
+    parser.add_argument("--renderer", default="corona", choices=sorted(RENDERERS.keys()))
+    parser.add_argument("--plugin", default=None, help="plugin name or path, default is the name of the renderer plugin")
+    parser.add_argument("--suite", default="quick", choices=sorted(SUITES.keys()))
+    parser.add_argument("--output", default="translationBenchmark.json")
+    parser.add_argument("--baseline", default=None, help="results of an older run to compare with")
+    parser.add_argument("--threshold", type=float, default=1.25, help="maximum allowed slowdown of a phase")
+    args = parser.parse_args(argv)
+
+    logging.basicConfig(level=logging.INFO)
+    import maya.standalone
+    maya.standalone.initialize(name="python")
+    import pymel.core as pm
+    plugin = args.plugin or RENDERERS[args.renderer]["plugin"]
+    log.info("Loading plugin {0}".format(plugin))
+    pm.loadPlugin(plugin, quiet=True)
+
+    results = []
+    for case in SUITES[args.suite]:
+        results.append(runCase(args.renderer, case))
+
+    output = {
+        "renderer": args.renderer,
+        "suite": args.suite,
+        "mayaVersion": pm.about(version=True),
+        "platform": platform.platform(),
+        "results": results,
+    }
+    with open(args.output, "w") as outFile:
+        json.dump(output, outFile, indent=2, sort_keys=True)
+    log.info("Benchmark results saved in {0}".format(args.output))
+
+    exitCode = 0
+    if args.baseline is not None:
+        regressions = compareResults(results, args.baseline, args.threshold)
+        for regression in regressions:
+            log.error("Slower than baseline: " + regression)
+        if len(regressions) > 0:
+            exitCode = 1
+
+    maya.standalone.uninitialize()
+    return exitCode
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
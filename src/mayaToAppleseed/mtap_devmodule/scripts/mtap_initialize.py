@@ -542,6 +542,10 @@ class AppleseedRenderer(Renderer.MayaToRenderer):
         pm.addExtension(nodeType="areaLight", longName="mtap_visibleSpecular", attributeType="bool", defaultValue=True)
         pm.addExtension(nodeType="areaLight", longName="mtap_visibleDiffuse", attributeType="bool", defaultValue=True)
         pm.addExtension(nodeType="areaLight", longName="mtap_visibleTransparency", attributeType="bool", defaultValue=True)
+
+        # objects which are never removed by region or frustum culling, shared by all mayaTo plugins, so it may already exist
+        if not pm.attributeQuery("mtNeverCull", type="dagNode", exists=True):
+            pm.addExtension(nodeType="dagNode", longName="mtNeverCull", attributeType="bool", defaultValue=False)
         
         # shading group
 #        pm.addExtension(nodeType="shadingEngine", longName="mtap_mat_bsdf", attributeType="message")
@@ -608,6 +612,10 @@ class AppleseedRenderer(Renderer.MayaToRenderer):
         log.debug("stopIprRenderProcedure")
         pm.mayatoappleseed(stopIpr=True)
         self.postRenderProcedure()
+
+    def changeIprRegionProcedure(self, *args, **kwargs):
+        log.debug("changeIprRegionProcedure")
+        pm.mayatoappleseed(updateIprRegion=True)
             
     def preRenderProcedure(self):
         self.createGlobalsNode()
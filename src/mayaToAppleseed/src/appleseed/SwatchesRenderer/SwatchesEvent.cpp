@@ -1,10 +0,0 @@
-#include "SwatchesEvent.h"
-
-namespace SQueue
-{
-	concurrent_queue<SEvent> *getQueue()
-	{
-		return &SwatchesQueue;
-	}
-};
-
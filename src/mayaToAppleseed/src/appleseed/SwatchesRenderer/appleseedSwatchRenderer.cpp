@@ -36,10 +36,6 @@
 
 #include "renderer/modeling/shadergroup/shadergroup.h"
 
-#include "SwatchesEvent.h"
-#include "swatchesRenderer/swatchesQueue.h"
-#include "swatchesRenderer/newSwatchRenderer.h"
-#include "swatchesRenderer/swatchGeometry.h"
 #include <maya/MFnDependencyNode.h>
 #include "utilities/logging.h"
 #include "utilities/tools.h"
@@ -86,61 +82,32 @@ AppleseedSwatchRenderer::AppleseedSwatchRenderer()
 		&renderer_controller));
 }
 
-void AppleseedSwatchRenderer::renderSwatch()
+bool AppleseedSwatchRenderer::renderSwatch(AppleseedSwatchJob& job)
 {
 	if (!mrenderer.get())
-		return;
-	//MString tstFile = "C:/daten/3dprojects/mayaToAppleseed/renderData/swatchRenderScene/swatchRender.jpg";
-	//project->get_frame()->write_main_image(tstFile.asChar());
-	//asr::ProjectFileWriter::write(project.ref(), "C:/daten/3dprojects/mayaToAppleseed/renderData/swatchRenderScene/swOutputTest.appleseed");
-}
-
-void AppleseedSwatchRenderer::renderSwatch(NewSwatchRenderer *sr)
-{
-	if (!mrenderer.get())
-		return;
+		return false;
 
-	//std::this_thread::sleep_for(std::chrono::milliseconds(3000));
-	int res(sr->resolution());
-	this->setSize(res);
-	this->setShader(sr->dNode);
+	this->setSize(job.resolution);
+	if (!this->defineMaterial(job))
+		return false;
+	this->renderer_controller.cancelled = &job.cancelled;
 	mrenderer->render();
+	this->renderer_controller.cancelled = nullptr;
+	if (job.cancelled)
+		return false;
 	//MString tstFile = "C:/daten/3dprojects/mayaToAppleseed/renderData/swatchRenderScene/swatchRender.exr";
 	//project->get_frame()->write_main_image(tstFile.asChar());
 	//asr::ProjectFileWriter::write(project.ref(), "C:/daten/3dprojects/mayaToAppleseed/renderData/swatchRenderScene/swOutputTest.appleseed");
 
-	//project->get_frame()->transform_to_output_color_space(project->get_frame()->image());
-
-	sr->image().create(res, res, 4, MImage::kFloat);
-	float *floatPixels = sr->image().floatPixels();
-	this->fillSwatch(floatPixels);
-
-	//float rndR = rnd();
-	//float rndG = rnd();
-	//float rndB = rnd();
-
-	//float *pixels = sr->image().floatPixels();
-	//int index = 0;
-	//for (int y = 0; y < res; y++)
-	//{
-	//	for (int x = 0; x < res; x++)
-	//	{
-	//		float fac = float(y) / res;
-	//		pixels[index++] = fac * rndR;
-	//		pixels[index++] = fac * rndG;
-	//		pixels[index++] = fac * rndB;
-	//		pixels[index++] = 1.0f;
-	//	}
-	//}
-
+	job.pixels.resize((size_t)job.resolution * job.resolution * 4);
+	this->fillSwatch(&job.pixels[0]);
+	return true;
 }
 
 void AppleseedSwatchRenderer::fillSwatch(float *pixels)
 {
 	asf::Image& image = project->get_frame()->image();
-	Logging::info(MString("m_canvas_height:") + image.properties().m_canvas_height);
-	Logging::info(MString("m_rcp_canvas_height:") + image.properties().m_rcp_canvas_height);
-	Logging::info(MString("m_tile_height:") + image.properties().m_tile_height);
+	LOG_DEBUG(MString("m_canvas_height:") + image.properties().m_canvas_height + " m_tile_height:" + image.properties().m_tile_height);
 	int res = image.properties().m_canvas_height;
 	int chCount = image.properties().m_channel_count;
 
@@ -163,7 +130,7 @@ void AppleseedSwatchRenderer::fillSwatch(float *pixels)
 				image.get_pixel(x, y, p);
 				pixels[index++] = p.r;
 				pixels[index++] = p.g;
-				pixels[index++] = p.g;
+				pixels[index++] = p.b;
 				pixels[index++] = 1.0f;
 			}
 		}
@@ -182,14 +149,9 @@ void AppleseedSwatchRenderer::setSize(int size)
 		frameParams));
 }
 
-void AppleseedSwatchRenderer::setShader(MObject shader)
-{
-	this->defineMaterial(shader);
-}
-
 AppleseedSwatchRenderer::~AppleseedSwatchRenderer()
 {
-	terminateAppleseedSwatchRender(this);
+	mrenderer.reset();
 	project.release();
 #if _DEBUG
 	asr::global_logger().remove_target(log_target.get());
@@ -197,61 +159,13 @@ AppleseedSwatchRenderer::~AppleseedSwatchRenderer()
 	Logging::debug("Removing AppleseedSwatchRenderer.");
 }
 
-void AppleseedSwatchRenderer::mainLoop()
-{
-#ifdef _DEBUG
-	Logging::setLogLevel(Logging::Debug);
-#endif
-
-	SQueue::SEvent swatchEvent;
-	Logging::debug("Starting AppleseedSwatchRenderer main Loop.");
-	while (!terminateLoop)
-	{
-		SQueue::getQueue()->wait_and_pop(swatchEvent);
-		Logging::debug(MString("AppleseedSwatchRenderer main Loop: renderDoneAddr: ") + (int)swatchEvent.renderDone);
-
-		if (swatchEvent.renderDone == nullptr)
-		{
-			Logging::debug(MString("AppleseedSwatchRenderer main Loop: received a null ptr. Terminating loop"));
-			terminateLoop = true;
-		}
-		else{
-			//this->setShader(swatchEvent.shadingNode);
-			//this->setSize(swatchEvent.height);
-			//std::this_thread::sleep_for(std::chrono::milliseconds(3000));
-			//this->renderSwatch();
-			//this->fillSwatch(swatchEvent.pixels);
-			swatchEvent.swatchRenderer->finishParallelRender();
-			*swatchEvent.renderDone = true;
-		}
-	}
-	loopDone = true;
-}
-
-
-void AppleseedSwatchRenderer::defineMaterial(MObject shadingNode)
+void AppleseedSwatchRenderer::collectMaterial(ShadingNetwork& network, AppleseedSwatchJob& job)
 {
-	if (!mrenderer.get())
-		return;
-
-	MStatus status;
-	asf::StringArray materialNames;
 	MAYATO_OSLUTIL::OSLUtilClass oslClass;
-	//MAYATO_OSL::initOSLUtil();
-	MString shaderGroupName = "previewSG";
-	MString surfaceShader;
-	MObject surfaceShaderNode = shadingNode;
-	MString surfaceShaderName = getObjectName(surfaceShaderNode);
-	ShadingNetwork network(surfaceShaderNode);
+	// without a group the shaders and connections are only saved in the lists
+	oslClass.group = nullptr;
 	size_t numNodes = network.shaderList.size();
 
-	asr::Assembly *assembly = project->get_scene()->assemblies().get_by_name("sceneAssembly")->assemblies().get_by_name("world");
-	assert(assembly != nullptr);
-
-	asr::ShaderGroup *existingShaderGroup = assembly->shader_groups().get_by_name(shaderGroupName.asChar());
-	existingShaderGroup->clear();	
-	oslClass.group = (OSL::ShaderGroup *)existingShaderGroup;
-
 	//MPlug shaderPlug = shadingGroupNode.findPlug("surfaceShader");
 	//MAYATO_OSL::createOSLProjectionNodes(shaderPlug);
 
@@ -261,42 +175,83 @@ void AppleseedSwatchRenderer::defineMaterial(MObject shadingNode)
 		Logging::debug(MString("ShadingNode Id: ") + shadingNodeId + " ShadingNode name: " + snode.fullName);
 		if (shadingNodeId == (numNodes - 1))
 			Logging::debug(MString("LastNode Surface Shader: ") + snode.fullName);
-		//oslClass.createOSLHelperNodes(network.shaderList[shadingNodeId]);
 		oslClass.createOSLShadingNode(network.shaderList[shadingNodeId]);
 		oslClass.connectProjectionNodes(network.shaderList[shadingNodeId].mobject);
 	}
+	oslClass.cleanupShadingNodeList();
+	job.oslNodes = oslClass.oslNodeArray;
+	job.connections = oslClass.connectionList;
 	if (numNodes > 0)
+		job.surfaceShaderName = network.shaderList[numNodes - 1].fullName;
+}
+
+bool AppleseedSwatchRenderer::defineMaterial(AppleseedSwatchJob& job)
+{
+	if (!mrenderer.get())
+		return false;
+
+	asr::Assembly *assembly = project->get_scene()->assemblies().get_by_name("sceneAssembly")->assemblies().get_by_name("world");
+	assert(assembly != nullptr);
+
+	asr::ShaderGroup *existingShaderGroup = assembly->shader_groups().get_by_name("previewSG");
+	if (existingShaderGroup == nullptr)
+		return false;
+	existingShaderGroup->clear();
+
+	MAYATO_OSLUTIL::OSLUtilClass oslClass;
+	oslClass.group = (OSL::ShaderGroup *)existingShaderGroup;
+	oslClass.oslNodeArray = job.oslNodes;
+	oslClass.connectionList = job.connections;
+	oslClass.createAndConnectShaderNodes();
+
+	if (job.surfaceShaderName.length() > 0)
 	{
-		ShadingNode snode = network.shaderList[numNodes - 1];
-		MString layer = (snode.fullName + "_interface");
+		MString layer = (job.surfaceShaderName + "_interface");
 		Logging::debug(MString("Adding interface shader: ") + layer);
 		existingShaderGroup->add_shader("surface", "surfaceShaderInterface", layer.asChar(), asr::ParamArray());
-		const char *srcLayer = snode.fullName.asChar();
+		const char *srcLayer = job.surfaceShaderName.asChar();
 		const char *srcAttr = "outColor";
 		const char *dstLayer = layer.asChar();
 		const char *dstAttr = "inColor";
 		Logging::debug(MString("Connecting interface shader: ") + srcLayer + "." + srcAttr + " -> " + dstLayer + "." + dstAttr);
 		existingShaderGroup->add_connection(srcLayer, srcAttr, dstLayer, dstAttr);
 	}
+	return true;
 }
 
-void AppleseedSwatchRenderer::startAppleseedSwatchRender(AppleseedSwatchRenderer *swRend)
+// every renderer loads its own swatch project, two of them are enough to keep maya responsive,
+// appleseed uses several threads for every swatch anyway
+static const int NUM_SWATCH_RENDERERS = 2;
+static std::vector<AppleseedSwatchRenderer *> swatchRenderers;
+
+void AppleseedSwatchRenderer::startSwatchService()
 {
-	if (swRend != nullptr)
+	stopSwatchService();
+	for (int i = 0; i < NUM_SWATCH_RENDERERS; i++)
 	{
-		Logging::debug(MString("startAppleseedSwatchRender"));
-		swRend->mainLoop();
-		delete swRend;
-		Logging::debug(MString("appleseedSwatchRender done and deleted."));
+		AppleseedSwatchRenderer *swatchRenderer = new AppleseedSwatchRenderer();
+		if (swatchRenderer->mrenderer.get() == nullptr)
+		{
+			delete swatchRenderer;
+			break;
+		}
+		swatchRenderers.push_back(swatchRenderer);
+	}
+	if (swatchRenderers.size() == 0)
+	{
+		Logging::error("Unable to create an appleseed swatch renderer, swatches will not be rendered.");
+		return;
 	}
+	getSwatchService().start((int)swatchRenderers.size(), [](SwatchJob& job, int workerId)
+	{
+		return swatchRenderers[workerId]->renderSwatch(static_cast<AppleseedSwatchJob&>(job));
+	});
 }
 
-void AppleseedSwatchRenderer::terminateAppleseedSwatchRender(AppleseedSwatchRenderer *swRend)
+void AppleseedSwatchRenderer::stopSwatchService()
 {
-	Logging::debug(MString("terminateAppleseedSwatchRender"));
-	SQueue::SEvent swatchEvent;
-	SQueue::SwatchesQueue.push(swatchEvent);
-	swRend->terminateLoop = true;
-	while (!swRend->loopDone)
-		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	getSwatchService().stop();
+	for (auto swatchRenderer : swatchRenderers)
+		delete swatchRenderer;
+	swatchRenderers.clear();
 }
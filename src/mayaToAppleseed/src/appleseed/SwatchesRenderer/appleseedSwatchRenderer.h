@@ -7,37 +7,60 @@
 #include "renderer/api/rendering.h"
 
 #include <maya/MObject.h>
+#include <atomic>
+#include <vector>
+#include "swatchesRenderer/swatchService.h"
+#include "osl/oslUtils.h"
 
 namespace asf = foundation;
 namespace asr = renderer;
 
-class NewSwatchRenderer;
+class ShadingNetwork;
 
+// the osl shaders of the material are collected in the main thread, the worker only builds the shader group
+class AppleseedSwatchJob : public SwatchJob
+{
+public:
+	std::vector<MAYATO_OSL::OSLNodeStruct> oslNodes;
+	MAYATO_OSL::ConnectionArray connections;
+	MString surfaceShaderName;
+};
+
+// aborts the rendering if the swatch is not needed any more
+class SwatchRendererController : public asr::DefaultRendererController
+{
+public:
+	const std::atomic<bool> *cancelled = nullptr;
+	virtual Status get_status() const
+	{
+		if ((cancelled != nullptr) && *cancelled)
+			return AbortRendering;
+		return ContinueRendering;
+	}
+};
+
+// every worker thread of the swatch service has its own AppleseedSwatchRenderer with its own project
 class AppleseedSwatchRenderer
 {
 public:
 	AppleseedSwatchRenderer();
 	~AppleseedSwatchRenderer();
-	void mainLoop();
 	void setSize(int size);
-	void setShader(MObject shader);
-	void renderSwatch();
-	void renderSwatch(NewSwatchRenderer *sr);
+	bool renderSwatch(AppleseedSwatchJob& job);
 	void fillSwatch(float *pixels);
-	bool terminateLoop = false;
-	bool enableSwatchRenderer = true;
-	bool loopDone = false;
 	
 	asf::auto_release_ptr<asr::Scene> scene;
 	asf::auto_release_ptr<asr::Project> project;
 	std::auto_ptr<asf::ILogTarget> log_target;
 	std::auto_ptr<asr::MasterRenderer> mrenderer;
-	asr::DefaultRendererController renderer_controller;
+	SwatchRendererController renderer_controller;
 
-	static void startAppleseedSwatchRender(AppleseedSwatchRenderer *swRend);
-	static void terminateAppleseedSwatchRender(AppleseedSwatchRenderer *swRend);
+	static void startSwatchService();
+	static void stopSwatchService();
+	// has to be called from the main thread because it reads the maya nodes
+	static void collectMaterial(ShadingNetwork& network, AppleseedSwatchJob& job);
 
-	void defineMaterial(MObject shadingNode);
+	bool defineMaterial(AppleseedSwatchJob& job);
 
 };
 
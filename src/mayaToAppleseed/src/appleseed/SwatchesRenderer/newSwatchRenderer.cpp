@@ -1,7 +1,10 @@
 #include "swatchesRenderer/newSwatchRenderer.h"
-#include "swatchesRenderer/swatchesQueue.h"
-#include "SwatchesEvent.h"
+#include "swatchesRenderer/swatchService.h"
 #include <maya/MFnDependencyNode.h>
+#include <maya/MGlobal.h>
+#include <maya/MSelectionList.h>
+#include <string.h>
+#include "shadingTools/material.h"
 #include "utilities/logging.h"
 #include "utilities/tools.h"
 #include "world.h"
@@ -56,9 +59,13 @@ NewSwatchRenderer::NewSwatchRenderer(MObject dependNode, MObject renderNode, int
 NewSwatchRenderer::~NewSwatchRenderer()
 {
 	Logging::debug(MString("NewSwatchRenderer: will be deleted. swatchRenderingDoneAddress: ") + (int)&this->swatchRenderingDone);
+	// maya does not need the swatch any more
+	if (this->job)
+		this->job->cancel();
 	//free(floatPixels);
 }
 
+// the swatches are rendered by our own worker threads, maya only has to poll doIteration()
 bool NewSwatchRenderer::renderParallel()
 { 
 	return false; 
@@ -70,10 +77,14 @@ void NewSwatchRenderer::finishParallelRender()
 void NewSwatchRenderer::cancelParallelRendering()
 {
 	Logging::debug(MString("cancelParallelRendering called."));
+	if (this->job)
+		this->job->cancel();
 }
 void NewSwatchRenderer::cancelCurrentSwatchRender()
 {
 	Logging::debug(MString("cancelCurrentSwatchRender called."));
+	if (this->job)
+		this->job->cancel();
 }
 void NewSwatchRenderer::enableSwatchRender(bool enable)
 {
@@ -85,7 +96,25 @@ MSwatchRenderBase* NewSwatchRenderer::creator(MObject dependNode, MObject render
 	return new NewSwatchRenderer(dependNode, renderNode, imageResolution);
 }
 
-static int dummy = 0;
+// a selected node is shown in the attribute editor and highlighted in the hypershade, so its swatch is visible
+static bool isVisibleSwatch(const MObject& node)
+{
+	MSelectionList selectionList;
+	MGlobal::getActiveSelectionList(selectionList);
+	return selectionList.hasItem(node);
+}
+
+// copies the rgba float pixels into the swatch image, without pixels the swatch is black
+static void setSwatchImage(MImage& image, int res, const std::vector<float> *pixels)
+{
+	image.create(res, res, 4, MImage::kFloat);
+	size_t numValues = (size_t)res * res * 4;
+	if ((pixels != nullptr) && (pixels->size() == numValues))
+		memcpy(image.floatPixels(), &(*pixels)[0], numValues * sizeof(float));
+	else
+		memset(image.floatPixels(), 0, numValues * sizeof(float));
+	image.convertPixelFormat(MImage::kByte);
+}
 
 bool NewSwatchRenderer::doIteration()
 {
@@ -93,37 +122,48 @@ bool NewSwatchRenderer::doIteration()
 	Logging::setLogLevel(Logging::Debug);
 #endif
 
-	//if (swatchRenderingDone)
-	//{
-	//	Logging::debug(MString("NewSwatchRenderer: doIteration -> swatchRenderingDone. swatchRenderingDoneAddress: ") + (int)&this->swatchRenderingDone);
-	//}
-	//else
-	//	Logging::debug(MString("NewSwatchRenderer: doIteration -> swatchRendering NOT Done"));
-
-	if (MayaTo::getWorldPtr()->getRenderType() == MayaTo::MayaToWorld::IPRRENDER)
+	SwatchService& swatchService = getSwatchService();
+	if (!swatchService.isRunning())
 	{
-		image().create(resolution(), resolution(), 4, MImage::kFloat);
-		image().convertPixelFormat(MImage::kByte);
+		setSwatchImage(image(), resolution(), nullptr);
 		return true;
 	}
 
-
-	//return swatchRenderingDone;
-	AppleseedSwatchRenderer * appleSwRndr = (AppleseedSwatchRenderer *)MayaTo::getObjPtr("appleseedSwatchesRenderer");
-	if (appleSwRndr)
+	// first call: use the cached image if the material did not change, otherwise create a render job
+	if (!this->job)
 	{
-		if (appleSwRndr->mrenderer.get() != nullptr)
+		ShadingNetwork network(dNode);
+		unsigned long long networkHash = network.shaderList.empty() ? NO_SWATCH_HASH : network.getHash();
+		std::vector<float> pixels;
+		if (swatchService.getCachedImage(networkHash, resolution(), pixels))
 		{
-			appleSwRndr->renderSwatch(this);
-			image().convertPixelFormat(MImage::kByte);
+			setSwatchImage(image(), resolution(), &pixels);
+			return true;
 		}
-		else{
-			image().create(resolution(), resolution(), 4, MImage::kFloat);
-			image().convertPixelFormat(MImage::kByte);
-		}
-		return true;
+		std::shared_ptr<AppleseedSwatchJob> swatchJob(new AppleseedSwatchJob);
+		swatchJob->nodeName = getObjectName(dNode);
+		swatchJob->networkHash = networkHash;
+		swatchJob->resolution = resolution();
+		if (isVisibleSwatch(dNode))
+			swatchJob->priority = SwatchJob::VISIBLE;
+		AppleseedSwatchRenderer::collectMaterial(network, *swatchJob);
+		this->job = swatchJob;
+		swatchService.submit(swatchJob);
+		return false;
 	}
 
+	if (!this->job->isFinished())
+	{
+		// the node may have been selected while the job was waiting
+		if ((this->job->state == SwatchJob::QUEUED) && (this->job->priority == SwatchJob::BACKGROUND) && isVisibleSwatch(dNode))
+			swatchService.raisePriority(this->job);
+		return false;
+	}
 
-	return false;
-}
\ No newline at end of file
+	if (this->job->state == SwatchJob::DONE)
+		setSwatchImage(image(), resolution(), &this->job->pixels);
+	else
+		setSwatchImage(image(), resolution(), nullptr);
+	this->job.reset();
+	return true;
+}
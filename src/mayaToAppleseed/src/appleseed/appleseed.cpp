@@ -28,6 +28,7 @@
 #include "utilities/attrTools.h"
 #include "threads/threads.h"
 #include "threads/queue.h"
+#include "threads/cancelToken.h"
 #include "utilities/pystring.h"
 #include "mayaScene.h"
 #include "renderGlobals.h"
@@ -38,7 +39,11 @@
 #include <iostream>
 
 #include "utilities/logging.h"
+#include "osl/oslShaderGroupCache.h"
+#include "osl/oslTextureOptimizer.h"
+#include "memory/memoryInfo.h"
 #include "appleseedUtils.h"
+#include "utilities/tracing.h"
 
 static int tileCount = 0;
 static int tileCountTotal = 0;
@@ -47,7 +52,7 @@ using namespace AppleRender;
 
 std::vector<asr::Entity *> definedEntities;
 
-AppleseedRenderer::AppleseedRenderer()
+AppleseedRenderer::AppleseedRenderer() : renderRegionChanged(false)
 {
 	asr::global_logger().set_format(asf::LogMessage::Debug, "");
 	log_target = std::auto_ptr<asf::ILogTarget>(asf::create_console_log_target(stdout));
@@ -67,16 +72,30 @@ void AppleseedRenderer::initializeRenderer()
 {
 	//RENDERER_LOG_INFO("%s", asf::Appleseed::get_synthetic_version_string());
 	//definedEntities.clear();
+	createProject();
+	std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;
+	if (renderGlobals->useOptimizedTextures)
+		MAYATO_OSL::getTextureOptimizer().prepare(renderGlobals->optimizedTexturePath);
+}
+
+void AppleseedRenderer::createProject()
+{
 	this->project = asr::ProjectFactory::create("mtap_project");
 
 	std::string oslShaderPath = (getRendererHome() + "shaders").asChar();
 	Logging::debug(MString("setting osl shader search path to: ") + oslShaderPath.c_str());
 	project->search_paths().push_back(oslShaderPath.c_str());
+	std::vector<std::string> shaderSearchPaths;
+	shaderSearchPaths.push_back(oslShaderPath);
 	for (uint i = 0; i < MayaTo::getWorldPtr()->shaderSearchPath.length(); i++)
 	{
 		Logging::debug(MString("Search path: ") + MayaTo::getWorldPtr()->shaderSearchPath[i]);
 		project->search_paths().push_back(MayaTo::getWorldPtr()->shaderSearchPath[i].asChar());
+		shaderSearchPaths.push_back(MayaTo::getWorldPtr()->shaderSearchPath[i].asChar());
 	}
+	// a new project has no shader groups
+	MAYATO_OSL::getShaderGroupCache().clear();
+	MAYATO_OSL::getShaderGroupCache().setShaderSearchPaths(shaderSearchPaths);
 	defineConfig();
 
 	defineScene(this->project.get());
@@ -94,11 +113,14 @@ void AppleseedRenderer::unInitializeRenderer()
 
 	Logging::debug("Releasing project");
 	this->project.release();
+	MAYATO_OSL::getShaderGroupCache().clear();
+	MAYATO_OSL::getTextureOptimizer().clear();
 	Logging::debug("Releasing done.");
 }
 
 void AppleseedRenderer::defineProject()
 {
+	TRACE_ZONE("AppleseedRenderer::defineProject");
 	defineCamera(); // first camera
 	defineOutput(); // output accesses camera so define it after camera 
 	defineEnvironment();
@@ -111,7 +133,11 @@ void AppleseedRenderer::render()
 	Logging::debug("AppleseedRenderer::render");
 	if (!sceneBuilt)
 	{
+		setMemoryPhase(MEMPHASE_TRANSLATE);
 		defineProject();
+		// an incomplete project is not rendered, it is defined again with the next rendering
+		if (MayaTo::isRenderCancelled())
+			return;
 
 		RENDERER_LOG_INFO("%s", asf::Appleseed::get_synthetic_version_string());
 
@@ -146,11 +172,37 @@ void AppleseedRenderer::render()
 		sceneBuilt = true;
 	}
 
+	setMemoryPhase(MEMPHASE_RENDER);
 	MayaTo::getWorldPtr()->setRenderState(MayaTo::MayaToWorld::RSTATERENDERING);
+	if (MayaTo::getWorldPtr()->getRenderType() == MayaTo::MayaToWorld::WorldRenderType::IPRRENDER)
+		mtap_controller.entityUpdateProc = AppleseedRenderer::applyIprUpdates;
+	else
+		mtap_controller.entityUpdateProc = nullptr;
 	mtap_controller.status = asr::IRendererController::ContinueRendering;
 	masterRenderer->render();
 }
 
+bool AppleseedRenderer::exportSceneFile(const MString& sceneFile)
+{
+	// every frame is a complete project of its own, the previous one is already on disk
+	if (sceneBuilt)
+		createProject();
+	setMemoryPhase(MEMPHASE_TRANSLATE);
+	defineProject();
+	sceneBuilt = true;
+	if (MayaTo::isRenderCancelled())
+		return false;
+	TRACE_ZONE("ProjectFileWriter::write");
+	// the writer saves the meshes as files next to the project
+	return asr::ProjectFileWriter::write(this->project.ref(), sceneFile.asChar());
+}
+
+MString AppleseedRenderer::getSceneFileRenderCommand(const MString& sceneFile, const MString& imageFile)
+{
+	// appleseed.cli has to be in the PATH
+	return MString("appleseed.cli --message-verbosity warning --output \"") + imageFile + "\" \"" + sceneFile + "\"";
+}
+
 void AppleseedRenderer::abortRendering()
 {
 	Logging::debug(MString("abortRendering"));
@@ -29,6 +29,7 @@
 #include "foundation/utility/searchpaths.h"
 
 // Standard headers.
+#include <atomic>
 #include <cstddef>
 #include <cstdio>
 #include <memory>
@@ -102,18 +103,32 @@ public:
 	virtual void abortRendering();
 	virtual void interactiveFbCallback(){};
 	virtual void doInteractiveUpdate();
+	virtual bool canUpdateWhileRendering(int maxUpdateCost);
+	virtual void requestLiveUpdate();
+	virtual bool updateRenderRegion();
+	virtual bool canRenderSceneFile(){ return true; }
+	virtual MString getSceneFileExtension(){ return "appleseed"; }
+	virtual bool exportSceneFile(const MString& sceneFile);
+	virtual MString getSceneFileRenderCommand(const MString& sceneFile, const MString& imageFile);
 	virtual void handleUserEvent(int event, MString strData, float floatData, int intData){};
 
 	asf::auto_release_ptr<asr::MeshObject> defineStandardPlane();
 	void defineProject();
+	// a new empty project with the render settings, called for every frame of a pipelined sequence
+	void createProject();
 	void addRenderParams(asr::ParamArray& paramArray);//add current render settings to all render configurations 
 	void defineConfig();
+	// the render region as crop window, the whole image if no region is used
+	void defineCropWindow(asr::ParamArray& params);
 	void defineOutput();
 	void createMesh(std::shared_ptr<MayaObject> obj, asr::MeshObjectArray& meshArray, bool& isProxyArray);
 	void createMesh(std::shared_ptr<mtap_MayaObject> obj);
+	void placeMesh(std::shared_ptr<mtap_MayaObject> obj, asf::auto_release_ptr<asr::MeshObject> mesh);
 	asr::Project *getProjectPtr(){ return this->project.get(); };
 	asf::StringArray defineMaterial(std::shared_ptr<mtap_MayaObject> obj);
 	void updateMaterial(MObject sufaceShader);
+	// called by the controller at the end of an ipr frame, before the master renderer starts again
+	static void applyIprUpdates();
 
 private:
 	asf::auto_release_ptr<asr::Project> project;
@@ -122,6 +137,8 @@ private:
 	asf::auto_release_ptr<mtap_ITileCallbackFactory> tileCallbackFac;
 	mtap_IRendererController mtap_controller;
 	bool sceneBuilt = false;
+	// ipr: the crop window is replaced with the next frame, the scene is kept
+	std::atomic<bool> renderRegionChanged;
 };
 
 } // namespace AppleRender
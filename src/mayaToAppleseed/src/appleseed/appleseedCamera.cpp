@@ -6,6 +6,7 @@
 #include "mayaScene.h"
 #include <maya/MFnCamera.h>
 #include "world.h"
+#include "utilities/tracing.h"
 
 using namespace AppleRender;
 //
@@ -85,6 +86,7 @@ void AppleseedRenderer::defineCamera(std::shared_ptr<MayaObject> cam)
 
 void AppleseedRenderer::defineCamera()
 {
+	TRACE_ZONE("AppleseedRenderer::defineCamera");
 	MStatus stat;
 	std::shared_ptr<MayaScene> mayaScene = MayaTo::getWorldPtr()->worldScenePtr;
 	std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;
@@ -66,6 +66,22 @@ void AppleseedRenderer::addRenderParams(asr::ParamArray& paramArray)
 
 }
 
+// the render view region starts at the bottom left, the appleseed crop window at the top left, both include the last pixel
+void AppleseedRenderer::defineCropWindow(asr::ParamArray& params)
+{
+	std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;
+	int imgWidth, imgHeight;
+	renderGlobals->getWidthHeight(imgWidth, imgHeight);
+	int left = 0, bottom = 0, right = imgWidth - 1, top = imgHeight - 1;
+	if (renderGlobals->getUseRenderRegion())
+		renderGlobals->getRenderRegion(left, bottom, right, top);
+	int ymin = imgHeight - 1 - top;
+	int ymax = imgHeight - 1 - bottom;
+	MString regionString = MString("") + left + " " + ymin + " " + right + " " + ymax;
+	Logging::debug("Render region is turned on rendering: " + regionString);
+	params.insert_path("generic_tile_renderer.crop_window", regionString.asChar());
+}
+
 void AppleseedRenderer::defineConfig()
 {
 	Logging::debug("AppleseedRenderer::defineConfig");
@@ -93,19 +109,8 @@ void AppleseedRenderer::defineConfig()
 
 	if( renderGlobals->getUseRenderRegion() )
 	{
-		int left, right, bottom, top;
-		int imgWidth, imgHeight;
-		renderGlobals->getWidthHeight(imgWidth, imgHeight);
-		renderGlobals->getRenderRegion(left, bottom, right, top);
-		int ybot = (imgHeight - bottom);
-		int ytop = (imgHeight - top);
-		int ymin = ybot <  ytop ? ybot :  ytop;
-		int ymax = ybot >  ytop ? ybot :  ytop;
-		MString regionString = MString("") + left + " " + ymin + " " + right + " " + ymax;
-		Logging::debug("Render region is turned on rendering: " + regionString);
-		this->project->configurations()
-        .get_by_name("final")->get_parameters()
-		.insert_path("generic_tile_renderer.crop_window", regionString.asChar());
+		defineCropWindow(this->project->configurations().get_by_name("final")->get_parameters());
+		defineCropWindow(this->project->configurations().get_by_name("interactive")->get_parameters());
 	}
 
 	//if( !renderGlobals->enable_caustics )
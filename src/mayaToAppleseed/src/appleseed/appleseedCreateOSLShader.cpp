@@ -54,6 +54,13 @@ MString oslTypeToMString(MAYATO_OSL::OSLParameter param)
 
 void MAYATO_OSLUTIL::OSLUtilClass::connectOSLShaders(MAYATO_OSL::ConnectionArray& ca)
 {
+	// without a group the nodes are only collected, so the connections are made in createAndConnectShaderNodes()
+	if (group == nullptr)
+	{
+		for (auto connection : ca)
+			addConnectionToList(connection);
+		return;
+	}
 	for (auto connection : ca)
 	{
 		const char *srcLayer = connection.sourceNode.asChar();
@@ -62,7 +69,7 @@ void MAYATO_OSLUTIL::OSLUtilClass::connectOSLShaders(MAYATO_OSL::ConnectionArray
 		MString destAttr = connection.destAttribute;
 		if (destAttr == "color")
 			destAttr = "inColor";
-		Logging::debug(MString("MAYATO_OSL::connectOSLShaders ") + srcLayer + "." + srcAttr + " -> " + destLayer + "." + destAttr);
+		LOG_DEBUG(MString("MAYATO_OSL::connectOSLShaders ") + srcLayer + "." + srcAttr + " -> " + destLayer + "." + destAttr);
 		OSL::ShaderGroup *g = group;
 		asr::ShaderGroup *ag = (asr::ShaderGroup *)g;
 		ag->add_connection(srcLayer, srcAttr, destLayer, destAttr.asChar());
@@ -71,7 +78,7 @@ void MAYATO_OSLUTIL::OSLUtilClass::connectOSLShaders(MAYATO_OSL::ConnectionArray
 
 void MAYATO_OSLUTIL::OSLUtilClass::createOSLShader(MString& shaderNodeType, MString& shaderName, MAYATO_OSL::OSLParamArray& paramArray)
 {
-	Logging::debug(MString("MAYATO_OSL::createOSLShader ") + shaderName);
+	LOG_DEBUG(MString("MAYATO_OSL::createOSLShader ") + shaderName);
 	asr::ParamArray asParamArray;
 	for (auto param : paramArray)
 	{
@@ -82,7 +89,7 @@ void MAYATO_OSLUTIL::OSLUtilClass::createOSLShader(MString& shaderNodeType, MStr
 
 		MString paramString = oslTypeToMString(param);
 		asParamArray.insert(pname.asChar(), paramString);
-		Logging::debug(MString("\tParam ") + param.name + " " + paramString);
+		LOG_DEBUG(MString("\tParam ") + param.name + " " + paramString);
 	}
 
 	Logging::debug(MString("MAYATO_OSL::createOSLShader creating shader node "));
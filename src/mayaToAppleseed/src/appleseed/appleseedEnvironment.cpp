@@ -18,6 +18,7 @@
 #include "utilities/logging.h"
 #include "mayaScene.h"
 #include "world.h"
+#include "utilities/tracing.h"
 
 static Logging logger;
 
@@ -26,6 +27,7 @@ using namespace AppleRender;
 
 void AppleseedRenderer::defineEnvironment()
 {
+	TRACE_ZONE("AppleseedRenderer::defineEnvironment");
 	asr::Scene *scene = project->get_scene();
 	// Create a color called "sky_radiance" and insert it into the scene.
 	//static const float SkyRadiance[] = { 0.75f, 0.80f, 1.0f };
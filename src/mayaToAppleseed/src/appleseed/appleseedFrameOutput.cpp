@@ -1,5 +1,6 @@
 #include "appleseed.h"
 #include "renderGlobals.h"
+#include "renderGlobalsSnapshot.h"
 #include "utilities/logging.h"
 #include "utilities/attrTools.h"
 #include "world.h"
@@ -8,13 +9,13 @@ using namespace AppleRender;
 
 void AppleseedRenderer::defineOutput()
 {
-	MFnDependencyNode depFn(getRenderGlobalsNode());
+	RenderGlobalsSnapshotPtr globals = getRenderGlobalsSnapshot();
 	std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;
 	Logging::debug("AppleseedRenderer::defineOutput");
 	int width, height;
 	renderGlobals->getWidthHeight(width, height);
 	MString res = MString("") + width + " " + height;
-	MString colorSpaceString = getEnumString("colorSpace", depFn);
+	MString colorSpaceString = globals->getEnumString("colorSpace", "linear_rgb");
 	MString tileSize =  MString("") + renderGlobals->tilesize + " " + renderGlobals->tilesize;
 	
     project->set_frame( 
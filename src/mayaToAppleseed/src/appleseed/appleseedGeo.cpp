@@ -12,9 +12,14 @@
 #include "utilities/attrTools.h"
 #include "utilities/logging.h"
 #include "appleseedUtils.h"
+#include "appleseedGeometry.h"
 #include "world.h"
+#include "threads/parallelFor.h"
 
 #include "renderer/modeling/object/meshobjectreader.h"
+#include "utilities/tracing.h"
+#include "threads/cancelToken.h"
+#include "utilities/sceneStatistics.h"
 using namespace AppleRender;
 
 #define MTAP_MESH_STANDIN_ID 0x0011CF7B
@@ -74,86 +79,28 @@ void AppleseedRenderer::createMesh(std::shared_ptr<mtap_MayaObject> obj)
 	// The other way is to have a standInMeshNode which is connected to the inMesh of the mesh node.
 	// In this case, get the standin node, read the path of the binmesh file and load it.
 
-	MStatus stat = MStatus::kSuccess;
-	MFnMesh meshFn(obj->mobject, &stat);
-	CHECK_MSTATUS(stat);
-
-	//isProxyArray = false;
-
-	MPointArray points;
-	MFloatVectorArray normals;
-	MFloatArray uArray, vArray;
-	MIntArray triPointIds, triNormalIds, triUvIds, triMatIds;
-	Logging::debug("defineMesh pre getMeshData");
-	obj->getMeshData(points, normals, uArray, vArray, triPointIds, triNormalIds, triUvIds, triMatIds);
-
-	Logging::debug(MString("Translating mesh object ") + meshFn.name().asChar());
-	MString meshFullName = makeGoodString(meshFn.fullPathName());
-    // Create a new mesh object.
-	asf::auto_release_ptr<asr::MeshObject> mesh = asr::MeshObjectFactory::create(meshFullName.asChar(), asr::ParamArray());
-
-	Logging::debug(MString("//object ") + meshFn.name());
-	//Logging::debug(MString("MPointArray ") + obj->shortName + "Vertices(" + points.length() + ");");
-	for (uint vtxId = 0; vtxId < points.length(); vtxId++)
-	{
-		mesh->push_vertex(MPointToAppleseed(points[vtxId]));		
-		//Logging::debug(obj->shortName + "Vertices.append(MPoint(" + points[vtxId].x + "," + points[vtxId].y + "," + points[vtxId].z + "));");
-	}
-	
-	//Logging::debug(MString("MVectorArray ") + obj->shortName + "Normals(" + normals.length() + ");");
-	for (uint nId = 0; nId < normals.length(); nId++)
-	{
-		MVector n = normals[nId];
-		MStatus s = n.normalize();
-		if (n.length() < .3)
-			n.y = .1;
-		n.normalize();
-		mesh->push_vertex_normal(MPointToAppleseed(n));
-		//Logging::debug(obj->shortName + "Normals.append(MVector(" + normals[nId].x + "," + normals[nId].y + "," + normals[nId].z + "));");
-	}
-
-	//Logging::debug(MString("MFloatArray") + obj->shortName + "u(" + uArray.length() + ");");
-	//Logging::debug(MString("MFloatArray") + obj->shortName + "v(" + uArray.length() + ");");
-	for (uint tId = 0; tId < uArray.length(); tId++)
-	{		
-		mesh->push_tex_coords(asr::GVector2((float)uArray[tId], (float)vArray[tId]));
-		//Logging::debug(obj->shortName + "u.append(" + uArray[tId] + ");");
-		//Logging::debug(obj->shortName + "v.append(" + vArray[tId] + "); ");
-	}
-
-	mesh->reserve_material_slots(obj->shadingGroups.length());
-	for( uint sgId = 0; sgId < obj->shadingGroups.length(); sgId++)
-	{
-		MString slotName = MString("slot_") + sgId;
-		mesh->push_material_slot(slotName.asChar());
-	}
-
-	int numTris = triPointIds.length() / 3;
-
-	//Logging::debug(MString("//MIntArray triData(vtxId0, vtxId1, vtxId2,  normalId0, normalId1, normalId2, uvId0, uvId1, uvId2, perFaceShadingGroup"));
-	//Logging::debug(MString("int ") + obj->shortName + "triData[] = {");
-	for (uint triId = 0; triId < numTris; triId++)
+	MeshExtract extract;
+	Logging::debug("defineMesh pre extractMeshBuffers");
+	if (!extractMeshBuffers(obj->mobject, obj->perFaceAssignments, extract))
 	{
-		uint index = triId * 3;
-		int perFaceShadingGroup = triMatIds[triId];
-		int vtxId0 = triPointIds[index];
-		int vtxId1 = triPointIds[index + 1];
-		int vtxId2 = triPointIds[index + 2];
-		int normalId0 = triNormalIds[index];
-		int normalId1 = triNormalIds[index + 1];
-		int normalId2 = triNormalIds[index + 2];
-		int uvId0 = triUvIds[index];
-		int uvId1 = triUvIds[index + 1];
-		int uvId2 = triUvIds[index + 2];
-		mesh->push_triangle(asr::Triangle(vtxId0, vtxId1, vtxId2,  normalId0, normalId1, normalId2, uvId0, uvId1, uvId2, perFaceShadingGroup));
-		//Logging::debug(MString("") + vtxId0 + "," + vtxId1 + "," + vtxId2 + "," + normalId0 + "," + normalId1 + "," + normalId2 + "," + uvId0 + "," + uvId1 + "," + uvId2 + "," + perFaceShadingGroup + ",");
+		Logging::error(MString("Unable to read mesh data from ") + obj->shortName);
+		return;
 	}
-	//Logging::debug(MString("};\n\n\n\n-------------------------------------------------------------"));
+	extract.name = makeGoodString(MString(extract.name.c_str())).asChar();
+	triangulateMeshExtract(extract);
+	LOG_DEBUG(MString("Translating mesh object ") + obj->shortName);
+	placeMesh(obj, MTAP_GEOMETRY::createMesh(extract, obj->shadingGroups.length(), obj->meshDataList));
+	obj->meshDataList.clear();
+}
 
+// places an already created mesh into the object assembly and creates the object instance
+void AppleseedRenderer::placeMesh(std::shared_ptr<mtap_MayaObject> obj, asf::auto_release_ptr<asr::MeshObject> mesh)
+{
+	MString meshFullName = mesh->get_name();
 	MayaObject *assemblyObject = getAssemblyMayaObject(obj.get());
 	asr::Assembly *ass = getCreateObjectAssembly(obj);
 
-	Logging::debug(MString("Placing mesh ") + mesh->get_name() + " into assembly " + ass->get_name());
+	LOG_DEBUG(MString("Placing mesh ") + mesh->get_name() + " into assembly " + ass->get_name());
 	ass->objects().insert(asf::auto_release_ptr<asr::Object>(mesh));
 	asr::MeshObject *meshPtr = (asr::MeshObject *)ass->objects().get_by_name(meshFullName.asChar());
 
@@ -183,8 +130,11 @@ void AppleseedRenderer::createMesh(std::shared_ptr<mtap_MayaObject> obj)
 
 void AppleseedRenderer::defineGeometry()
 {
+	TRACE_ZONE("AppleseedRenderer::defineGeometry");
 	std::shared_ptr<MayaScene> mayaScene = MayaTo::getWorldPtr()->worldScenePtr;
 	std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;
+	// Phase one: Maya is not thread safe, so all mesh data is read on the main thread into plain buffers.
+	std::vector<std::shared_ptr<mtap_MayaObject>> meshObjects;
 	for (auto mobj : mayaScene->objectList)
 	{
 		std::shared_ptr<mtap_MayaObject> obj = std::static_pointer_cast<mtap_MayaObject>(mobj);
@@ -195,8 +145,68 @@ void AppleseedRenderer::defineGeometry()
 		if (mobj->instanceNumber > 0)
 			continue;
 
-		createMesh(obj);
-		defineMaterial(obj);
+		meshObjects.push_back(obj);
+	}
+
+	std::vector<MeshExtract> extracts(meshObjects.size());
+	for (size_t i = 0; i < meshObjects.size(); i++)
+	{
+		if (MayaTo::isRenderCancelled())
+			return;
+		TRACE_ZONE_DETAIL("extractMeshBuffers", meshObjects[i]->shortName);
+		MayaTo::StatisticsTimer extractionTimer;
+		if (!extractMeshBuffers(meshObjects[i]->mobject, meshObjects[i]->perFaceAssignments, extracts[i]))
+			Logging::error(MString("Unable to read mesh data from ") + meshObjects[i]->shortName);
+		extracts[i].name = makeGoodString(MString(extracts[i].name.c_str())).asChar();
+		MayaTo::getSceneStatistics().addExtractionTime(meshObjects[i]->fullName, extractionTimer.getSeconds());
+	}
+
+	// Phase two: triangulation and appleseed mesh creation are independent per object and run in parallel.
+	// The meshes are not yet part of the project, so no locking is needed. The deformation samples were
+	// collected in updateShape() during the motion steps and are only read here.
+	Logging::debug(MString("Translating ") + (int)meshObjects.size() + " meshes in parallel.");
+	std::vector<asr::MeshObject *> meshes(meshObjects.size(), nullptr);
+	std::vector<int> numSlots(meshObjects.size());
+	for (size_t i = 0; i < meshObjects.size(); i++)
+		numSlots[i] = meshObjects[i]->shadingGroups.length();
+	// the statistics are collected per element and reported afterwards, the workers only write their own entry
+	std::vector<MayaTo::ObjectStatistics> meshStatistics(meshObjects.size());
+	MayaTo::parallelFor(meshObjects.size(), [&](size_t i)
+	{
+		if (!extracts[i].valid)
+			return;
+		TRACE_ZONE_DETAIL("triangulateMesh", extracts[i].name);
+		MayaTo::StatisticsTimer exportTimer;
+		triangulateMeshExtract(extracts[i]);
+		meshes[i] = MTAP_GEOMETRY::createMesh(extracts[i], numSlots[i], meshObjects[i]->meshDataList).release();
+		meshStatistics[i].vertices = extracts[i].points.size() / 3;
+		meshStatistics[i].triangles = extracts[i].triPointIds.size() / 3;
+		meshStatistics[i].bytes = (extracts[i].points.size() / 3 + extracts[i].normals.size() / 3) * sizeof(asr::GVector3) + extracts[i].u.size() * sizeof(asr::GVector2) + meshStatistics[i].triangles * sizeof(asr::Triangle);
+		meshStatistics[i].exportSeconds = exportTimer.getSeconds();
+		// free the buffers as early as possible
+		extracts[i] = MeshExtract();
+	}, renderGlobals->threads);
+
+	// parallelFor stops early if the rendering was cancelled, the meshes which were already created are not needed anymore
+	if (MayaTo::isRenderCancelled())
+	{
+		for (asr::MeshObject *mesh : meshes)
+		{
+			if (mesh != nullptr)
+				mesh->release();
+		}
+		return;
+	}
+
+	// Merge the results into the assemblies, this modifies the project and is done sequentially.
+	for (size_t i = 0; i < meshObjects.size(); i++)
+	{
+		if (meshes[i] == nullptr)
+			continue;
+		MayaTo::getSceneStatistics().addMeshExport(meshObjects[i]->fullName, meshStatistics[i].vertices, meshStatistics[i].triangles, meshStatistics[i].bytes, meshStatistics[i].exportSeconds);
+		placeMesh(meshObjects[i], asf::auto_release_ptr<asr::MeshObject>(meshes[i]));
+		defineMaterial(meshObjects[i]);
+		meshObjects[i]->meshDataList.clear();
 	}
 
 	// create assembly instances
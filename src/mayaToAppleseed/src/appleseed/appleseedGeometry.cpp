@@ -6,6 +6,8 @@
 #include <maya/MFloatPointArray.h>
 #include <maya/MFloatArray.h>
 #include <maya/MFloatVectorArray.h>
+#include <maya/MVector.h>
+#include <string>
 
 #include "utilities/tools.h"
 #include "utilities/attrTools.h"
@@ -19,6 +21,17 @@ namespace asr = renderer;
 #define MPointToAppleseed(pt) asr::GVector3((float)pt.x, (float)pt.y, (float)pt.z)
 namespace MTAP_GEOMETRY{
 
+	// appleseed needs valid normals, zero length normals are replaced by an upward facing one
+	asr::GVector3 cleanNormal(float x, float y, float z)
+	{
+		MVector n(x, y, z);
+		n.normalize();
+		if (n.length() < .3)
+			n.y = .1;
+		n.normalize();
+		return MPointToAppleseed(n);
+	}
+
 	asf::auto_release_ptr<asr::MeshObject> defineStandardPlane()
 	{
 		asf::auto_release_ptr<asr::MeshObject> object(asr::MeshObjectFactory::create("standardPlane", asr::ParamArray()));
@@ -57,7 +70,7 @@ namespace MTAP_GEOMETRY{
 		MIntArray triPointIds, triNormalIds, triUvIds, triMatIds, perFaceAssignments;
 		getMeshData(mobject, points, normals, uArray, vArray, triPointIds, triNormalIds, triUvIds, triMatIds, perFaceAssignments);
 
-		Logging::debug(MString("Translating mesh object ") + meshFn.name().asChar());
+		LOG_DEBUG(MString("Translating mesh object ") + meshFn.name().asChar());
 		MString meshFullName = makeGoodString(meshFn.fullPathName());
 		asf::auto_release_ptr<asr::MeshObject> mesh = asr::MeshObjectFactory::create(meshFullName.asChar(), asr::ParamArray());
 
@@ -104,4 +117,95 @@ namespace MTAP_GEOMETRY{
 
 		return mesh;
 	}
+
+	// Creates the appleseed mesh from already extracted and triangulated data.
+	// No Maya API calls are allowed here because it is called from worker threads.
+	asf::auto_release_ptr<asr::MeshObject> createMesh(const MeshExtract& extract, int numMaterialSlots, const std::vector<MeshData>& motionSteps)
+	{
+		asf::auto_release_ptr<asr::MeshObject> mesh = asr::MeshObjectFactory::create(extract.name.c_str(), asr::ParamArray());
+
+		size_t numPoints = extract.points.size() / 3;
+		size_t numNormals = extract.normals.size() / 3;
+
+		// the samples are only usable if the topology did not change between the motion steps
+		size_t numSteps = motionSteps.size();
+		for (size_t step = 0; step < numSteps; step++)
+		{
+			if ((motionSteps[step].points.length() != numPoints) || (motionSteps[step].normals.length() != numNormals))
+			{
+				Logging::warning(MString("Mesh ") + extract.name.c_str() + " changes its topology during the motion steps, no deformation blur.");
+				numSteps = 0;
+				break;
+			}
+		}
+
+		// the first sample is the start of the shutter, it is used for the vertices, the others become motion poses
+		mesh->reserve_vertices(numPoints);
+		for (size_t vtxId = 0; vtxId < numPoints; vtxId++)
+		{
+			if (numSteps > 0)
+			{
+				mesh->push_vertex(MPointToAppleseed(motionSteps[0].points[(uint)vtxId]));
+				continue;
+			}
+			const float *p = &extract.points[vtxId * 3];
+			mesh->push_vertex(asr::GVector3(p[0], p[1], p[2]));
+		}
+
+		mesh->reserve_vertex_normals(numNormals);
+		for (size_t nId = 0; nId < numNormals; nId++)
+		{
+			if (numSteps > 0)
+			{
+				const MFloatVector& n = motionSteps[0].normals[(uint)nId];
+				mesh->push_vertex_normal(cleanNormal(n.x, n.y, n.z));
+				continue;
+			}
+			const float *np = &extract.normals[nId * 3];
+			mesh->push_vertex_normal(cleanNormal(np[0], np[1], np[2]));
+		}
+
+		if (numSteps > 1)
+		{
+			mesh->set_motion_segment_count(numSteps - 1);
+			for (size_t step = 1; step < numSteps; step++)
+			{
+				const MeshData& md = motionSteps[step];
+				for (size_t vtxId = 0; vtxId < numPoints; vtxId++)
+					mesh->set_vertex_pose(vtxId, step - 1, MPointToAppleseed(md.points[(uint)vtxId]));
+				for (size_t nId = 0; nId < numNormals; nId++)
+				{
+					const MFloatVector& n = md.normals[(uint)nId];
+					mesh->set_vertex_normal_pose(nId, step - 1, cleanNormal(n.x, n.y, n.z));
+				}
+			}
+		}
+
+		mesh->reserve_tex_coords(extract.u.size());
+		for (size_t tId = 0; tId < extract.u.size(); tId++)
+		{
+			mesh->push_tex_coords(asr::GVector2(extract.u[tId], extract.v[tId]));
+		}
+
+		mesh->reserve_material_slots(numMaterialSlots);
+		for (int sgId = 0; sgId < numMaterialSlots; sgId++)
+		{
+			std::string slotName = std::string("slot_") + std::to_string(sgId);
+			mesh->push_material_slot(slotName.c_str());
+		}
+
+		size_t numTris = extract.triPointIds.size() / 3;
+		mesh->reserve_triangles(numTris);
+		for (size_t triId = 0; triId < numTris; triId++)
+		{
+			size_t index = triId * 3;
+			mesh->push_triangle(asr::Triangle(
+				extract.triPointIds[index], extract.triPointIds[index + 1], extract.triPointIds[index + 2],
+				extract.triNormalIds[index], extract.triNormalIds[index + 1], extract.triNormalIds[index + 2],
+				extract.triUvIds[index], extract.triUvIds[index + 1], extract.triUvIds[index + 2],
+				extract.triMatIds[triId]));
+		}
+
+		return mesh;
+	}
 } //MTAP_GEOMETRY namespace
\ No newline at end of file
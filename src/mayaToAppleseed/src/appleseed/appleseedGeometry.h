@@ -3,6 +3,9 @@
 
 #include "renderer/api/object.h"
 #include <maya/MObject.h>
+#include "utilities/meshTools.h"
+#include "mayaObject.h"
+#include <vector>
 
 namespace asf = foundation;
 namespace asr = renderer;
@@ -11,6 +14,9 @@ namespace MTAP_GEOMETRY{
 
 	asf::auto_release_ptr<asr::MeshObject> defineStandardPlane();
 	asf::auto_release_ptr<asr::MeshObject> createMesh(MObject& mobject);
+	// motionSteps are the deformation samples of MayaObject::meshDataList, with more than one sample
+	// the mesh gets one motion segment per additional sample
+	asf::auto_release_ptr<asr::MeshObject> createMesh(const MeshExtract& extract, int numMaterialSlots, const std::vector<MeshData>& motionSteps);
 
 };
 
@@ -3,9 +3,45 @@
 #include "utilities/logging.h"
 #include "utilities/tools.h"
 #include "mayaScene.h"
+#include "threads/iprChangeTracker.h"
+#include "threads/renderQueueWorker.h"
+#include "world.h"
 
 using namespace AppleRender;
 
+// Shaders, lights, the camera and instance matrices are updated while the master renderer keeps running:
+// it stops the current frame, the controller applies the changes in on_frame_end() and the scene is prepared again.
+// Mesh changes still need a complete restart.
+bool AppleseedRenderer::canUpdateWhileRendering(int maxUpdateCost)
+{
+	return sceneBuilt && (masterRenderer.get() != nullptr) && (maxUpdateCost <= IPR_UPDATE_TRANSFORM);
+}
+
+void AppleseedRenderer::requestLiveUpdate()
+{
+	Logging::debug("AppleseedRenderer::requestLiveUpdate");
+	if (mtap_controller.status == asr::IRendererController::ContinueRendering)
+		mtap_controller.status = asr::IRendererController::ReinitializeRendering;
+}
+
+// The crop window is a parameter of the master renderer, it is read again when the rendering is reinitialized,
+// so a new region only needs a live update like a shader change.
+bool AppleseedRenderer::updateRenderRegion()
+{
+	if (!sceneBuilt || (masterRenderer.get() == nullptr))
+		return false;
+	this->renderRegionChanged = true;
+	return true;
+}
+
+void AppleseedRenderer::applyIprUpdates()
+{
+	std::shared_ptr<AppleseedRenderer> renderer = std::static_pointer_cast<AppleseedRenderer>(MayaTo::getWorldPtr()->worldRendererPtr);
+	if (renderer && renderer->renderRegionChanged.exchange(false))
+		renderer->defineCropWindow(renderer->masterRenderer->get_parameters());
+	RenderQueueWorker::applyLiveUpdates();
+}
+
 void AppleseedRenderer::doInteractiveUpdate()
 {
 	Logging::debug("AppleseedRenderer::doInteractiveUpdate");
@@ -17,7 +53,7 @@ void AppleseedRenderer::doInteractiveUpdate()
 		{
 			if (iElement->obj)
 			{
-				Logging::debug(MString("AppleseedRenderer::doInteractiveUpdate - found shadingEngine.") + iElement->name);
+				LOG_DEBUG(MString("AppleseedRenderer::doInteractiveUpdate - found shadingEngine.") + iElement->name);
 				MObject surface = getConnectedInNode(iElement->node, "surfaceShader");
 				if (surface != MObject::kNullObj)
 				{
@@ -28,13 +64,13 @@ void AppleseedRenderer::doInteractiveUpdate()
 		}
 		if (iElement->node.hasFn(MFn::kCamera))
 		{
-			Logging::debug(MString("AppleseedRenderer::doInteractiveUpdate - found camera.") + iElement->name);
+			LOG_DEBUG(MString("AppleseedRenderer::doInteractiveUpdate - found camera.") + iElement->name);
 			if (iElement->obj)
 				defineCamera(iElement->obj);
 		}
 		if (iElement->node.hasFn(MFn::kLight))
 		{
-			Logging::debug(MString("AppleseedRenderer::doInteractiveUpdate - found light.") + iElement->name);
+			LOG_DEBUG(MString("AppleseedRenderer::doInteractiveUpdate - found light.") + iElement->name);
 			if (iElement->obj)
 			{
 				defineLight(iElement->obj);
@@ -51,7 +87,7 @@ void AppleseedRenderer::doInteractiveUpdate()
 				if (typeName == shaderName)
 				{
 					std::shared_ptr<mtap_MayaObject> obj = std::static_pointer_cast<mtap_MayaObject>(iElement->obj);
-					Logging::debug(MString("AppleseedRenderer::doInteractiveUpdate - found shader.") + iElement->name);
+					LOG_DEBUG(MString("AppleseedRenderer::doInteractiveUpdate - found shader.") + iElement->name);
 					this->defineMaterial(obj);
 				}
 			}
@@ -67,7 +103,7 @@ void AppleseedRenderer::doInteractiveUpdate()
 			if (iElement->triggeredFromTransform)
 			{
 				//Logging::debug(MString("AppleseedRenderer::doInteractiveUpdate - found mesh triggered from transform - update instance.") + iElement->name);
-				Logging::debug(MString("AppleseedRenderer::doInteractiveUpdate mesh ") + iElement->name + " ieNodeName " + getObjectName(iElement->node) + " objDagPath " + iElement->obj->dagPath.fullPathName());
+				LOG_DEBUG(MString("AppleseedRenderer::doInteractiveUpdate mesh ") + iElement->name + " ieNodeName " + getObjectName(iElement->node) + " objDagPath " + iElement->obj->dagPath.fullPathName());
 				MStatus stat;
 				//MFnDagNode dn(iElement->node, &stat);
 				//Logging::debug(MString("AppleseedRenderer::doInteractiveUpdate dn ") + dn.fullPathName() + " (sollte sein: " + iElement->name + ")");
@@ -12,6 +12,7 @@
 #include "world.h"
 #include "appleseedUtils.h"
 #include "renderer/api/edf.h"
+#include "utilities/tracing.h"
 
 static Logging logger;
 
@@ -194,6 +195,7 @@ void AppleseedRenderer::defineLight(std::shared_ptr<MayaObject> obj)
 
 void AppleseedRenderer::defineLights()
 {
+	TRACE_ZONE("AppleseedRenderer::defineLights");
 	MStatus stat;
 	MFnDependencyNode rGlNode(getRenderGlobalsNode());
 	// first get the globals node and serach for a directional light connection
@@ -7,10 +7,13 @@
 #include "utilities/tools.h"
 #include "utilities/attrTools.h"
 #include "OSL/oslUtils.h"
+#include "OSL/oslShaderGroupCache.h"
 #include "maya/MFnDependencyNode.h"
 #include "world.h"
 #include "mayaScene.h"
 #include "threads/renderQueueWorker.h"
+#include "utilities/tracing.h"
+#include "utilities/sceneStatistics.h"
 
 void AppleRender::AppleseedRenderer::updateMaterial(MObject sufaceShader)
 {
@@ -20,6 +23,7 @@ void AppleRender::AppleseedRenderer::updateMaterial(MObject sufaceShader)
 
 asf::StringArray AppleRender::AppleseedRenderer::defineMaterial(std::shared_ptr<mtap_MayaObject> obj)
 {
+	TRACE_ZONE_DETAIL("AppleseedRenderer::defineMaterial", obj->shortName);
 	MStatus status;
 	asf::StringArray materialNames;
 	getObjectShadingGroups(obj->dagPath, obj->perFaceAssignments, obj->shadingGroups, false);
@@ -30,6 +34,7 @@ asf::StringArray AppleRender::AppleseedRenderer::defineMaterial(std::shared_ptr<
 		MAYATO_OSLUTIL::OSLUtilClass OSLShaderClass;
 		MObject materialNode = obj->shadingGroups[sgId];
 		MString shadingGroupName = getObjectName(materialNode);
+		MayaTo::MaterialStatisticsScope materialStatistics(shadingGroupName);
 		MString shaderGroupName = shadingGroupName + "_OSLShadingGroup";
 		MString surfaceShader;
 		MObject surfaceShaderNode = getConnectedInNode(materialNode, "surfaceShader");
@@ -61,19 +66,34 @@ asf::StringArray AppleRender::AppleseedRenderer::defineMaterial(std::shared_ptr<
 		
 		asr::Assembly *assembly = getMasterAssemblyFromProject(this->project.get());
 		assert(assembly != nullptr);
-		asr::ShaderGroup *shaderGroup = assembly->shader_groups().get_by_name(shaderGroupName.asChar());
 
-		if (shaderGroup != nullptr)
+		MString objectInstanceName = getObjectInstanceName(obj.get());
+		asr::Assembly *ass = getCreateObjectAssembly(obj);
+		asr::ObjectInstance *objInstance = ass->object_instances().get_by_name(objectInstanceName.asChar());
+
+		// networks which are already translated are reused, in IPR only if it is the same shading group
+		MaterialCache& materialCache = getMaterialCache();
+		unsigned long long networkHash = network.getHash();
+		MString materialName = shadingGroupName;
+		bool reuseMaterial = false;
+		if (MayaTo::getWorldPtr()->renderType == MayaTo::MayaToWorld::WorldRenderType::IPRRENDER)
 		{
-			shaderGroup->clear();
+			reuseMaterial = !materialCache.hasChanged(shadingGroupName, networkHash);
 		}
 		else{
-			asf::auto_release_ptr<asr::ShaderGroup> oslShadingGroup = asr::ShaderGroupFactory().create(shaderGroupName.asChar());
-			assembly->shader_groups().insert(oslShadingGroup);
-			shaderGroup = assembly->shader_groups().get_by_name(shaderGroupName.asChar());
+			reuseMaterial = materialCache.findMaterial(networkHash, materialName);
+		}
+		if (reuseMaterial && (assembly->materials().get_by_name(materialName.asChar()) != nullptr))
+		{
+			LOG_DEBUG(MString("Reusing material ") + materialName + " for shading group " + shadingGroupName);
+			materialCache.reusedMaterials++;
+			objInstance->get_front_material_mappings().insert("slot0", materialName.asChar());
+			continue;
 		}
+		materialName = shadingGroupName;
 
-		OSLShaderClass.group = (OSL::ShaderGroup *)shaderGroup;
+		// the nodes and connections are only collected here, the shader group is filled if its content changed
+		OSLShaderClass.group = nullptr;
 
 		MFnDependencyNode shadingGroupNode(materialNode);
 		MPlug shaderPlug = shadingGroupNode.findPlug("surfaceShader");
@@ -82,53 +102,81 @@ asf::StringArray AppleRender::AppleseedRenderer::defineMaterial(std::shared_ptr<
 		for (int shadingNodeId = 0; shadingNodeId < numNodes; shadingNodeId++)
 		{
 			ShadingNode snode = network.shaderList[shadingNodeId];
-			Logging::debug(MString("ShadingNode Id: ") + shadingNodeId + " ShadingNode name: " + snode.fullName);
+			LOG_DEBUG(MString("ShadingNode Id: ") + shadingNodeId + " ShadingNode name: " + snode.fullName);
 			if (shadingNodeId == (numNodes - 1))
-				Logging::debug(MString("LastNode Surface Shader: ") + snode.fullName);
+				LOG_DEBUG(MString("LastNode Surface Shader: ") + snode.fullName);
 			OSLShaderClass.createOSLShadingNode(network.shaderList[shadingNodeId]);
 			//OSLShaderClass.connectProjectionNodes(network.shaderList[shadingNodeId].mobject);
 		}
 			
 		OSLShaderClass.cleanupShadingNodeList();
-		OSLShaderClass.createAndConnectShaderNodes();
-			
-		//cleanupShadingNodelist - search for helper nodes and define them directly after the corresponding node
-		//rename helper nodes with in/out prefix
 
-		if (numNodes > 0)
+		// a cleared shader group has to be compiled again by appleseed, so it is only rebuilt if the osl content is different
+		MAYATO_OSL::ShaderGroupCache& groupCache = MAYATO_OSL::getShaderGroupCache();
+		std::string groupKey = groupCache.getKey(OSLShaderClass.oslNodeArray, OSLShaderClass.connectionList);
+		asr::ShaderGroup *shaderGroup = assembly->shader_groups().get_by_name(shaderGroupName.asChar());
+
+		if ((shaderGroup != nullptr) && groupCache.isUpToDate(shaderGroupName, groupKey))
 		{
-			ShadingNode snode = network.shaderList[numNodes - 1];
-			MString layer = (snode.fullName + "_interface");
-			Logging::debug(MString("Adding interface shader: ") + layer);
-			asr::ShaderGroup *sg = (asr::ShaderGroup *)OSLShaderClass.group;
-			sg->add_shader("surface", "surfaceShaderInterface", layer.asChar(), asr::ParamArray());
-			const char *srcLayer = snode.fullName.asChar();
-			const char *srcAttr = "outColor";
-			const char *dstLayer = layer.asChar();
-			const char *dstAttr = "inColor";
-			Logging::debug(MString("Connecting interface shader: ") + srcLayer + "." + srcAttr + " -> " + dstLayer + "." + dstAttr);
-			sg->add_connection(srcLayer, srcAttr, dstLayer, dstAttr);
+			LOG_DEBUG(MString("Shader group ") + shaderGroupName + " is unchanged, keeping it.");
+			groupCache.reusedGroups++;
+		}
+		else{
+			if (shaderGroup != nullptr)
+			{
+				shaderGroup->clear();
+			}
+			else{
+				asf::auto_release_ptr<asr::ShaderGroup> oslShadingGroup = asr::ShaderGroupFactory().create(shaderGroupName.asChar());
+				assembly->shader_groups().insert(oslShadingGroup);
+				shaderGroup = assembly->shader_groups().get_by_name(shaderGroupName.asChar());
+			}
+
+			OSLShaderClass.group = (OSL::ShaderGroup *)shaderGroup;
+			OSLShaderClass.createAndConnectShaderNodes();
+
+			//cleanupShadingNodelist - search for helper nodes and define them directly after the corresponding node
+			//rename helper nodes with in/out prefix
+
+			if (numNodes > 0)
+			{
+				ShadingNode snode = network.shaderList[numNodes - 1];
+				MString layer = (snode.fullName + "_interface");
+				LOG_DEBUG(MString("Adding interface shader: ") + layer);
+				shaderGroup->add_shader("surface", "surfaceShaderInterface", layer.asChar(), asr::ParamArray());
+				const char *srcLayer = snode.fullName.asChar();
+				const char *srcAttr = "outColor";
+				const char *dstLayer = layer.asChar();
+				const char *dstAttr = "inColor";
+				LOG_DEBUG(MString("Connecting interface shader: ") + srcLayer + "." + srcAttr + " -> " + dstLayer + "." + dstAttr);
+				shaderGroup->add_connection(srcLayer, srcAttr, dstLayer, dstAttr);
+			}
+			groupCache.setGroup(shaderGroupName, groupKey);
+			groupCache.builtGroups++;
 		}
-			
 
+		// the material and surface shader only refer to the shader group by name, if a modified network is translated again they can be kept
 		MString physicalSurfaceName = shadingGroupName + "_physical_surface_shader";
-		assembly->surface_shaders().insert(
-			asr::PhysicalSurfaceShaderFactory().create(
-			physicalSurfaceName.asChar(),
-			asr::ParamArray()));
-
-		assembly->materials().insert(
-			asr::OSLMaterialFactory().create(
-			shadingGroupName.asChar(),
-			asr::ParamArray()
-			.insert("surface_shader", physicalSurfaceName.asChar())
-			.insert("osl_surface", shaderGroupName.asChar())));
+		if (assembly->surface_shaders().get_by_name(physicalSurfaceName.asChar()) == nullptr)
+		{
+			assembly->surface_shaders().insert(
+				asr::PhysicalSurfaceShaderFactory().create(
+				physicalSurfaceName.asChar(),
+				asr::ParamArray()));
+		}
 
-		MString objectInstanceName = getObjectInstanceName(obj.get());
-		asr::Assembly *ass = getCreateObjectAssembly(obj);
+		if (assembly->materials().get_by_name(materialName.asChar()) == nullptr)
+		{
+			assembly->materials().insert(
+				asr::OSLMaterialFactory().create(
+				materialName.asChar(),
+				asr::ParamArray()
+				.insert("surface_shader", physicalSurfaceName.asChar())
+				.insert("osl_surface", shaderGroupName.asChar())));
+		}
+		materialCache.addMaterial(networkHash, materialName);
 
-		asr::ObjectInstance *objInstance = ass->object_instances().get_by_name(objectInstanceName.asChar());
-		objInstance->get_front_material_mappings().insert("slot0", shadingGroupName.asChar());
+		objInstance->get_front_material_mappings().insert("slot0", materialName.asChar());
 	}
 
 	return materialNames;
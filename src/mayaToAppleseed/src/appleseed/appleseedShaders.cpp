@@ -571,10 +571,10 @@ void AppleseedRenderer::defineBumpMap(asr::ParamArray& materialParams, MObject&
 	}
 	if( !bumpObj.hasFn(MFn::kBump))
 	{
-		Logging::debug(MString("Found cameraNormal input for shader: ") + shaderNode.name() + " : " + getObjectName(bumpObj) + " but is NO bump2d node");
+		LOG_DEBUG(MString("Found cameraNormal input for shader: ") + shaderNode.name() + " : " + getObjectName(bumpObj) + " but is NO bump2d node");
 		return;
 	}
-	Logging::debug(MString("Found bump input for shader: ") + shaderNode.name() + " : " + getObjectName(bumpObj));
+	LOG_DEBUG(MString("Found bump input for shader: ") + shaderNode.name() + " : " + getObjectName(bumpObj));
 	MFnDependencyNode bumpNode(bumpObj);
 	MObject fileObj = getOtherSideNode(MString("bumpValue"), bumpObj);
 	if( fileObj == MObject::kNullObj)
@@ -766,7 +766,7 @@ void AppleseedRenderer::updateShader( MObject shadingNode)
 	if(found)
 	{
 		ShaderAssemblyAssignment saa = ShaderAssemblyAssignments[assignmentId];
-		Logging::debug(MString("Found shader assingments for shading node: ") + getObjectName(shadingNode));		
+		LOG_DEBUG(MString("Found shader assingments for shading node: ") + getObjectName(shadingNode));		
 		for( size_t assId = 0; assId < saa.assemblyList.size(); assId++)
 			definePhysSurfShader(saa.assemblyList[assId], saa.shadingGroup, true);
 	}
@@ -271,7 +271,7 @@ void AppleseedRenderer::createAppleseedShadingNode(ShadingNode& sn, asr::Assembl
 		if( shadingEngine != MObject::kNullObj )
 		{
 			MString shadingEngineName = getObjectName(shadingEngine);
-			Logging::debug(MString("Defining appleseed material with shading engine name: ") + shadingEngineName);
+			LOG_DEBUG(MString("Defining appleseed material with shading engine name: ") + shadingEngineName);
 			entity = assembly->materials().get_by_name(shadingEngineName.asChar());
 			if( entity == nullptr)
 				assembly->materials().insert(asr::GenericMaterialFactory().create(shadingEngineName.asChar(), asr::ParamArray()));
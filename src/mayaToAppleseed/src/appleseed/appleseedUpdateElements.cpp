@@ -15,7 +15,7 @@ using namespace AppleRender;
 
 void AppleseedRenderer::updateTransform(std::shared_ptr<MayaObject> obj)
 {
-	Logging::debug(MString("AppleseedRenderer::updateTransform: ") + obj->shortName);
+	LOG_DEBUG(MString("AppleseedRenderer::updateTransform: ") + obj->shortName);
 	//// if we have no object assembly, there is no need to update/create the assemblyInstance
 	//if( getObjectAssembly(obj) == nullptr )
 	//{
@@ -155,7 +155,15 @@ void AppleseedRenderer::updateTransform(std::shared_ptr<MayaObject> obj)
 
 void AppleseedRenderer::updateShape(std::shared_ptr<MayaObject> obj)
 {
-	Logging::debug(MString("AppleseedRenderer::updateShape: ") + obj->shortName);
+	LOG_DEBUG(MString("AppleseedRenderer::updateShape: ") + obj->shortName);
+
+	// the deformation samples are collected per motion step and used when the mesh is defined,
+	// a shape without input connection does not deform, one sample is enough
+	if ((obj->instanceNumber == 0) && obj->mobject.hasFn(MFn::kMesh))
+	{
+		if ((obj->meshDataList.size() == 0) || obj->isShapeConnected())
+			obj->addMeshData();
+	}
 
 	//if( obj->isCamera())
 	//{
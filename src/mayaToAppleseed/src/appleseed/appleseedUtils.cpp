@@ -351,7 +351,7 @@ MString defineTexture(MFnDependencyNode& shader, MString& attributeName)
 	MString colorProfile = "srgb";
 
 	asr::ParamArray params;
-	Logging::debug(MString("Now inserting file name: ") + fileTextureName);
+	LOG_DEBUG(MString("Now inserting file name: ") + fileTextureName);
 	params.insert("filename", fileTextureName.asChar());      // OpenEXR only for now. The param is called filename but it can be a path
 	params.insert("color_space", colorProfile.asChar());
 	
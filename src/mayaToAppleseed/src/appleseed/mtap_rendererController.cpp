@@ -27,7 +27,9 @@ void mtap_IRendererController::on_rendering_abort()
 // This method is called before rendering a single frame.
 void mtap_IRendererController::on_frame_begin()
 {
-	this->status = IRendererController::ContinueRendering;
+	// an abort which was requested meanwhile must not be lost
+	if ((this->status == IRendererController::RestartRendering) || (this->status == IRendererController::ReinitializeRendering))
+		this->status = IRendererController::ContinueRendering;
 
 	//if( this->entityUpdateProc != nullptr)
 	//{
@@ -40,6 +42,10 @@ void mtap_IRendererController::on_frame_begin()
 void mtap_IRendererController::on_frame_end()
 {
 	//IRendererController::on_frame_end();
+	// the frame was stopped for an ipr update, the render threads are idle now so we can modify the scene
+	// before the master renderer prepares it again
+	if ((this->status == IRendererController::ReinitializeRendering) && (this->entityUpdateProc != nullptr))
+		this->entityUpdateProc();
 	//if( this->entityUpdateProc != nullptr)
 	//{
 	//	this->entityUpdateProc();
@@ -7,6 +7,10 @@
 #include "threads/queue.h"
 #include "utilities/logging.h"
 #include "threads/renderQueueWorker.h"
+#include "utilities/tracing.h"
+#include "renderGlobals.h"
+#include "world.h"
+#include <algorithm>
 
 static Logging logger;
 
@@ -71,64 +75,65 @@ void mtap_ITileCallback::copyASImageToMayaImage(RV_PIXEL* pixels, const asr::Fra
 
 #define kNumChannels 4
 
-void mtap_ITileCallback::copyTileToImage(RV_PIXEL* pixels, asf::Tile& tile, int tile_x, int tile_y, const asr::Frame* frame)
+// copies the part of the tile which lies in the region xmin..xmax, ymin..ymax into the region buffer.
+// The region is in render view coordinates with the origin at the bottom left, appleseed starts at the top.
+void mtap_ITileCallback::copyTileToImage(RV_PIXEL* pixels, asf::Tile& tile, int tile_x, int tile_y, const asr::Frame* frame, int xmin, int ymin, int xmax, int ymax)
 {
-	//size_t tw = tile.get_width();
-	//size_t th = tile.get_height();
-	//
-	//for (int y = 0; y < th; y++)
-	//{
-	//	for (int x = 0; x < tw; x++)
-	//	{
-	//		int index = ((height - 1) - (tile_y * tileSize + y)) * width + (tile_x * tileSize) + x;
-	//		index *= kNumChannels;
-
-	//		rb[index] = tile.get_component<float>(x, y, 0);
-	//		rb[index + 1] = tile.get_component<float>(x, y, 1);
-	//		rb[index + 2] = tile.get_component<float>(x, y, 2);
-	//		rb[index + 3] = tile.get_component<float>(x, y, 3);
-	//	}
-	//}
-
 	const asf::CanvasProperties& frame_props = frame->image().properties();
-	size_t tw =  tile.get_width();
-	size_t th =  tile.get_height();
-	size_t ypos = frame_props.m_canvas_height - tile_y * frame_props.m_tile_height - 1;
-	size_t pixelIdYStart = frame_props.m_canvas_width * ypos;
-	size_t max = frame_props.m_canvas_width * frame_props.m_canvas_height;
-	int dummy = 0;
-	for( size_t ty = 0; ty < th; ty++)
+	int tw = (int)tile.get_width();
+	int th = (int)tile.get_height();
+	int regionWidth = xmax - xmin + 1;
+	for (int ty = 0; ty < th; ty++)
 	{
-		for( size_t tx = 0; tx < tw; tx++)
+		int y = (int)frame_props.m_canvas_height - 1 - (tile_y * (int)frame_props.m_tile_height + ty);
+		if ((y < ymin) || (y > ymax))
+			continue;
+		for (int tx = 0; tx < tw; tx++)
 		{
-			size_t yPixelPos = pixelIdYStart - ty * frame_props.m_canvas_width;
-			size_t pixelId = yPixelPos + tile_x * frame_props.m_tile_width + tx;
+			int x = tile_x * (int)frame_props.m_tile_width + tx;
+			if ((x < xmin) || (x > xmax))
+				continue;
 			asf::uint8 *source = tile.pixel(tx, ty);
-			if( pixelId < max)
-			{
-				pixels[pixelId].r = (float)source[0]; 
-				pixels[pixelId].g = (float)source[1]; 
-				pixels[pixelId].b = (float)source[2]; 
-				pixels[pixelId].a = (float)source[3]; 
-			}else
-				dummy = 0;
+			RV_PIXEL& pixel = pixels[(y - ymin) * regionWidth + (x - xmin)];
+			pixel.r = (float)source[0];
+			pixel.g = (float)source[1];
+			pixel.b = (float)source[2];
+			pixel.a = (float)source[3];
 		}
-	}	
+	}
 }
 
 // this will be called for interactive renderings if a frame is complete
 void mtap_ITileCallback::post_render(
 		const asr::Frame* frame)
 {
+	TRACE_ZONE("mtap_ITileCallback::post_render");
 	Logging::debug(MString("Post render frame."));
-	asf::Image img = frame->image();
-	const asf::CanvasProperties& frame_props = img.properties();
-	size_t numPixels = frame_props.m_canvas_width * frame_props.m_canvas_height;
-	
+	const asf::CanvasProperties& frame_props = frame->image().properties();
+	int xmin = 0;
+	int ymin = 0;
+	int xmax = (int)frame_props.m_canvas_width - 1;
+	int ymax = (int)frame_props.m_canvas_height - 1;
+
+	// only the tiles of the render region are converted, the region can be changed during ipr, so it is clamped to the frame
+	std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;
+	if (renderGlobals && renderGlobals->getUseRenderRegion())
+	{
+		int left, bottom, right, top;
+		renderGlobals->getRenderRegion(left, bottom, right, top);
+		xmin = std::max(left, 0);
+		ymin = std::max(bottom, 0);
+		xmax = std::min(right, xmax);
+		ymax = std::min(top, ymax);
+		if ((xmin > xmax) || (ymin > ymax))
+			return;
+	}
+
+	size_t numPixels = (size_t)(xmax - xmin + 1) * (size_t)(ymax - ymin + 1);
 	std::shared_ptr<RV_PIXEL> pixelsPtr(new RV_PIXEL[numPixels]);
 	RV_PIXEL *pixels = pixelsPtr.get();
 
-	for( int x = 0; x < numPixels; x++)
+	for( size_t x = 0; x < numPixels; x++)
 	{
 		pixels[x].r = 255.0f;
 		pixels[x].g = .0f;
@@ -136,11 +141,14 @@ void mtap_ITileCallback::post_render(
 		pixels[x].a = .0f;
 	}
 
-	//copyASImageToMayaImage(pixels, frame);
+	int firstTileX = xmin / (int)frame_props.m_tile_width;
+	int lastTileX = xmax / (int)frame_props.m_tile_width;
+	int firstTileY = ((int)frame_props.m_canvas_height - 1 - ymax) / (int)frame_props.m_tile_height;
+	int lastTileY = ((int)frame_props.m_canvas_height - 1 - ymin) / (int)frame_props.m_tile_height;
 
-	for( int tile_x = 0; tile_x < frame_props.m_tile_count_x; tile_x++)
+	for (int tile_x = firstTileX; tile_x <= lastTileX; tile_x++)
 	{
-		for( int tile_y = 0; tile_y < frame_props.m_tile_count_y; tile_y++)
+		for (int tile_y = firstTileY; tile_y <= lastTileY; tile_y++)
 		{
 			const asf::Tile& tile = frame->image().tile(tile_x, tile_y);
 
@@ -163,23 +171,22 @@ void mtap_ITileCallback::post_render(
 
 			frame->transform_to_output_color_space(fp_rgb_tile);
 
-			static const size_t ShuffleTable[] = { 0, 1, 2, 3 };
 			asf::Tile uint8_rgb_tile(
 				fp_rgb_tile,
 				asf::PixelFormatUInt8,
 				uint8_tile_storage.get_storage());
 
-			copyTileToImage(pixels, uint8_rgb_tile, tile_x, tile_y, frame);
+			copyTileToImage(pixels, uint8_rgb_tile, tile_x, tile_y, frame, xmin, ymin, xmax, ymax);
 		}
 	}
 
 	EventQueue::Event e;
 	e.pixelData = pixelsPtr;
 	e.type = EventQueue::Event::TILEDONE;
-	e.tile_xmin = 0;
-	e.tile_xmax = frame_props.m_canvas_width - 1;
-	e.tile_ymin = 0;
-	e.tile_ymax = frame_props.m_canvas_height - 1;
+	e.tile_xmin = xmin;
+	e.tile_xmax = xmax;
+	e.tile_ymin = ymin;
+	e.tile_ymax = ymax;
 	theRenderEventQueue()->push(e);
 }
 
@@ -188,6 +195,7 @@ void mtap_ITileCallback::post_render_tile(
         const size_t tile_x,
 		const size_t tile_y)
 {
+	TRACE_ZONE("mtap_ITileCallback::post_render_tile");
 	asf::Image img = frame->image();
 	const asf::CanvasProperties& frame_props = img.properties();
 	const asf::Tile& tile = frame->image().tile(tile_x, tile_y);
@@ -36,7 +36,8 @@ public:
     //    const size_t tile_x,
     //    const size_t tile_y);
 
-	void copyTileToImage(RV_PIXEL* pixels, asf::Tile& tile, int tile_x, int tile_y, const asr::Frame* frame);
+	// pixels is a buffer of the region xmin..xmax, ymin..ymax
+	void copyTileToImage(RV_PIXEL* pixels, asf::Tile& tile, int tile_x, int tile_y, const asr::Frame* frame, int xmin, int ymin, int xmax, int ymax);
 
 	void copyASImageToMayaImage(RV_PIXEL* pixels, const asr::Frame* frame);
 };
@@ -1,5 +1,6 @@
 #include <maya/MFnPlugin.h>
 #include <maya/MGlobal.h>
+#include "utilities/logging.h"
 
 #include "binMeshTools/binMeshTranslator.h"
 #include "binMeshTools/binMeshWriterCmd.h"
@@ -63,6 +64,9 @@ MStatus uninitializePlugin(MObject obj)
 	MStatus   status;
 	MFnPlugin plugin( obj );
 
+	// joins the log output thread, it must not be running when the plugin is unloaded
+	Logging::shutdown();
+
 	status =  plugin.deregisterFileTranslator(TRANSLATORNAME);
 	if (!status) 
 	{
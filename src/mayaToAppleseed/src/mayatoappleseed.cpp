@@ -8,6 +8,7 @@
 #include "utilities/tools.h"
 #include "utilities/attrTools.h"
 #include "world.h"
+#include "dummyRenderer/benchmarkRenderer.h"
 
 void* MayaToAppleseed::creator()
 {
@@ -32,6 +33,11 @@ MSyntax MayaToAppleseed::newSyntax()
 	syntax.addFlag("-str", "-stopIpr");
 	// Flag -pauseIPR
 	syntax.addFlag("-par", "-pauseIpr");
+	// the render region was changed in the render view during IPR
+	syntax.addFlag("-uir", "-updateIprRegion");
+	// translates the current scene without rendering it and returns the duration of the translation phases as json,
+	// args: result file (can be empty), scene name
+	stat = syntax.addFlag("-bm", "-benchmark", MSyntax::kString, MSyntax::kString);
 
 	return syntax;
 }
@@ -74,6 +80,18 @@ MStatus MayaToAppleseed::doIt(const MArgList& args)
 		return MS::kSuccess;
 	}
 
+	if (argData.isFlagSet("-benchmark", &stat))
+	{
+		MString resultFile, sceneName;
+		argData.getFlagArgument("-benchmark", 0, resultFile);
+		argData.getFlagArgument("-benchmark", 1, sceneName);
+		MString result = MayaTo::runTranslationBenchmark(resultFile, sceneName);
+		if (result.length() == 0)
+			return MS::kFailure;
+		setResult(result);
+		return MS::kSuccess;
+	}
+
 	if (argData.isFlagSet("-stopIpr", &stat))
 	{
 		Logging::debug(MString("-stopIpr"));
@@ -93,6 +111,15 @@ MStatus MayaToAppleseed::doIt(const MArgList& args)
 		return MS::kSuccess;
 	}
 
+	if (argData.isFlagSet("-updateIprRegion", &stat))
+	{
+		Logging::debug(MString("-updateIprRegion"));
+		EventQueue::Event e;
+		e.type = EventQueue::Event::IPRUPDATEREGION;
+		theRenderEventQueue()->push(e);
+		return MS::kSuccess;
+	}
+
 	// I have to request useRenderRegion here because as soon the command is finished, what happens immediatly after the command is 
 	// put into the queue, the value is set back to false.
 	std::unique_ptr<MayaTo::CmdArgs> cmdArgs(new MayaTo::CmdArgs);
@@ -4,17 +4,13 @@
 #include "utilities/logging.h"
 #include <maya/MGlobal.h>
 #include "../appleseed/swatchesRenderer/appleseedSwatchRenderer.h"
-#include "../appleseed/SwatchesRenderer/SwatchesEvent.h"
-#include <thread>
 
 static Logging logger;
 namespace MayaTo{
 
 	void MayaToWorld::cleanUp()
 	{
-		AppleseedSwatchRenderer * appleSwRndr = (AppleseedSwatchRenderer *)this->getObjPtr("appleseedSwatchesRenderer");
-		if (appleSwRndr)
-			delete appleSwRndr;
+		AppleseedSwatchRenderer::stopSwatchService();
 	}
 
 	void MayaToWorld::cleanUpAfterRender()
@@ -36,11 +32,7 @@ namespace MayaTo{
 		{
 			this->shaderSearchPath.append(oslDirs[i].asChar());
 		}
-		AppleseedSwatchRenderer *appleSwRndr = new AppleseedSwatchRenderer();
-
-		this->addObjectPtr("appleseedSwatchesRenderer", appleSwRndr);
-		std::thread swatchRenderThread(AppleseedSwatchRenderer::startAppleseedSwatchRender, appleSwRndr);
-		swatchRenderThread.detach();
+		AppleseedSwatchRenderer::startSwatchService();
 	}
 
 	void MayaToWorld::afterOpenScene()
@@ -8,11 +8,13 @@
 #include "mtap_common/mtap_renderGlobalsNode.h"
 #include "swatchesRenderer/swatchRenderer.h"
 #include "swatchesRenderer/NewSwatchRenderer.h"
+#include "swatchesRenderer/swatchService.h"
 //#include "appleseed/SwatchesRenderer/appleseedSwatchRenderer.h"
 
 #include "utilities/tools.h"
 #include "threads/renderQueueWorker.h"
 #include "world.h"
+#include "utilities/logging.h"
 #include "appleseed/version.h"
 
 #include "shaders/asDisneyMaterial.h"
@@ -120,7 +122,10 @@ MStatus uninitializePlugin( MObject obj)
 	MStatus   status;
 	MFnPlugin plugin( obj );
 
+	// the swatch workers are joined before the plugin is unloaded, deleteWorld() deletes their renderers
+	getSwatchService().stop();
 	MayaTo::deleteWorld();
+	Logging::shutdown();
 
 	const MString UserClassify( "shader/surface" );
 	
@@ -1,5 +1,4 @@
 #include "swatchesRenderer/swatchRendererInterface.h"
-#include "swatchesRenderer/swatchGeometry.h"
 
 #include <maya/MImage.h>
 
@@ -99,6 +99,7 @@ MStatus uninitializePlugin( MObject obj)
 
 	const MString UserClassify( "shader/surface" );
 	MayaTo::deleteWorld();
+	Logging::shutdown();
 
 	std::cout << "deregister mt@ cmd\n";
 	status = plugin.deregisterCommand( MAYATOCMDNAME );
@@ -6,7 +6,6 @@ import os
 import path
 import time
 import Renderer as Renderer
-import optimizeTextures
 import Corona.aeNodeTemplates as aet
 import Corona.passesUI
 import Corona.menu as coronaMenu
@@ -602,6 +601,10 @@ class CoronaRenderer(Renderer.MayaToRenderer):
         pm.addExtension( nodeType='areaLight', longName='mtco_visibleInRefraction', attributeType='bool', defaultValue=True) 
         pm.addExtension( nodeType='areaLight', longName='mtco_noOSL', attributeType='bool', defaultValue=False) 
 
+        # objects which are never removed by region or frustum culling, shared by all mayaTo plugins, so it may already exist
+        if not pm.attributeQuery("mtNeverCull", type="dagNode", exists=True):
+            pm.addExtension(nodeType="dagNode", longName="mtNeverCull", attributeType="bool", defaultValue=False)
+
         # displacement shader        
         pm.addExtension(nodeType="displacementShader", longName="mtco_displacementMin", attributeType="float", defaultValue=0.0)
         pm.addExtension(nodeType="displacementShader", longName="mtco_displacementMax", attributeType="float", defaultValue=0.01)
@@ -737,6 +740,10 @@ class CoronaRenderer(Renderer.MayaToRenderer):
         log.debug("stopIprRenderProcedure")
         pm.mayatoCorona(stopIpr=True)
         self.postRenderProcedure()
+
+    def changeIprRegionProcedure(self, *args, **kwargs):
+        log.debug("changeIprRegionProcedure")
+        pm.mayatoCorona(updateIprRegion=True)
             
     def preRenderProcedure(self):
         self.createGlobalsNode()
@@ -751,13 +758,8 @@ class CoronaRenderer(Renderer.MayaToRenderer):
                 if not os.path.exists(optimizedPath):
                     optimizedPath.makedirs()
                 self.renderGlobalsNode.optimizedTexturePath.set(str(optimizedPath))
-    
-            # craete optimized exr textures
-            optimizeTextures.preRenderOptimizeTextures(optimizedFilePath=self.renderGlobalsNode.optimizedTexturePath.get())
+            # the textures are converted to tiled exr files by the plugin before rendering
 
-    def postRenderProcedure(self):
-        optimizeTextures.postRenderOptimizeTextures()
-        
     def aeTemplateCallback(self, nodeName):
         log.debug("aeTemplateCallback: " + nodeName)
         aet.AECoronaNodeTemplate(nodeName)
@@ -4,12 +4,15 @@
 #include "utilities/logging.h"
 #include "renderGlobals.h"
 #include "threads/renderQueueWorker.h"
+#include "threads/cancelToken.h"
 #include "utilities/tools.h"
 #include "utilities/pystring.h"
 #include "utilities/attrTools.h"
 #include "CoronaMap.h"
 #include "world.h"
 #include "CoronaShaders.h"
+#include "osl/oslTextureOptimizer.h"
+#include "osl/oslTextureSystem.h"
 #include <maya/MNodeMessage.h>
 #include <maya/MFnDagNode.h>
 #include <maya/MFnMesh.h>
@@ -26,7 +29,7 @@
 
 using namespace Corona;
 
-CoronaRenderer::CoronaRenderer()
+CoronaRenderer::CoronaRenderer() : renderRegionChanged(false)
 {
 	MStatus stat;
 	Logging::debug("CoronaRenderer::CoronaRenderer()");
@@ -135,6 +138,34 @@ void CoronaRenderer::handleUserEvent(int event, MString strData, float floatData
 		Logging::debug(MString("Frambuffer image path: ") + strData);
 	}
 }
+
+bool CoronaRenderer::writeCheckpoint(const MString& fileName)
+{
+	if (this->context.fb == nullptr)
+		return false;
+	Corona::String dumpFilename = fileName.asChar();
+	this->context.fb->dumpExr(dumpFilename);
+	return true;
+}
+
+bool CoronaRenderer::resumeFromCheckpoint(const MString& fileName)
+{
+	return this->accumulateDump(fileName);
+}
+
+bool CoronaRenderer::accumulateDump(const MString& dumpFile)
+{
+	Corona::String dumpFilename = dumpFile.asChar();
+	if (!context.fb->accumulateFromExr(dumpFilename))
+	{
+		Logging::debug(MString("Accumulating from a dumpfile failed: ") + dumpFilename.cStr());
+		return false;
+	}
+	// random seed has to be 0 for resuming a render
+	context.settings->set(Corona::PARAM_SHOW_PREVISUALIZATIONS, false);
+	context.settings->set(Corona::PARAM_RANDOM_SEED, 0);
+	return true;
+}
 void CoronaRenderer::frameBufferInteractiveCallback(MObject& node, void *clientData)
 {
 	Logging::debug("CoronaRenderer::frameBufferInteractiveCallback");
@@ -175,7 +206,7 @@ void CoronaRenderer::doInteractiveUpdate()
 		{
 			if (iElement->obj)
 			{
-				Logging::debug(MString("CoronaRenderer::doInteractiveUpdate - found shadingEngine.") + iElement->name);
+				LOG_DEBUG(MString("CoronaRenderer::doInteractiveUpdate - found shadingEngine.") + iElement->name);
 				MObject surface = getConnectedInNode(iElement->node, "surfaceShader");
 				if (surface != MObject::kNullObj)
 				{
@@ -194,13 +225,13 @@ void CoronaRenderer::doInteractiveUpdate()
 		}
 		if (iElement->node.hasFn(MFn::kCamera))
 		{
-			Logging::debug(MString("CoronaRenderer::doInteractiveUpdate - found camera.") + iElement->name);
+			LOG_DEBUG(MString("CoronaRenderer::doInteractiveUpdate - found camera.") + iElement->name);
 			if (iElement->obj)
 				updateCamera(iElement->obj);
 		}
 		if (iElement->node.hasFn(MFn::kLight))
 		{
-			Logging::debug(MString("CoronaRenderer::doInteractiveUpdate - found light.") + iElement->name);
+			LOG_DEBUG(MString("CoronaRenderer::doInteractiveUpdate - found light.") + iElement->name);
 			if (iElement->obj)
 			{
 				updateLight(iElement->obj);
@@ -208,7 +239,7 @@ void CoronaRenderer::doInteractiveUpdate()
 		}
 		if (iElement->node.hasFn(MFn::kPluginDependNode))
 		{
-			Logging::debug(MString("CoronaRenderer::doInteractiveUpdate - found shader.") + iElement->name);
+			LOG_DEBUG(MString("CoronaRenderer::doInteractiveUpdate - found shader.") + iElement->name);
 			MFnDependencyNode depFn(iElement->node);
 			if (depFn.typeName() == "CoronaSurface")
 			{
@@ -236,7 +267,7 @@ void CoronaRenderer::doInteractiveUpdate()
 
 			if (iElement->triggeredFromTransform)
 			{
-				Logging::debug(MString("CoronaRenderer::doInteractiveUpdate - found mesh triggered from transform - update instance.") + iElement->name);
+				LOG_DEBUG(MString("CoronaRenderer::doInteractiveUpdate - found mesh triggered from transform - update instance.") + iElement->name);
 				MStatus stat;
 				MFnDagNode dn(iElement->node, &stat);
 				MDagPath mdp;
@@ -296,6 +327,9 @@ void CoronaRenderer::render()
 		this->defineGeometry();
 		this->defineEnvironment();
 		this->defineLights();
+		// an incomplete scene is not rendered, the scene is built again with the next rendering
+		if (MayaTo::isRenderCancelled())
+			return;
 
 		context.core->sanityCheck(context.scene);
 		Logging::debug(MString("registering framebuffer callback."));
@@ -332,7 +366,15 @@ void CoronaRenderer::render()
 		}
 		sceneBuilt = true;
 	}
+	// ipr restart after a new render region, the render was cancelled for it
+	if (this->renderRegionChanged.exchange(false))
+	{
+		this->defineRenderRegion();
+		this->context.core->uncancelRender();
+	}
 	context.core->renderFrame(); // blocking render call
+	// renderFrame() also returns if the rendering was cancelled
+	this->frameCompleted = !MayaTo::isRenderCancelled();
 }
 
 // init all data which will be used during a rendering.
@@ -344,6 +386,24 @@ void CoronaRenderer::initializeRenderer()
 	clearDataList(); // clear nativeMtlData
 	sceneBuilt = false;
 
+	// the OSL file textures and the corona bitmaps read the optimized textures, so they have to be converted before the shaders are translated.
+	// The native corona loader cannot read .tx files, tiled and mipmapped exr files work for both.
+	std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;
+	if (renderGlobals->useOptimizedTextures)
+	{
+		MAYATO_OSL::getTextureOptimizer().setTextureExtension(".exr");
+		MAYATO_OSL::getTextureOptimizer().prepare(renderGlobals->optimizedTexturePath);
+	}
+
+	// the texture cache survives the rendering, only textures which were modified on disk are read again
+	MAYATO_OSL::TextureSystemSettings textureSettings;
+	textureSettings.maxMemoryMB = (float)getIntAttr("textureCacheSize", gFn, 1024);
+	textureSettings.maxOpenFiles = getIntAttr("textureMaxOpenFiles", gFn, 100);
+	textureSettings.autotile = getIntAttr("textureAutoTile", gFn, 64);
+	MAYATO_OSL::getTextureSystemManager().configure(textureSettings);
+	MAYATO_OSL::getTextureSystemManager().invalidate();
+	MAYATO_OSL::getTextureSystemManager().resetStatistics();
+
 	// first we delete any still existing elements.
 	// after a render, the framebuffers, core and passes still exist until a new scene is loaded
 	// or a new rendering is started.
@@ -405,18 +465,7 @@ void CoronaRenderer::initializeRenderer()
 	{
 		MString dumpFile = getStringAttr("dumpExrFile", renderGlobalsNode, "");
 		if (dumpFile.length() > 0)
-		{
-			Corona::String dumpFilename = dumpFile.asChar();
-			if (!context.fb->accumulateFromExr(dumpFilename))
-			{
-				Logging::debug(MString("Accumulating from a dumpfile failed: ") + dumpFilename.cStr());
-			}
-			else{
-				// random seed has to be 0 for resuming a render
-				context.settings->set(Corona::PARAM_SHOW_PREVISUALIZATIONS, false);
-				context.settings->set(Corona::PARAM_RANDOM_SEED, 0);
-			}
-		}
+			this->accumulateDump(dumpFile);
 	}
 
 
@@ -444,9 +493,9 @@ void CoronaRenderer::unInitializeRenderer()
 	RenderQueueWorker::unregisterCallback(framebufferCallbackId);
 	framebufferCallback();
 	this->saveImage();
-	OIIO::TextureSystem *tsystem = this->oslRenderer->renderer.texturesys();
-	std::string statsString = tsystem->getstats(3);
-	Logging::debug(statsString.c_str());
+	Logging::info(MAYATO_OSL::getTextureSystemManager().getReport(0).c_str());
+	Logging::debug(MAYATO_OSL::getTextureSystemManager().getReport(3).c_str());
+	MAYATO_OSL::getTextureOptimizer().clear();
 
 	MayaTo::getWorldPtr()->setRenderState(MayaTo::MayaToWorld::WorldRenderState::RSTATENONE);
 
@@ -490,6 +539,14 @@ void CoronaRenderer::updateShape(std::shared_ptr<MayaObject> obj)
 void CoronaRenderer::updateTransform(std::shared_ptr<MayaObject> obj)
 {}
 
+bool CoronaRenderer::updateRenderRegion()
+{
+	if (!this->sceneBuilt || (this->context.core == nullptr))
+		return false;
+	this->renderRegionChanged = true;
+	return true;
+}
+
 void CoronaRenderer::abortRendering()
 {
 	if( this->context.core != nullptr)
@@ -1,6 +1,7 @@
 #ifndef MAYA_TO_CORONA_H
 #define MAYA_TO_CORONA_H
 
+#include <atomic>
 #include <vector>
 #include <maya/MObject.h>
 #include <maya/MFnMeshData.h>
@@ -189,6 +190,16 @@ public:
 	static void framebufferCallback();
 	virtual void doInteractiveUpdate();
 	virtual void  handleUserEvent(int event, MString strData, float floatData, int intData);
+	// checkpoints are framebuffer dumps, the same files as the manual dump and resume
+	virtual bool canCheckpoint(){ return true; }
+	virtual MString getCheckpointExtension(){ return "exr"; }
+	virtual bool writeCheckpoint(const MString& fileName);
+	virtual bool resumeFromCheckpoint(const MString& fileName);
+	bool accumulateDump(const MString& dumpFile);
+	// ipr: the new region is set before the next renderFrame(), the scene is kept
+	virtual bool updateRenderRegion();
+	void defineRenderRegion();
+	std::atomic<bool> renderRegionChanged;
 	std::vector<Corona::SharedPtr<Corona::Abstract::Map>> maps;
 	//void doit(); // for testing
 };
@@ -1,21 +1,26 @@
 #include "Corona.h"
 #include "renderGlobals.h"
+#include "renderGlobalsSnapshot.h"
 #include "utilities/logging.h"
 #include <maya/MGlobal.h>
 #include <maya/MImage.h>
+#include <algorithm>
 #include "utilities/attrTools.h"
 #include "threads/renderQueueWorker.h"
 #include "world.h"
+#include "utilities/tracing.h"
 
 static Logging logger;
 
 void CoronaRenderer::framebufferCallback()
 {
-	MFnDependencyNode depFn(getRenderGlobalsNode());
+	TRACE_ZONE("CoronaRenderer::framebufferCallback");
+	// called from the callback thread, so the globals node must not be used directly
+	RenderGlobalsSnapshotPtr globals = getRenderGlobalsSnapshot();
 	std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;
 	std::shared_ptr<CoronaRenderer> renderer = std::static_pointer_cast<CoronaRenderer>(MayaTo::getWorldPtr()->worldRendererPtr);
 
-	MString renderStamp = depFn.findPlug("renderStamp").asString();
+	MString renderStamp = globals->getString("renderStamp", "");
 	Corona::String rstamp = renderStamp.asChar();
 
 	EventQueue::Event e;
@@ -23,7 +28,7 @@ void CoronaRenderer::framebufferCallback()
 	if( MGlobal::mayaState() == MGlobal::kBatch)
 		return;
 
-	if (depFn.findPlug("useCoronaVFB").asBool())
+	if (globals->getBool("useCoronaVFB", false))
 	{
 		renderer->context.fb->updateRenderStamp(rstamp, true);
 		// force VFB redraw
@@ -49,9 +54,16 @@ void CoronaRenderer::framebufferCallback()
 	int xmax = width - 1;
 	int ymax = height - 1;
 
+	// only the pixels of the region are read, the region can be changed during ipr, so it is clamped to the framebuffer
 	if (renderGlobals->getUseRenderRegion())
 	{
 		renderGlobals->getRenderRegion(xmin, ymin, xmax, ymax);
+		xmin = std::max(xmin, 0);
+		ymin = std::max(ymin, 0);
+		xmax = std::min(xmax, p.x - 1);
+		ymax = std::min(ymax, p.y - 1);
+		if ((xmin > xmax) || (ymin > ymax))
+			return;
 		width = xmax - xmin + 1;
 		height = ymax - ymin + 1;
 	}
@@ -59,10 +71,10 @@ void CoronaRenderer::framebufferCallback()
 	size_t numPixels = width * height;
 	std::shared_ptr<RV_PIXEL> pixelsPtr(new RV_PIXEL[numPixels]);		
 	RV_PIXEL *pixels = pixelsPtr.get();
-	uint numPixelsInRow = p.x;
+	uint numPixelsInRow = width;
 	bool doToneMapping = true;
-	bool showRenderStamp = getBoolAttr("renderstamp_use", depFn, true);
-	Corona::Pixel firstPixelInRow(0, 0);
+	bool showRenderStamp = globals->getBool("renderstamp_use", true);
+	Corona::Pixel firstPixelInRow(xmin, 0);
 	Corona::Rgb *outColors = new Corona::Rgb[numPixelsInRow];
 	float *outAlpha = new float[numPixelsInRow];
 	renderer->defineColorMapping();
@@ -70,7 +82,7 @@ void CoronaRenderer::framebufferCallback()
 	renderer-> context.fb->setColorMapping(*renderer->context.colorMappingData);
 	MColor t(renderer->context.colorMappingData->tint.r(), renderer->context.colorMappingData->tint.g(), renderer->context.colorMappingData->tint.b());
 
-	for (uint rowId = 0; rowId < p.y; rowId++)
+	for (int rowId = ymin; rowId <= ymax; rowId++)
 	{
 		memset(outAlpha, 0, numPixelsInRow * sizeof(float));
 		firstPixelInRow.y = rowId;
@@ -82,17 +94,8 @@ void CoronaRenderer::framebufferCallback()
 			break;
 		}
 
-		uint rowPos = rowId * width;
-		if (renderGlobals->getUseRenderRegion())
-		{
-			if (rowId < ymin)
-				continue;
-			if (rowId > ymax)
-				continue;
-
-			rowPos = (rowId - ymin) * width - xmin;
-		}
-		for (int x = xmin; x < (xmax + 1); x++)
+		uint rowPos = (rowId - ymin) * width;
+		for (int x = 0; x < width; x++)
 		{
 			pixels[rowPos + x].r = outColors[x].r() * 255.0;
 			pixels[rowPos + x].g = outColors[x].g() * 255.0;
@@ -9,6 +9,8 @@
 #include "utilities/tools.h"
 #include "utilities/attrTools.h"
 #include "world.h"
+#include "utilities/tracing.h"
+#include "osl/oslTextureOptimizer.h"
 
 static Logging logger;
 
@@ -122,7 +124,7 @@ void updateCamera(Corona::CameraData& cameraData, MObject& cameraObject, const M
 					MPlug texNamePlug = bitMapFn.findPlug("fileTextureName");
 					if (!texNamePlug.isNull())
 					{
-						MString fileName = texNamePlug.asString();
+						MString fileName = MAYATO_OSL::getTextureOptimizer().getOptimizedPath(texNamePlug.asString());
 						Logging::debug(MString("Found bokeh bitmap file: ") + fileName);
 						Corona::Bitmap<Corona::Rgb> bokehBitmap;
 						Corona::loadImage(fileName.asChar(), bokehBitmap);
@@ -262,7 +264,7 @@ void CoronaRenderer::updateCamera(std::shared_ptr<MayaObject> cam)
 					MPlug texNamePlug = bitMapFn.findPlug("fileTextureName");
 					if (!texNamePlug.isNull())
 					{
-						MString fileName = texNamePlug.asString();
+						MString fileName = MAYATO_OSL::getTextureOptimizer().getOptimizedPath(texNamePlug.asString());
 						Logging::debug(MString("Found bokeh bitmap file: ") + fileName);
 						Corona::Bitmap<Corona::Rgb> bokehBitmap;
 						Corona::loadImage(fileName.asChar(), bokehBitmap);
@@ -281,6 +283,7 @@ void CoronaRenderer::updateCamera(std::shared_ptr<MayaObject> cam)
 
 void CoronaRenderer::defineCamera()
 {
+	TRACE_ZONE("CoronaRenderer::defineCamera");
 	MPoint rot, pos, scale;
 	std::shared_ptr<MayaScene> mayaScene = MayaTo::getWorldPtr()->worldScenePtr;
 	std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;
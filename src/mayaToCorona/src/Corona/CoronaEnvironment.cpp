@@ -12,6 +12,7 @@
 #include "CoronaOSLMap.h"
 #include "CoronaSky.h"
 #include "CoronaUtils.h"
+#include "utilities/tracing.h"
 
 
 static Logging logger;
@@ -19,6 +20,7 @@ static Logging logger;
 
 void CoronaRenderer::defineEnvironment()
 {
+	TRACE_ZONE("CoronaRenderer::defineEnvironment");
 	MFnDependencyNode depFn(getRenderGlobalsNode());
 	Corona::Rgb bgRgb = toCorona(getColorAttr("bgColor", depFn));
 
@@ -24,6 +24,9 @@
 #include "world.h"
 #include "CoronaShaders.h"
 #include "CoronaMap.h"
+#include "utilities/tracing.h"
+#include "threads/cancelToken.h"
+#include "utilities/sceneStatistics.h"
 
 static Logging logger;
 
@@ -156,7 +159,7 @@ void defineMesh(Corona::IGeometryGroup *group, const MObject& meshObject)
 	getMeshData(mo, points, normals, uArray, vArray, triPointIds, triNormalIds, triUvIds, triMatIds, perFaceAssignments);
 
 
-	Logging::debug(MString("Translating mesh object ") + meshFn.name().asChar());
+	LOG_DEBUG(MString("Translating mesh object ") + meshFn.name().asChar());
 	MString meshFullName = makeGoodString(meshFn.fullPathName());
 
 	uint numVertices = points.length();
@@ -244,6 +247,7 @@ void defineMesh(Corona::IGeometryGroup *group, const MObject& meshObject)
 
 void CoronaRenderer::defineMesh(std::shared_ptr<MayaObject> mobj)
 {
+	TRACE_ZONE_DETAIL("CoronaRenderer::defineMesh", mobj->shortName);
 	std::shared_ptr<MayaScene> mayaScene = MayaTo::getWorldPtr()->worldScenePtr;
 	std::shared_ptr<mtco_MayaObject> obj = std::static_pointer_cast<mtco_MayaObject>(mobj);
 
@@ -313,7 +317,10 @@ void CoronaRenderer::defineMesh(std::shared_ptr<MayaObject> mobj)
 	MFloatArray uArray, vArray;
 	MIntArray triPointIds, triNormalIds, triUvIds, triMatIds;
 	Logging::debug("defineMesh pre getMeshData");
+	MayaTo::StatisticsTimer extractionTimer;
 	obj->getMeshData(points, normals, uArray, vArray, triPointIds, triNormalIds, triUvIds, triMatIds);
+	MayaTo::getSceneStatistics().addExtractionTime(obj->fullName, extractionTimer.getSeconds());
+	MayaTo::StatisticsTimer exportTimer;
 
 	int numSteps = (int)obj->meshDataList.size();
 	uint numVertices = points.length();
@@ -437,6 +444,9 @@ void CoronaRenderer::defineMesh(std::shared_ptr<MayaObject> mobj)
 	//Logging::debug("}");
 	obj->perFaceAssignments.clear();
 	obj->meshDataList.clear();
+
+	long long exportedBytes = (long long)numSteps * (numVertices * sizeof(Corona::Pos) + numNormals * sizeof(Corona::Dir)) + (long long)numUvs * sizeof(Corona::Pos) + (long long)numTris * sizeof(Corona::TriangleData);
+	MayaTo::getSceneStatistics().addMeshExport(obj->fullName, numVertices, numTris, exportedBytes, exportTimer.getSeconds());
 }
 
 Corona::IGeometryGroup* CoronaRenderer::getGeometryPointer(std::shared_ptr<MayaObject> mobj)
@@ -456,7 +466,7 @@ Corona::IGeometryGroup* CoronaRenderer::getGeometryPointer(std::shared_ptr<MayaO
 		// if this object is visible or if it is invisible and it has a connection to an instancer node and there are any instancer elements, then export it
 		if( obj->visible || (((obj->attributes!=nullptr) && obj->attributes->hasInstancerConnection) && (mayaScene->instancerNodeElements.size() > 0)))
 		{
-			Logging::debug(MString("Translating mesh ") + obj->shortName );
+			LOG_DEBUG(MString("Translating mesh ") + obj->shortName );
 			this->defineMesh(obj);
 			if( obj->geom != nullptr )
 				geom = obj->geom;
@@ -469,6 +479,7 @@ Corona::IGeometryGroup* CoronaRenderer::getGeometryPointer(std::shared_ptr<MayaO
 
 void CoronaRenderer::defineGeometry()
 {
+	TRACE_ZONE("CoronaRenderer::defineGeometry");
 	std::shared_ptr<MayaScene> mayaScene = MayaTo::getWorldPtr()->worldScenePtr;
 	for (auto mobj : mayaScene->objectList)
 	{
@@ -476,6 +487,9 @@ void CoronaRenderer::defineGeometry()
 		if( !obj->mobject.hasFn(MFn::kMesh))
 			continue;
 
+		if (MayaTo::isRenderCancelled())
+			return;
+
 		Corona::IGeometryGroup* geom = getGeometryPointer(obj);
 		if( geom == nullptr )
 		{
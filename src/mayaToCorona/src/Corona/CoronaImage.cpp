@@ -1,6 +1,7 @@
 #include "Corona.h"
 #include <maya/MPlugArray.h>
 #include "renderGlobals.h"
+#include "renderGlobalsSnapshot.h"
 #include "utilities/logging.h"
 #include "utilities/pystring.h"
 #include "utilities/attrTools.h"
@@ -65,7 +66,7 @@ void CoronaRenderer::getPassesInfo(std::vector<MayaToRenderPass>& passes)
 
 void CoronaRenderer::saveMergedExr(Corona::String filename)
 {
-	MFnDependencyNode depFn(getRenderGlobalsNode());
+	RenderGlobalsSnapshotPtr globals = getRenderGlobalsSnapshot();
 
 	int width = this->context.fb->getImageSize().x;
 	int height = this->context.fb->getImageSize().y;
@@ -75,9 +76,8 @@ void CoronaRenderer::saveMergedExr(Corona::String filename)
 	MayaToRenderPass rpass;
 	rpass.channelType = MayaToRenderPass::COLOR;
 	rpass.passName = "Beauty";
-	MFnDependencyNode globalsNode(objectFromName("coronaGlobals"));
 	rpass.passType = MayaToRenderPass::FLOAT;
-	if (globalsNode.findPlug("exrDataTypeHalf").asBool())
+	if (globals->getBool("exrDataTypeHalf", false))
 		rpass.passType = MayaToRenderPass::HALF;
 	passes.push_back(rpass);
 	getPassesInfo(passes);
@@ -202,7 +202,7 @@ void CoronaRenderer::saveMergedExr(Corona::String filename)
 
 	// get scanlines
 	bool doToneMapping = true;
-	bool showRenderStamp = getBoolAttr("renderstamp_inFile", depFn, true);
+	bool showRenderStamp = globals->getBool("renderstamp_inFile", true);
 	int exrScanlineSize = pixelSize * width;
 	char *scanLine = new char[exrScanlineSize];
 	int z = 0;
@@ -331,14 +331,14 @@ MString CoronaRenderer::getImageFileName(MString& basename, MString& restname)
 
 void CoronaRenderer::saveImage()
 {
-	MFnDependencyNode depFn(getRenderGlobalsNode());
+	RenderGlobalsSnapshotPtr globals = getRenderGlobalsSnapshot();
 	std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;
 
 	Corona::Bitmap<Corona::Rgb, false> bitmap(this->context.fb->getImageSize());
 	Corona::Bitmap<float, false> alpha(this->context.fb->getImageSize());
 
 	bool doToneMapping = true;
-	bool showRenderStamp = getBoolAttr("renderstamp_inFile", depFn, true);
+	bool showRenderStamp = globals->getBool("renderstamp_inFile", true);
 	MString name, rest;
 	Corona::String filename = getImageFileName(name, rest).asChar();
 	bool isExr = pystring::endswith(filename.cStr(), ".exr");
@@ -362,10 +362,10 @@ void CoronaRenderer::saveImage()
 
 	if (isExr)
 	{
-		if (getBoolAttr("exrMergeChannels", depFn, true))
+		if (globals->getBool("exrMergeChannels", true))
 		{
 			saveMergedExr(filename);
-			context.colorMappingData->gamma = getFloatAttr("colorMapping_gamma", depFn, 2.2);
+			context.colorMappingData->gamma = globals->getFloat("colorMapping_gamma", 2.2f);
 			return;
 		}
 	}
@@ -13,6 +13,7 @@
 #include "mayaScene.h"
 #include "world.h"
 #include "../mtco_common/mtco_mayaObject.h"
+#include "utilities/tracing.h"
 
 bool CoronaRenderer::isSunLight(std::shared_ptr<MayaObject> obj)
 {
@@ -289,6 +290,7 @@ void CoronaRenderer::updateLight(std::shared_ptr<MayaObject> mobj)
 
 void CoronaRenderer::defineLights()
 {
+	TRACE_ZONE("CoronaRenderer::defineLights");
 	//MFnDependencyNode rGlNode(getRenderGlobalsNode());
 	//MObject coronaGlobals = getRenderGlobalsNode();
 	//std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;
@@ -3,6 +3,7 @@
 #include "utilities/pystring.h"
 #include "utilities/attrTools.h"
 #include "utilities/tools.h"
+#include "osl/oslTextureOptimizer.h"
 #include <vector>
 
 bool textureFileSupported(MString fileName)
@@ -41,7 +42,7 @@ mtco_MapLoader::mtco_MapLoader(MObject& mobject)
 	colorGain = getColorAttr("colorGain", depFn);
 	colorOffset = getColorAttr("colorOffset", depFn);
 	exposure = getFloatAttr("exposure", depFn, 0.0f);
-	fileName = getStringAttr("fileTextureName", depFn, "");
+	fileName = MAYATO_OSL::getTextureOptimizer().getOptimizedPath(getStringAttr("fileTextureName", depFn, ""));
 	int enviroMapping = getEnumInt("environmentMappingType", depFn);
 	Corona::TextureShader::EnviroMapping envM[] = { Corona::TextureShader::EnviroMapping::MAPPING_SPHERICAL, Corona::TextureShader::EnviroMapping::MAPPING_SCREEN };
 	tsConfig.mapping.enviroMapping = envM[enviroMapping];
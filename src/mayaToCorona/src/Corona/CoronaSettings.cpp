@@ -12,6 +12,19 @@
 #include <maya/MColorManagementUtilities.h>
 #endif
 
+// a region of 0 0 0 0 renders the whole image
+void CoronaRenderer::defineRenderRegion()
+{
+	std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;
+	int left = 0, bottom = 0, right = 0, top = 0;
+	if (renderGlobals->getUseRenderRegion())
+		renderGlobals->getRenderRegion(left, bottom, right, top);
+	context.settings->set(Corona::PARAM_IMAGE_REGION_START_X, left);
+	context.settings->set(Corona::PARAM_IMAGE_REGION_START_Y, bottom);
+	context.settings->set(Corona::PARAM_IMAGE_REGION_END_X, right);
+	context.settings->set(Corona::PARAM_IMAGE_REGION_END_Y, top);
+}
+
 void CoronaRenderer::defineSettings()
 {
 	MFnDependencyNode depFn(getRenderGlobalsNode());
@@ -30,14 +43,7 @@ void CoronaRenderer::defineSettings()
 		context.settings->set(Corona::PARAM_RANDOM_SEED, 0);
 
 	if (renderGlobals->getUseRenderRegion())
-	{
-		int left, bottom, right, top;
-		renderGlobals->getRenderRegion(left, bottom, right, top);
-		context.settings->set(Corona::PARAM_IMAGE_REGION_START_X, left);
-		context.settings->set(Corona::PARAM_IMAGE_REGION_START_Y, bottom);
-		context.settings->set(Corona::PARAM_IMAGE_REGION_END_X, right);
-		context.settings->set(Corona::PARAM_IMAGE_REGION_END_Y, top);
-	}
+		defineRenderRegion();
 
 	int renderer = getIntAttr("renderer", depFn, 0);
 	if( renderer == 0) // progressive
@@ -73,7 +73,7 @@ Corona::ColorOrMap defineAttribute(MString& attributeName, MFnDependencyNode& de
 		{
 			if (connectedNode.typeName() == coronaTextureNodeNames[i])
 			{
-				Logging::debug(MString("Found a connected corona map : ") + connectedNode.name() + " -> " + attributeName);
+				LOG_DEBUG(MString("Found a connected corona map : ") + connectedNode.name() + " -> " + attributeName);
 				if (connectedNode.typeName() == "CoronaAO")
 				{
 					texmap = new AoMap(connectedObject);
@@ -229,7 +229,7 @@ Corona::SharedPtr<Corona::IMaterial> defineCoronaMaterial(MObject& materialNode,
 	if (network.shaderList.size() == 0)
 		return defineDefaultMaterial();
 
-	Logging::debug(MString("Defining corona material from node: ") + network.rootNodeName);
+	LOG_DEBUG(MString("Defining corona material from node: ") + network.rootNodeName);
 
 	MFnDependencyNode depFn(materialNode);
 
@@ -323,7 +323,7 @@ Corona::SharedPtr<Corona::IMaterial> defineCoronaMaterial(MObject& materialNode,
 				if (!found)
 					continue;
 
-				Logging::debug(MString("Creating entry ") + pId + " Shader: " + nodeName);
+				LOG_DEBUG(MString("Creating entry ") + pId + " Shader: " + nodeName);
 				Corona::LayeredMtlData::MtlEntry entry;
 				entry.material = defineCoronaMaterial(inputs[0].node(), obj, oslRenderer, keepData);
 				MString attName = aPlug.name();
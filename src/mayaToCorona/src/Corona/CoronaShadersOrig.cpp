@@ -18,6 +18,8 @@
 #include "osl/oslUtils.h"
 #include "CoronaMap.h"
 #include "world.h"
+#include "utilities/tracing.h"
+#include "utilities/sceneStatistics.h"
 #include <time.h>
 
 static Logging logger;
@@ -91,6 +93,7 @@ void CoronaRenderer::clearMaterialLists()
 
 void CoronaRenderer::defineMaterial(Corona::IInstance* instance, std::shared_ptr<MayaObject> mobj)
 {
+	TRACE_ZONE_DETAIL("CoronaRenderer::defineMaterial", mobj->shortName);
 	std::shared_ptr<mtco_MayaObject> obj = std::static_pointer_cast<mtco_MayaObject>(mobj);
 	
 	MFnDependencyNode globalsNode(objectFromName("coronaGlobals"));
@@ -132,6 +135,7 @@ void CoronaRenderer::defineMaterial(Corona::IInstance* instance, std::shared_ptr
 		for (uint sgId = 0; sgId < obj->shadingGroups.length(); sgId++)
 		{
 			MObject shadingGroup = obj->shadingGroups[sgId];
+			MayaTo::MaterialStatisticsScope materialStatistics(getObjectName(shadingGroup));
 			Logging::debug(MString("---------- Check shading group: ") + getObjectName(shadingGroup) + " for existence on object named " +  obj->fullName);
 			if (assingExistingMat(shadingGroup, obj))
 				return;
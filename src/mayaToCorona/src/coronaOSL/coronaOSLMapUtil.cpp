@@ -20,7 +20,7 @@ Corona::SharedPtr<Corona::Abstract::Map> getOslTexMap(MString& attributeName, MF
 	MString outPlugName;
 	MString connectedObjectName = getObjectName(getOtherSideSourceNode(attributeName, thisMObject, true, outPlugName));
 
-	Logging::debug(MString("getOslTexMap: ") + connectedObjectName + "." + outPlugName + " is connected with " + depFn.name() + "." + attributeName);
+	LOG_DEBUG(MString("getOslTexMap: ") + connectedObjectName + "." + outPlugName + " is connected with " + depFn.name() + "." + attributeName);
 	MPlug shaderPlug = depFn.findPlug(attributeName);
 
 	OSLShaderClass.createOSLProjectionNodes(shaderPlug);
@@ -28,7 +28,7 @@ Corona::SharedPtr<Corona::Abstract::Map> getOslTexMap(MString& attributeName, MF
 	for (int shadingNodeId = 0; shadingNodeId < numNodes; shadingNodeId++)
 	{
 		ShadingNode snode = sn.shaderList[shadingNodeId];
-		Logging::debug(MString("ShadingNode Id: ") + shadingNodeId + " ShadingNode name: " + snode.fullName);
+		LOG_DEBUG(MString("ShadingNode Id: ") + shadingNodeId + " ShadingNode name: " + snode.fullName);
 		OSLShaderClass.createOSLHelperNodes(sn.shaderList[shadingNodeId]);
 		OSLShaderClass.createOSLShadingNode(sn.shaderList[shadingNodeId]);
 		OSLShaderClass.connectProjectionNodes(sn.shaderList[shadingNodeId].mobject);
@@ -36,14 +36,14 @@ Corona::SharedPtr<Corona::Abstract::Map> getOslTexMap(MString& attributeName, MF
 		if (snode.fullName == connectedObjectName.asChar())
 		{
 			OSLShaderClass.createOSLHelperNodes(sn.shaderList[sn.shaderList.size() - 1]);
-			Logging::debug(MString("connected node found: ") + snode.fullName + " search output attr.");
+			LOG_DEBUG(MString("connected node found: ") + snode.fullName + " search output attr.");
 
 			for (size_t outId = 0; outId < snode.outputAttributes.size(); outId++)
 			{
-				ShaderAttribute& sa = snode.outputAttributes[outId];
+				const ShaderAttribute& sa = snode.outputAttributes[outId];
 				if (MString(sa.name.c_str()) == outPlugName)
 				{
-					Logging::debug(MString("connected out attr found: ") + sa.name.c_str() + " ");
+					LOG_DEBUG(MString("connected out attr found: ") + sa.name.c_str() + " ");
 
 					MString destParam;
 					MString sourceParam = outPlugName;
@@ -52,7 +52,7 @@ Corona::SharedPtr<Corona::Abstract::Map> getOslTexMap(MString& attributeName, MF
 					{
 						// lets see if we have a color helper node
 						MString helperNodeName = OSLShaderClass.createPlugHelperNodeName(attributeName.asChar(), thisMObject, false);
-						Logging::debug(MString("Interface connection - color/vector attribute ") + sa.name.c_str() + " search for helper node " + helperNodeName);
+						LOG_DEBUG(MString("Interface connection - color/vector attribute ") + sa.name.c_str() + " search for helper node " + helperNodeName);
 						if (OSLShaderClass.doesOSLNodeAlreadyExist(helperNodeName))
 						{
 							Logging::debug(MString("Found helper node name."));
@@ -82,7 +82,7 @@ Corona::SharedPtr<Corona::Abstract::Map> getOslTexMap(MString& attributeName, MF
 					MPlug multiplierAttribute = depFn.findPlug(multiplierName, true, &status);
 					if (status)
 					{
-						Logging::debug(MString("Found multiplier attribute: ") + multiplierName);
+						LOG_DEBUG(MString("Found multiplier attribute: ") + multiplierName);
 						float multiplier = multiplierAttribute.asFloat();
 						float offset = 0.0f;
 						if ((attributeName == "refractionIndex") || (attributeName == "reflectionIor"))
@@ -92,9 +92,9 @@ Corona::SharedPtr<Corona::Abstract::Map> getOslTexMap(MString& attributeName, MF
 						oslRenderer->shadingsys->Parameter("multiplier", OSL::TypeDesc::TypeFloat, &multiplier);
 						oslRenderer->shadingsys->Parameter("offset", OSL::TypeDesc::TypeFloat, &offset);
 					}
-					Logging::debug(MString("creating OSLInterface shader ") + OSLInterfaceName);
+					LOG_DEBUG(MString("creating OSLInterface shader ") + OSLInterfaceName);
 					bool success = oslRenderer->shadingsys->Shader("surface", "OSLInterface", OSLInterfaceName.asChar());
-					Logging::debug(MString("connecting ") + sourceNode + "." + sourceParam + " -> " + OSLInterfaceName + "." + destParam);
+					LOG_DEBUG(MString("connecting ") + sourceNode + "." + sourceParam + " -> " + OSLInterfaceName + "." + destParam);
 					success = oslRenderer->shadingsys->ConnectShaders(sourceNode.asChar(), sourceParam.asChar(), OSLInterfaceName.asChar(), destParam.asChar());
 					break;
 				}
@@ -108,7 +108,7 @@ Corona::SharedPtr<Corona::Abstract::Map> getOslTexMap(MString& attributeName, MF
 	}
 	std::string serialized;
 	oslRenderer->shadingsys->getattribute(shaderGroup.get(), "pickle", serialized);
-	Logging::debug(MString("Serialized: ") + serialized.c_str());
+	LOG_DEBUG(MString("Serialized: ") + serialized.c_str());
 
 	Corona::SharedPtr<Corona::Abstract::Map> oslMapp = new OSLMap;
 	OSLMap *oslMap = (OSLMap *)oslMapp.getReference();
@@ -4,6 +4,7 @@
 #include "OSL/genclosure.h"
 #include "utilities/logging.h"
 #include "utilities/tools.h"
+#include "osl/oslTextureSystem.h"
 
 using namespace OSL;
 
@@ -456,9 +457,8 @@ void OSLShadingNetworkRenderer::setup()
 	Logging::debug(MString("setting osl shader search path to: ") + oslShaderPath.c_str());
 	setShaderSearchPath(oslShaderPath);
 
-	this->shadingsys = OSL::ShadingSystem::create (&renderer, nullptr, &this->errorHandler);
-	OIIO::TextureSystem *ts = this->shadingsys->texturesys();
-	ts->attribute("grey_to_rgb", 1);
+	// all shading systems share one texture cache, see oslTextureSystem.h
+	this->shadingsys = OSL::ShadingSystem::create (&renderer, MAYATO_OSL::getTextureSystemManager().get(), &this->errorHandler);
 	this->shadingsys->attribute("lockgeom", 1);
 	this->shadingsys->attribute("searchpath:shader", this->shaderSearchPath);
 	
@@ -8,6 +8,7 @@
 #include "utilities/tools.h"
 #include "utilities/attrTools.h"
 #include "world.h"
+#include "dummyRenderer/benchmarkRenderer.h"
 #include "Version.h"
 
 #include <fstream>
@@ -39,10 +40,15 @@ MSyntax MayaToCorona::newSyntax()
 	stat = syntax.addFlag( "-sar", "-startIpr");
 	stat = syntax.addFlag("-str", "-stopIpr");
 	stat = syntax.addFlag("-par", "-pauseIpr");
+	// the render region was changed in the render view during IPR
+	stat = syntax.addFlag("-uir", "-updateIprRegion");
 	stat = syntax.addFlag("-ue", "-usrEvent", MSyntax::kString);
 	stat = syntax.addFlag("-uds", "-usrDataString", MSyntax::kString);
 	stat = syntax.addFlag("-udi", "-usrDataInt", MSyntax::kLong);
 	stat = syntax.addFlag("-udf", "-usrDataFloat", MSyntax::kDouble);
+	// translates the current scene without rendering it and returns the duration of the translation phases as json,
+	// args: result file (can be empty), scene name
+	stat = syntax.addFlag("-bm", "-benchmark", MSyntax::kString, MSyntax::kString);
 
 	return syntax;
 }
@@ -96,6 +102,18 @@ MStatus MayaToCorona::doIt( const MArgList& args)
 	MGlobal::displayInfo("Executing mayaToCorona...");
 	setLogLevel();
 
+	if (argData.isFlagSet("-benchmark", &stat))
+	{
+		MString resultFile, sceneName;
+		argData.getFlagArgument("-benchmark", 0, resultFile);
+		argData.getFlagArgument("-benchmark", 1, sceneName);
+		MString result = MayaTo::runTranslationBenchmark(resultFile, sceneName);
+		if (result.length() == 0)
+			return MS::kFailure;
+		setResult(result);
+		return MS::kSuccess;
+	}
+
 	if (argData.isFlagSet("-canDoIPR", &stat))
 	{
 		if(MayaTo::getWorldPtr()->canDoIPR())
@@ -124,6 +142,15 @@ MStatus MayaToCorona::doIt( const MArgList& args)
 		return MS::kSuccess;
 	}
 
+	if (argData.isFlagSet("-updateIprRegion", &stat))
+	{
+		Logging::debug(MString("-updateIprRegion"));
+		EventQueue::Event e;
+		e.type = EventQueue::Event::IPRUPDATEREGION;
+		theRenderEventQueue()->push(e);
+		return MS::kSuccess;
+	}
+
 	if (argData.isFlagSet("-usrDataString", &stat))
 	{
 		Logging::debug(MString("-usrDataString"));
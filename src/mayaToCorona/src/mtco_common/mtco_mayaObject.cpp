@@ -35,7 +35,7 @@ mtco_MayaObject::mtco_MayaObject(MObject& mobject) : MayaObject(mobject)
 
 mtco_MayaObject::mtco_MayaObject(MDagPath& mobject) : MayaObject(mobject)
 {
-	Logging::debug(MString("created obj: ") + this->dagPath.fullPathName());
+	LOG_DEBUG(MString("created obj: ") + this->dagPath.fullPathName());
 	this->geom = nullptr;
 	this->instance = nullptr;
 }
@@ -174,7 +174,7 @@ MStatus mtco_MayaRenderer::translateMesh(const MUuid& id, const MObject& node)
 	{
 		if (gg.id == id)
 		{
-			Logging::debug(MString("Found existing geometry group for mesh ") + getObjectName(node));
+			LOG_DEBUG(MString("Found existing geometry group for mesh ") + getObjectName(node));
 			context->scene->deleteGeomGroup(gg.geoGrp);
 			gg.geoGrp = context->scene->addGeomGroup();
 			group = gg.geoGrp;
@@ -184,7 +184,7 @@ MStatus mtco_MayaRenderer::translateMesh(const MUuid& id, const MObject& node)
 	// if we do not have an entry, create a new one
 	if (group == nullptr)
 	{
-		Logging::debug(MString("Found no existing geometry group for mesh ") + getObjectName(node) + " creating new one.");
+		LOG_DEBUG(MString("Found no existing geometry group for mesh ") + getObjectName(node) + " creating new one.");
 		GeoGroupStruct gg;
 		gg.geoGrp = context->scene->addGeomGroup();
 		gg.mobject = node;
@@ -218,7 +218,7 @@ MStatus mtco_MayaRenderer::translateLightSource(const MUuid& id, const MObject&
 	{
 		if (gg.mobject == node)
 		{
-			Logging::debug(MString("Found existing geometry group for mesh ") + getObjectName(node));
+			LOG_DEBUG(MString("Found existing geometry group for mesh ") + getObjectName(node));
 			context->scene->deleteGeomGroup(gg.geoGrp);
 			gg.geoGrp = context->scene->addGeomGroup();
 			group = gg.geoGrp;
@@ -278,7 +278,7 @@ MStatus mtco_MayaRenderer::translateTransform(const MUuid& id, const MUuid& chil
 		//Logging::debug(MString("Searching id in obj array: idn.id ") + idn.id + " id " + id + " childId " + childId);
 		if (idn.mobject == lastShape)
 		{
-			Logging::debug(MString("Found id for obj ") + idn.name);
+			LOG_DEBUG(MString("Found id for obj ") + idn.name);
 			if (idn.mobject.hasFn(MFn::kCamera))
 			{			
 				Logging::debug(MString("Camera Transform"));
@@ -142,6 +142,9 @@ MObject MayaToCoronaGlobals::dumpAndResume;
 MObject MayaToCoronaGlobals::dumpExrFile;
 MObject MayaToCoronaGlobals::uhdCacheType;
 MObject MayaToCoronaGlobals::uhdPrecision;
+MObject MayaToCoronaGlobals::textureCacheSize;
+MObject MayaToCoronaGlobals::textureMaxOpenFiles;
+MObject MayaToCoronaGlobals::textureAutoTile;
 MObject MayaToCoronaGlobals::globalVolume;
 MObject MayaToCoronaGlobals::useGlobalMaterialOverride;
 MObject MayaToCoronaGlobals::globalMaterialOverride;
@@ -799,6 +802,20 @@ MStatus	MayaToCoronaGlobals::initialize()
 	nAttr.setMin(0.01);
 	nAttr.setSoftMax(10.0);
 	CHECK_MSTATUS(addAttribute(uhdPrecision));
+
+	// OIIO texture cache of the OSL textures in MB
+	textureCacheSize = nAttr.create("textureCacheSize", "textureCacheSize", MFnNumericData::kInt, 1024);
+	nAttr.setMin(16);
+	CHECK_MSTATUS(addAttribute(textureCacheSize));
+
+	textureMaxOpenFiles = nAttr.create("textureMaxOpenFiles", "textureMaxOpenFiles", MFnNumericData::kInt, 100);
+	nAttr.setMin(4);
+	CHECK_MSTATUS(addAttribute(textureMaxOpenFiles));
+
+	// tile size for scanline textures, 0 turns it off
+	textureAutoTile = nAttr.create("textureAutoTile", "textureAutoTile", MFnNumericData::kInt, 64);
+	nAttr.setMin(0);
+	CHECK_MSTATUS(addAttribute(textureAutoTile));
 	
 
 	return stat;
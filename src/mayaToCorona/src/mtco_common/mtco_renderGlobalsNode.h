@@ -151,6 +151,9 @@ static    MObject dumpAndResume;
 static    MObject dumpExrFile;
 static    MObject uhdCacheType;
 static    MObject uhdPrecision;
+static    MObject textureCacheSize;
+static    MObject textureMaxOpenFiles;
+static    MObject textureAutoTile;
 static    MObject globalVolume;
 static    MObject useGlobalMaterialOverride;
 static    MObject globalMaterialOverride;
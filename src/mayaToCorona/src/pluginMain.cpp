@@ -13,6 +13,7 @@
 #include "mtco_common/mtco_renderGlobalsNode.h"
 #include "utilities/tools.h"
 #include "utilities/logging.h"
+#include "osl/oslTextureSystem.h"
 
 #include "CoronaCore/api/Api.h"
 
@@ -197,6 +198,8 @@ MStatus uninitializePlugin( MObject obj)
 	MFnPlugin plugin( obj );
 
 	MayaTo::deleteWorld();
+	MAYATO_OSL::getTextureSystemManager().destroy();
+	Logging::shutdown();
 
 #ifdef HAS_OVERRIDE
 	CHECK_MSTATUS(MHWRender::MDrawRegistry::deregisterSurfaceShadingNodeOverrideCreator(CoronaSurfacesDrawDBClassification, CoronaSurfacesRegistrantId));
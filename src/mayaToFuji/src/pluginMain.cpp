@@ -2,6 +2,7 @@
 #include <maya/MFnPlugin.h>
 
 #include "mayatoFuji.h"
+#include "utilities/logging.h"
 #include "mtfu_common/mtfu_renderGlobalsNode.h"
 
 #define VENDOR "haggis vfx & animation"
@@ -49,6 +50,9 @@ MStatus uninitializePlugin( MObject obj)
 	MStatus   status;
 	MFnPlugin plugin( obj );
 
+	// joins the log output thread, it must not be running when the plugin is unloaded
+	Logging::shutdown();
+
 	const MString UserClassify( "shader/surface" );
 	
 	std::cout << "deregister mtap cmd\n";
@@ -9,7 +9,6 @@ static Logging logger;
 
 void IndigoRenderer::framebufferCallback()
 {
-	MFnDependencyNode depFn(getRenderGlobalsNode());
 	std::shared_ptr<RenderGlobals> renderGlobals = MayaTo::getWorldPtr()->worldRenderGlobalsPtr;
 	std::shared_ptr<IndigoRenderer> renderer = std::static_pointer_cast<IndigoRenderer>(MayaTo::getWorldPtr()->worldRendererPtr);
 
@@ -19,6 +19,7 @@
 #include "shaders/inMediumBasicMaterial.h"
 
 #include "world.h"
+#include "utilities/logging.h"
 #include "Indigo/Version.h"
 
 #define VENDOR "haggis vfx & animation"
@@ -143,6 +144,7 @@ MStatus uninitializePlugin( MObject obj)
 	const MString UserClassify( "shader/surface" );
 	
 	MayaTo::deleteWorld();
+	Logging::shutdown();
 
 #ifdef HAS_OVERRIDE
 	CHECK_MSTATUS(MHWRender::MDrawRegistry::deregisterSurfaceShadingNodeOverrideCreator(inGlossyTransparentsDrawDBClassification, inGlossyTransparentsRegistrantId));
@@ -2,6 +2,7 @@
 #include <maya/MFnPlugin.h>
 
 #include "mayatokray.h"
+#include "utilities/logging.h"
 #include "mtkr_common/mtkr_renderGlobalsNode.h"
 #include "shaders/krayMaterial.h"
 
@@ -59,6 +60,9 @@ MStatus uninitializePlugin( MObject obj)
 	MStatus   status;
 	MFnPlugin plugin( obj );
 
+	// joins the log output thread, it must not be running when the plugin is unloaded
+	Logging::shutdown();
+
 	const MString UserClassify( "shader/surface" );
 	
 	std::cout << "deregister mtap cmd\n";
@@ -3,6 +3,7 @@
 #include <maya/MStringArray.h>
 
 #include "threads/renderQueueWorker.h"
+#include "threads/cancelToken.h"
 #include "utilities/tools.h"
 #include "utilities/attrTools.h"
 #include "renderGlobals.h"
@@ -508,6 +509,20 @@ void LuxRenderer::defineSurfaceIntegrator()
 }
 
 
+bool LuxRenderer::writeCheckpoint(const MString& fileName)
+{
+	if (!isRendering || !this->lux)
+		return false;
+	this->lux->saveFLM(fileName.asChar());
+	return true;
+}
+
+bool LuxRenderer::resumeFromCheckpoint(const MString& fileName)
+{
+	this->resumeFlmFile = fileName;
+	return true;
+}
+
 void LuxRenderer::render()
 {
 	logger.debug(MString("Render lux."));
@@ -532,6 +547,12 @@ void LuxRenderer::render()
 		std::string filename = "cpp_api_test";
 
 		lux = CreateInstance("cpp_api_test");
+		// the film of a checkpoint has to be defined before worldEnd() starts the rendering
+		if (this->resumeFlmFile.length() > 0)
+		{
+			lux->overrideResumeFLM(this->resumeFlmFile.asChar());
+			this->resumeFlmFile = "";
+		}
 
 		this->defineCamera();
 
@@ -575,6 +596,7 @@ void LuxRenderer::render()
 			lux->addThread();
 
 		lux->wait();
+		this->frameCompleted = !MayaTo::isRenderCancelled();
 
 		MayaTo::getWorldPtr()->setRenderState(MayaTo::MayaToWorld::WorldRenderState::RSTATENONE);
 
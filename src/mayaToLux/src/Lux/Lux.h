@@ -69,6 +69,13 @@ public:
 	virtual void updateTransform(std::shared_ptr<MayaObject> obj);
 	virtual void doInteractiveUpdate(){}
 	virtual void handleUserEvent(int event, MString strData, float floatData, int intData){}
+	// checkpoints are lux films, they contain the accumulated samples and can be resumed
+	virtual bool canCheckpoint(){ return true; }
+	virtual MString getCheckpointExtension(){ return "flm"; }
+	virtual bool writeCheckpoint(const MString& fileName);
+	virtual bool resumeFromCheckpoint(const MString& fileName);
+	// the lux instance is created in render(), so the film is only remembered here
+	MString resumeFlmFile;
 
 	// testing
 	void getMeshPoints(MPointArray& pointArray);
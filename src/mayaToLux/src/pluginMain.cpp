@@ -4,6 +4,7 @@
 #include <maya/MDrawRegistry.h>
 
 #include "mayatoLux.h"
+#include "utilities/logging.h"
 #include "mtlu_common/mtlu_renderGlobalsNode.h"
 
 #include "shaders/mixMaterial.h"
@@ -316,6 +317,7 @@ MStatus uninitializePlugin( MObject obj)
 	const MString UserClassify( "shader/surface" );
 
 	MayaTo::deleteWorld();
+	Logging::shutdown();
 
 	std::cout << "deregister mtap cmd\n";
 	status = plugin.deregisterCommand( MAYATOCMDNAME );
@@ -13,6 +13,7 @@
 #include <maya/MPxCommand.h>
 
 #include "mayatomantra.h"
+#include "utilities/logging.h"
 //#include "shadingTools/mtm_readShaderDefs.h"
 #include "mtm_globalsNode.h"
 #include "mtm_envlight.h"
@@ -87,6 +88,9 @@ MStatus uninitializePlugin( MObject obj)
 	MStatus   status;
 	MFnPlugin plugin( obj );
 
+	// joins the log output thread, it must not be running when the plugin is unloaded
+	Logging::shutdown();
+
 	status = plugin.deregisterCommand( MAYATOMANTRANAME );
 	if (!status) {
 		status.perror("cannot deregister command: mayatomantra");
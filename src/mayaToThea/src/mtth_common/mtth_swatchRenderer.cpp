@@ -7,7 +7,6 @@
 #include "utilities/tools.h"
 #include "utilities/attrTools.h"
 #include "utilities/logging.h"
-#include "swatchesRenderer/swatchGeometry.h"
 
 static bool done;
 
@@ -4,6 +4,7 @@
 
 #include "mayatoThea.h"
 #include "utilities/tools.h"
+#include "utilities/logging.h"
 #include "mtth_common/mtth_renderGlobalsNode.h"
 #include "swatchesRenderer\swatchRenderer.h"
 
@@ -175,6 +176,9 @@ MStatus uninitializePlugin( MObject obj)
 	MStatus   status;
 	MFnPlugin plugin( obj );
 
+	// joins the log output thread, it must not be running when the plugin is unloaded
+	Logging::shutdown();
+
 	const MString UserClassify( "shader/surface" );
 
 	if (MGlobal::mayaState() != MGlobal::kBatch)